@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file ConcurrentUnionFind.h
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#ifndef CONCURRENTUNIONFIND_H_
+#define CONCURRENTUNIONFIND_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#pragma intrinsic(_InterlockedCompareExchange)
+#endif
+
+namespace BaseLib {
+
+/**
+ * Atomically replaces the value *ptr by new_value if *ptr equals old_value.
+ * @return true if the value was replaced, else false
+ */
+inline bool atomicCompareAndSwap(unsigned volatile* ptr, unsigned old_value, unsigned new_value)
+{
+#ifdef _MSC_VER
+	return static_cast<unsigned>(_InterlockedCompareExchange(reinterpret_cast<long volatile*>(ptr),
+		static_cast<long>(new_value), static_cast<long>(old_value))) == old_value;
+#else
+	return __sync_bool_compare_and_swap(ptr, old_value, new_value);
+#endif
+}
+
+/**
+ * The class ConcurrentUnionFind manages a partition of the set {0, ..., n-1}
+ * into disjoint subsets. Subsets can be merged by several threads at the same
+ * time without locks.
+ *
+ * A root is always linked to the root with the smaller index (using an atomic
+ * compare and swap), i.e., the parent of an index is never larger than the
+ * index itself and the representative of a subset is its smallest index.
+ * This makes the result independent of the order the merges are applied in.
+ */
+class ConcurrentUnionFind {
+public:
+	/**
+	 * Constructs n singleton subsets {0}, ..., {n-1}.
+	 */
+	explicit ConcurrentUnionFind(std::size_t n) :
+		_parent(n)
+	{
+		for (std::size_t k(0); k < n; k++) {
+			_parent[k] = static_cast<unsigned>(k);
+		}
+	}
+
+	/**
+	 * Returns the current root of the subset containing k. While other threads
+	 * are merging subsets the root may change later on.
+	 */
+	unsigned find(unsigned k) const
+	{
+		unsigned volatile const* parent(&_parent[0]);
+		unsigned p(parent[k]);
+		while (p != k) {
+			k = p;
+			p = parent[k];
+		}
+		return k;
+	}
+
+	/**
+	 * Merges the subsets containing a and b. The method can be called
+	 * concurrently from several threads.
+	 */
+	void unite(unsigned a, unsigned b)
+	{
+		unsigned volatile* parent(&_parent[0]);
+		for (;;) {
+			a = find(a);
+			b = find(b);
+			if (a == b)
+				return;
+			if (a < b)
+				std::swap(a, b);
+			// a is the larger root - link it to b if it is still a root
+			if (atomicCompareAndSwap(parent + a, a, b))
+				return;
+		}
+	}
+
+	/**
+	 * Computes for every index the representative, i.e., the smallest index,
+	 * of its subset. Must not be called concurrently to unite().
+	 * @param representatives (output) representatives[k] is the representative of k
+	 */
+	void getRepresentatives(std::vector<unsigned> &representatives) const
+	{
+		const std::size_t n(_parent.size());
+		representatives.resize(n);
+		// since _parent[k] <= k the representative of _parent[k] is already known
+		for (std::size_t k(0); k < n; k++) {
+			representatives[k] = (_parent[k] == k) ? static_cast<unsigned>(k) : representatives[_parent[k]];
+		}
+	}
+
+private:
+	std::vector<unsigned> _parent;
+};
+
+} // end namespace BaseLib
+
+#endif /* CONCURRENTUNIONFIND_H_ */
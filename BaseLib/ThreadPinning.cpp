@@ -0,0 +1,90 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file ThreadPinning.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <sstream>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#if defined(__linux__) && defined(_OPENMP)
+#include <sched.h>
+#include <unistd.h>
+#define OGS_THREAD_PINNING
+#endif
+
+#include "ThreadPinning.h"
+
+namespace BaseLib {
+
+ThreadPinningStrategy convertStringToThreadPinningStrategy(std::string const& str)
+{
+	if (str.compare("compact") == 0)
+		return COMPACT_PINNING;
+	if (str.compare("scatter") == 0)
+		return SCATTER_PINNING;
+	return NO_PINNING;
+}
+
+bool pinOpenMPThreads(ThreadPinningStrategy strategy)
+{
+#ifdef OGS_THREAD_PINNING
+	const long n_procs(sysconf(_SC_NPROCESSORS_ONLN));
+	if (n_procs < 1)
+		return false;
+
+	bool success(true);
+	#pragma omp parallel reduction(&&:success)
+	{
+		const long n_threads(omp_get_num_threads());
+		const long thread(omp_get_thread_num());
+		cpu_set_t cpu_set;
+		CPU_ZERO(&cpu_set);
+		if (strategy == NO_PINNING) {
+			for (long k(0); k < n_procs; k++)
+				CPU_SET(k, &cpu_set);
+		} else {
+			long proc(thread % n_procs);
+			if (strategy == SCATTER_PINNING && n_threads < n_procs)
+				proc = (thread * n_procs) / n_threads;
+			CPU_SET(proc, &cpu_set);
+		}
+		// pid 0 denotes the calling thread
+		success = (sched_setaffinity(0, sizeof(cpu_set_t), &cpu_set) == 0);
+	}
+	return success;
+#else
+	return strategy == NO_PINNING;
+#endif
+}
+
+std::string getOpenMPThreadPlacement()
+{
+	std::ostringstream os;
+#ifdef OGS_THREAD_PINNING
+	std::vector<int> cpus(omp_get_max_threads(), -1);
+	#pragma omp parallel
+	cpus[omp_get_thread_num()] = sched_getcpu();
+
+	for (std::size_t k(0); k < cpus.size(); k++) {
+		if (k > 0)
+			os << " ";
+		os << k << "->" << cpus[k];
+	}
+#else
+	os << "unknown";
+#endif
+	return os.str();
+}
+
+} // end namespace BaseLib
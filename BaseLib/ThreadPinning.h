@@ -0,0 +1,54 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file ThreadPinning.h
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#ifndef THREADPINNING_H_
+#define THREADPINNING_H_
+
+#include <string>
+
+namespace BaseLib {
+
+/**
+ * Strategies to bind the OpenMP threads to processors. The processors are
+ * numbered as reported by the operating system.
+ */
+enum ThreadPinningStrategy {
+	NO_PINNING, //!< the operating system is free to migrate the threads
+	COMPACT_PINNING, //!< thread k runs on processor k (fills one socket first)
+	SCATTER_PINNING //!< the threads are distributed evenly over all processors
+};
+
+/**
+ * Converts "none", "compact" or "scatter" into the strategy.
+ * @return NO_PINNING for unknown strings
+ */
+ThreadPinningStrategy convertStringToThreadPinningStrategy(std::string const& str);
+
+/**
+ * Binds every thread of the OpenMP thread team to one processor. The pinning
+ * persists as long as the OpenMP runtime reuses its threads, hence the
+ * function should be called once after omp_set_num_threads() and before the
+ * data is initialized (see MathLib::newFirstTouch()). Pinning is implemented
+ * for Linux only, on other systems the function does nothing.
+ * @return true if all threads could be pinned
+ */
+bool pinOpenMPThreads(ThreadPinningStrategy strategy);
+
+/**
+ * @return a description of the processor each OpenMP thread runs on at the
+ * moment, for instance "0->0 1->2 2->4 3->6"
+ */
+std::string getOpenMPThreadPlacement();
+
+} // end namespace BaseLib
+
+#endif /* THREADPINNING_H_ */
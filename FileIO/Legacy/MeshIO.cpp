@@ -13,6 +13,7 @@
 #include "GEOObjects.h"
 #include "MeshIO.h"
 #include "Node.h"
+#include "MeshArena.h"
 #include "Elements/Edge.h"
 #include "Elements/Tri.h"
 #include "Elements/Quad.h"
@@ -53,6 +54,8 @@ MeshLib::Mesh* MeshIO::loadMeshFromFile(const std::string& file_name)
 
 	if(line_string.find("#FEM_MSH") != std::string::npos) // OGS mesh file
 	{
+		// the nodes and elements are created in an arena that is owned by the mesh
+		MeshLib::MeshArena* arena (new MeshLib::MeshArena);
 		double edge_length[2] = { std::numeric_limits<double>::max(), std::numeric_limits<double>::min() };
 		while (!in.eof())
 		{
@@ -74,7 +77,7 @@ MeshLib::Mesh* MeshIO::loadMeshFromFile(const std::string& file_name)
 					getline(in, line_string);
 					std::stringstream iss(line_string);
 					iss >> idx >> x >> y >> z;
-					MeshLib::Node* node(new MeshLib::Node(x, y, z, idx));
+					MeshLib::Node* node(arena->createNode(x, y, z, idx));
 					nodes.push_back(node);
 					iss >> s;
 					if (s.find("$AREA") != std::string::npos)
@@ -91,7 +94,7 @@ MeshLib::Mesh* MeshIO::loadMeshFromFile(const std::string& file_name)
 					getline(in, line_string);
 
 					size_t elem_idx (elements.size());
-					elements.push_back(readElement(line_string, nodes));
+					elements.push_back(readElement(line_string, nodes, *arena));
 
 					double elem_min_length, elem_max_length;
 					elements[elem_idx]->computeSqrEdgeLengthRange(elem_min_length, elem_max_length);
@@ -102,12 +105,19 @@ MeshLib::Mesh* MeshIO::loadMeshFromFile(const std::string& file_name)
 		}
 
 
-		MeshLib::Mesh* mesh (new MeshLib::Mesh(BaseLib::getFileNameFromPath(file_name), nodes, elements));
+		MeshLib::Mesh* mesh (new MeshLib::Mesh(BaseLib::getFileNameFromPath(file_name), nodes, elements, arena));
 		mesh->setEdgeLengthRange(sqrt(edge_length[0]), sqrt(edge_length[1]));
 
+		// the mesh merges duplicate nodes, the pointers in nodes may be invalid now
 		std::cout << "finished." << std::endl;
-		std::cout << "Nr. Nodes: " << nodes.size() << std::endl;
-		std::cout << "Nr. Elements: " << elements.size() << std::endl;
+		std::cout << "Nr. Nodes: " << mesh->getNNodes();
+		if (mesh->getNNodes() < nodes.size())
+			std::cout << " (merged " << nodes.size() - mesh->getNNodes() << " duplicate nodes)";
+		std::cout << std::endl;
+		std::cout << "Nr. Elements: " << mesh->getNElements();
+		if (mesh->getNElements() < elements.size())
+			std::cout << " (removed " << elements.size() - mesh->getNElements() << " degenerated elements)";
+		std::cout << std::endl;
 
 		in.close();
 		return mesh;
@@ -119,7 +129,8 @@ MeshLib::Mesh* MeshIO::loadMeshFromFile(const std::string& file_name)
 	}
 }
 
-MeshLib::Element* MeshIO::readElement(const std::string& line, const std::vector<MeshLib::Node*> &nodes)
+MeshLib::Element* MeshIO::readElement(const std::string& line, const std::vector<MeshLib::Node*> &nodes,
+	MeshLib::MeshArena &arena)
 {
 	std::stringstream ss (line);
 	std::string elem_type_str;
@@ -127,52 +138,42 @@ MeshLib::Element* MeshIO::readElement(const std::string& line, const std::vector
 	ss >> index >> patch_index >> elem_type_str;
 
 	MshElemType::type elem_type (String2MshElemType(elem_type_str));
-	unsigned* idx = new unsigned[8];
-
-	MeshLib::Element* elem;
+	unsigned nNodes (0);
 
 	switch(elem_type)
 	{
 	case MshElemType::EDGE:
-		for (int i = 0; i < 2; i++)
-			ss >> idx[i];
-		elem = new MeshLib::Edge(nodes[idx[1]], nodes[idx[0]], patch_index);
+		nNodes = 2;
 		break;
 	case MshElemType::TRIANGLE:
-		for (int i = 0; i < 3; i++)
-			ss >> idx[i];
-		elem = new MeshLib::Tri(nodes[idx[2]], nodes[idx[1]], nodes[idx[0]], patch_index);
+		nNodes = 3;
 		break;
 	case MshElemType::QUAD:
-		for (int i = 0; i < 4; i++)
-			ss >> idx[i];
-		elem = new MeshLib::Quad(nodes[idx[3]], nodes[idx[2]], nodes[idx[1]], nodes[idx[0]], patch_index);
-		break;
 	case MshElemType::TETRAHEDRON:
-		for (int i = 0; i < 4; i++)
-			ss >> idx[i];
-		elem = new MeshLib::Tet(nodes[idx[3]], nodes[idx[2]], nodes[idx[1]], nodes[idx[0]], patch_index);
+		nNodes = 4;
 		break;
 	case MshElemType::HEXAHEDRON:
-		for (int i = 0; i < 8; i++)
-			ss >> idx[i];
-		elem = new MeshLib::Hex(nodes[idx[7]], nodes[idx[6]], nodes[idx[5]], nodes[idx[4]], nodes[idx[3]], nodes[idx[2]], nodes[idx[1]], nodes[idx[0]], patch_index);
+		nNodes = 8;
 		break;
 	case MshElemType::PYRAMID:
-		for (int i = 0; i < 5; i++)
-			ss >> idx[i];
-		elem = new MeshLib::Pyramid(nodes[idx[4]], nodes[idx[3]], nodes[idx[2]], nodes[idx[1]], nodes[idx[0]], patch_index);
+		nNodes = 5;
 		break;
 	case MshElemType::PRISM:
-		for (int i = 0; i < 6; i++)
-			ss >> idx[i];
-		elem = new MeshLib::Prism(nodes[idx[5]], nodes[idx[4]], nodes[idx[3]], nodes[idx[2]], nodes[idx[1]], nodes[idx[0]], patch_index);
+		nNodes = 6;
 		break;
 	default:
-		elem = NULL;
+		return NULL;
 	}
 
-	return elem;
+	unsigned idx[8];
+	for (unsigned i = 0; i < nNodes; i++)
+		ss >> idx[i];
+	// the file stores the nodes of the elements in reversed order
+	MeshLib::Node* elem_nodes[8];
+	for (unsigned i = 0; i < nNodes; i++)
+		elem_nodes[i] = nodes[idx[nNodes - 1 - i]];
+
+	return arena.createElement(elem_type, elem_nodes, nNodes, patch_index);
 }
 
 int MeshIO::write(std::ostream &out)
@@ -28,6 +28,7 @@ namespace MeshLib
 	class Mesh;
 	class Node;
 	class Element;
+	class MeshArena;
 }
 
 namespace FileIO
@@ -52,7 +53,8 @@ protected:
 
 private:
 	void writeElementsExceptLines(std::vector<MeshLib::Element*> const& ele_vec, std::ostream &out);
-	MeshLib::Element* readElement(const std::string& line, const std::vector<MeshLib::Node*> &nodes);
+	MeshLib::Element* readElement(const std::string& line, const std::vector<MeshLib::Node*> &nodes,
+		MeshLib::MeshArena &arena);
 
 	double* _edge_length[2];
 	const MeshLib::Mesh* _mesh;
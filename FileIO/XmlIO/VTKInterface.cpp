@@ -10,6 +10,7 @@
  */
 
 #include "VTKInterface.h"
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 
@@ -20,6 +21,7 @@
 // MSH
 #include "Mesh.h"
 #include "Node.h"
+#include "MeshArena.h"
 #include "Elements/Edge.h"
 #include "Elements/Tri.h"
 #include "Elements/Quad.h"
@@ -78,6 +80,8 @@ MeshLib::Mesh* VTKInterface::readVTUFile(const std::string &file_name)
 			const unsigned nElems = static_cast<unsigned>(atoi(piece_node->first_attribute("NumberOfCells")->value()));
 			std::vector<MeshLib::Node*> nodes(nNodes);
 			std::vector<MeshLib::Element*> elements(nElems);
+			// the nodes and elements are created in an arena that is owned by the mesh
+			MeshLib::MeshArena* arena (new MeshLib::MeshArena);
 			std::vector<unsigned> mat_ids(nElems, 0);
 			std::vector<unsigned> cell_types(nElems);
 
@@ -109,13 +113,14 @@ MeshLib::Mesh* VTKInterface::readVTUFile(const std::string &file_name)
 					for(unsigned i=0; i<nNodes; i++)
 					{
 						iss >> x >> y >> z;
-						nodes[i] = new MeshLib::Node(x,y,z,i);
+						nodes[i] = arena->createNode(x,y,z,i);
 					}
 				}
 			}
 			else
 			{
 				std::cout << "Error in VTKInterface::readVTUFile() - Points array not found." << std::endl;
+				delete arena;
 				return NULL;
 			}
 
@@ -142,16 +147,17 @@ MeshLib::Mesh* VTKInterface::readVTUFile(const std::string &file_name)
 				{
 					std::stringstream iss (connectivity_node->value());
 					for(unsigned i=0; i<nElems; i++)
-						elements[i] = readElement(iss, nodes, mat_ids[i], cell_types[i]);
+						elements[i] = readElement(iss, nodes, mat_ids[i], cell_types[i], *arena);
 				}
 			}
 			else
 			{
 				std::cout << "Error in VTKInterface::readVTUFile() - Cell data not found." << std::endl;
+				delete arena;
 				return NULL;
 			}
 
-			return new MeshLib::Mesh(BaseLib::getFileNameFromPath(file_name), nodes, elements);
+			return new MeshLib::Mesh(BaseLib::getFileNameFromPath(file_name), nodes, elements, arena);
 		}
 		else
 			std::cout << "Error in VTKInterface::readVTUFile() - Number of nodes and elements not specified." << std::endl;
@@ -159,56 +165,64 @@ MeshLib::Mesh* VTKInterface::readVTUFile(const std::string &file_name)
 	return NULL;
 }
 
-MeshLib::Element* VTKInterface::readElement(std::stringstream &iss, const std::vector<MeshLib::Node*> &nodes, unsigned material, unsigned type)
+MeshLib::Element* VTKInterface::readElement(std::stringstream &iss, const std::vector<MeshLib::Node*> &nodes, unsigned material, unsigned type,
+                                            MeshLib::MeshArena &arena)
 {
-	unsigned node_ids[8];
+	MshElemType::type elem_type;
+	unsigned nNodes;
 	switch (type)
 	{
 	case 3: //line
-		for (unsigned i(0); i<2; i++) iss >> node_ids[i];
-		return new MeshLib::Edge(nodes[node_ids[0]], nodes[node_ids[1]], material);
+		elem_type = MshElemType::EDGE;
+		nNodes = 2;
 		break;
 	case 5: //triangle
-		for (unsigned i(0); i<3; i++) iss >> node_ids[i];
-		return new MeshLib::Tri(nodes[node_ids[0]], nodes[node_ids[1]], nodes[node_ids[2]], material);
+		elem_type = MshElemType::TRIANGLE;
+		nNodes = 3;
 		break;
 	case 9: //quad
-		for (unsigned i(0); i<4; i++) iss >> node_ids[i];
-		return new MeshLib::Quad(nodes[node_ids[0]], nodes[node_ids[1]], nodes[node_ids[2]], nodes[node_ids[3]], material);
-		break;
 	case 8: //pixel
-		for (unsigned i(0); i<4; i++) iss >> node_ids[i];
-		return new MeshLib::Quad(nodes[node_ids[0]], nodes[node_ids[1]], nodes[node_ids[3]], nodes[node_ids[2]], material);
+		elem_type = MshElemType::QUAD;
+		nNodes = 4;
 		break;
 	case 10:
-		for (unsigned i(0); i<4; i++) iss >> node_ids[i];
-		return new MeshLib::Tet(nodes[node_ids[0]], nodes[node_ids[1]], nodes[node_ids[2]], nodes[node_ids[3]], material);
+		elem_type = MshElemType::TETRAHEDRON;
+		nNodes = 4;
 		break;
 	case 12: //hexahedron
-		for (unsigned i(0); i<8; i++) iss >> node_ids[i];
-		return new MeshLib::Hex(nodes[node_ids[0]], nodes[node_ids[1]], nodes[node_ids[2]], nodes[node_ids[3]],
-				                nodes[node_ids[4]], nodes[node_ids[5]], nodes[node_ids[6]], nodes[node_ids[7]], material);
-		break;
 	case 11: //voxel
-		for (unsigned i(0); i<8; i++) iss >> node_ids[i];
-		return new MeshLib::Hex(nodes[node_ids[0]], nodes[node_ids[1]], nodes[node_ids[3]], nodes[node_ids[2]],
-				                nodes[node_ids[4]], nodes[node_ids[5]], nodes[node_ids[7]], nodes[node_ids[6]], material);
+		elem_type = MshElemType::HEXAHEDRON;
+		nNodes = 8;
 		break;
 	case 14: //pyramid
-		for (unsigned i(0); i<5; i++) iss >> node_ids[i];
-		return new MeshLib::Pyramid(nodes[node_ids[0]], nodes[node_ids[1]], nodes[node_ids[2]],
-				                    nodes[node_ids[3]], nodes[node_ids[4]], material);
+		elem_type = MshElemType::PYRAMID;
+		nNodes = 5;
 		break;
 	case 13: //wedge
-		for (unsigned i(0); i<6; i++) iss >> node_ids[i];
-		return new MeshLib::Prism(nodes[node_ids[0]], nodes[node_ids[1]], nodes[node_ids[2]],
-				                    nodes[node_ids[3]], nodes[node_ids[4]], nodes[node_ids[5]], material);
+		elem_type = MshElemType::PRISM;
+		nNodes = 6;
 		break;
 	default:
 		std::cout << "Error in VTKInterface::readElement() - Unknown mesh element type \"" << type << "\" ..." << std::endl;
 		return NULL;
 	}
 
+	MeshLib::Node* elem_nodes[8];
+	unsigned node_id;
+	for (unsigned i(0); i<nNodes; i++)
+	{
+		iss >> node_id;
+		elem_nodes[i] = nodes[node_id];
+	}
+	// pixels and voxels number the nodes of the quadrilaterals lexicographically
+	if (type == 8 || type == 11)
+	{
+		std::swap(elem_nodes[2], elem_nodes[3]);
+		if (type == 11)
+			std::swap(elem_nodes[6], elem_nodes[7]);
+	}
+
+	return arena.createElement(elem_type, elem_nodes, nNodes, material);
 }
 
 bool VTKInterface::isVTKFile(const rapidxml::xml_node<>* vtk_root)
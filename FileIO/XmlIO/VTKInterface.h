@@ -26,6 +26,7 @@ namespace MeshLib {
 	class Mesh;
 	class Node;
 	class Element;
+	class MeshArena;
 }
 
 namespace FileIO
@@ -73,8 +74,9 @@ private:
 	/// Check if the file really specifies a VTK Unstructured Grid
 	static bool isVTKUnstructuredGrid(const rapidxml::xml_node<>* node);
 
-	/// Construct an Element-object from the data given to the method and the data at the current stream position.
-	static MeshLib::Element* readElement(std::stringstream &iss, const std::vector<MeshLib::Node*> &nodes, unsigned material, unsigned type);
+	/// Construct an Element-object in the arena from the data given to the method and the data at the current stream position.
+	static MeshLib::Element* readElement(std::stringstream &iss, const std::vector<MeshLib::Node*> &nodes, unsigned material, unsigned type,
+	                                     MeshLib::MeshArena &arena);
 
 	bool _use_compressor;
 };
@@ -13,6 +13,7 @@
 #ifndef GRID_H_
 #define GRID_H_
 
+#include <algorithm>
 #include <vector>
 
 // GeoLib
@@ -79,6 +80,25 @@ public:
 	 */
 	void getVecsOfGridCellsIntersectingCube(double const*const pnt, double half_len, std::vector<std::vector<POINT*> const*>& pnts) const;
 
+	/**
+	 * @return the number of grid cells
+	 */
+	size_t getNGridCells() const { return _n_steps[0] * _n_steps[1] * _n_steps[2]; }
+
+	/**
+	 * Method returns the points within the grid cell with the given index. The
+	 * grid cells are numbered lexicographically, i.e., the cell with the grid
+	 * coordinates (i,j,k) has the index i + j * n_x + k * n_x * n_y.
+	 * Together with getNGridCells() this allows to process the points
+	 * cell by cell, for instance to distribute the cells over threads.
+	 * @param cell_idx the index of the grid cell
+	 * @return the points within the grid cell
+	 */
+	std::vector<POINT*> const& getPointsInGridCell(size_t cell_idx) const
+	{
+		return _grid_quad_to_node_map[cell_idx];
+	}
+
 #ifndef NDEBUG
 	/**
 	 * Method creates a geometry for every mesh grid box. Additionally it
@@ -159,49 +179,44 @@ Grid<POINT>::Grid(std::vector<POINT*> const& pnts, size_t max_num_per_grid_cell)
 	}
 
 	// *** condition: n_pnts / (_n_steps[0] * _n_steps[1] * _n_steps[2]) < max_num_per_grid_cell
-	// *** with _n_steps[1] = _n_steps[0] * delta[1]/delta[0], _n_steps[2] = _n_steps[0] * delta[2]/delta[0]
-	if (fabs(delta[1]) < std::numeric_limits<double>::epsilon() ||
-					fabs(delta[2]) < std::numeric_limits<double>::epsilon()) {
-		// 1d case y = z = 0
-		if (fabs(delta[1]) < std::numeric_limits<double>::epsilon() &&
-						fabs(delta[2]) < std::numeric_limits<double>::epsilon()) {
-			_n_steps[0] = static_cast<size_t> (ceil(n_pnts / (double) max_num_per_grid_cell));
-			_n_steps[1] = 1;
-			_n_steps[2] = 1;
-		} else {
-			// 1d case x = z = 0
-			if (fabs(delta[0]) < std::numeric_limits<double>::epsilon() &&
-							fabs(delta[2]) < std::numeric_limits<double>::epsilon()) {
-				_n_steps[0] = 1;
-				_n_steps[1] = static_cast<size_t> (ceil(n_pnts / (double) max_num_per_grid_cell));
-				_n_steps[2] = 1;
-			} else {
-				// 1d case x = y = 0
-				if (fabs(delta[0]) < std::numeric_limits<double>::epsilon() && fabs(delta[1])
-								< std::numeric_limits<double>::epsilon()) {
-					_n_steps[0] = 1;
-					_n_steps[1] = 1;
-					_n_steps[2] = static_cast<size_t> (ceil(n_pnts / (double) max_num_per_grid_cell));
-				} else {
-					// 2d case
-					if (fabs(delta[1]) < std::numeric_limits<double>::epsilon()) {
-						_n_steps[0] = static_cast<size_t> (ceil(sqrt(n_pnts * delta[0] / (max_num_per_grid_cell * delta[2]))));
-						_n_steps[1] = 1;
-						_n_steps[2] = static_cast<size_t> (ceil(_n_steps[0] * delta[2] / delta[0]));
-					} else {
-						_n_steps[0] = static_cast<size_t> (ceil(sqrt(n_pnts * delta[0] / (max_num_per_grid_cell * delta[1]))));
-						_n_steps[1] = static_cast<size_t> (ceil(_n_steps[0] * delta[1] / delta[0]));
-						_n_steps[2] = 1;
-					}
-				}
+	// *** the cells are (nearly) cubes with edge length h, i.e. _n_steps[k] = delta[k] / h, where
+	// *** h^dim = (product of the used delta[k]) * max_num_per_grid_cell / n_pnts. Directions that
+	// *** are flat (delta[k] smaller than h, for instance a mesh in the plane x = const) get a
+	// *** single layer of cells and h is computed again from the remaining directions.
+	bool flat[3] = { false, false, false };
+	double h(0.0);
+	for (bool changed(true); changed; ) {
+		changed = false;
+		size_t dim(0);
+		double vol(1.0);
+		for (size_t k(0); k < 3; k++) {
+			if (!flat[k] && delta[k] >= std::numeric_limits<double>::epsilon()) {
+				dim++;
+				vol *= delta[k];
+			}
+		}
+		if (dim == 0 || n_pnts == 0) {
+			h = 0.0;
+			break;
+		}
+		h = pow(vol * max_num_per_grid_cell / n_pnts, 1.0 / dim);
+		for (size_t k(0); k < 3; k++) {
+			if (!flat[k] && delta[k] < h) {
+				flat[k] = true;
+				changed = true;
 			}
 		}
-	} else {
-		// 3d case
-		_n_steps[0] = static_cast<size_t> (ceil(pow(n_pnts * delta[0] * delta[0]
-						/ (max_num_per_grid_cell * delta[1] * delta[2]), 1. / 3.)));
-		_n_steps[1] = static_cast<size_t> (ceil(_n_steps[0] * delta[1] / delta[0]));
-		_n_steps[2] = static_cast<size_t> (ceil(_n_steps[0] * delta[2] / delta[0]));
+	}
+	for (size_t k(0); k < 3; k++) {
+		if (h > 0.0 && !flat[k] && delta[k] >= std::numeric_limits<double>::epsilon())
+			_n_steps[k] = static_cast<size_t> (ceil(delta[k] / h));
+		else
+			_n_steps[k] = 1;
+	}
+
+	for (size_t k(0); k < 3; k++) {
+		if (_n_steps[k] == 0)
+			_n_steps[k] = 1;
 	}
 
 	const size_t n_plane(_n_steps[0] * _n_steps[1]);
@@ -210,21 +225,15 @@ Grid<POINT>::Grid(std::vector<POINT*> const& pnts, size_t max_num_per_grid_cell)
 	// some frequently used expressions to fill the grid vectors
 	for (size_t k(0); k < 3; k++) {
 		_step_sizes[k] = delta[k] / _n_steps[k];
-		_inverse_step_sizes[k] = 1.0 / _step_sizes[k];
+		// in a flat direction (delta[k] == 0) all points are in the first layer
+		_inverse_step_sizes[k] = (_step_sizes[k] > 0.0) ? 1.0 / _step_sizes[k] : 0.0;
 	}
 
 	// fill the grid vectors
 	for (size_t l(0); l < n_pnts; l++) {
-		double const* const pnt(pnts[l]->getCoords());
-		const size_t i(static_cast<size_t> ((pnt[0] - _min_pnt[0]) * _inverse_step_sizes[0]));
-		const size_t j(static_cast<size_t> ((pnt[1] - _min_pnt[1]) * _inverse_step_sizes[1]));
-		const size_t k(static_cast<size_t> ((pnt[2] - _min_pnt[2]) * _inverse_step_sizes[2]));
-
-		if (i >= _n_steps[0] || j >= _n_steps[1] || k >= _n_steps[2]) {
-			std::cout << "error computing indices " << std::endl;
-		}
-
-		_grid_quad_to_node_map[i + j * _n_steps[0] + k * n_plane].push_back(pnts[l]);
+		size_t coords[3];
+		getGridCoords(pnts[l]->getCoords(), coords);
+		_grid_quad_to_node_map[coords[0] + coords[1] * _n_steps[0] + coords[2] * n_plane].push_back(pnts[l]);
 	}
 
 #ifndef NDEBUG
@@ -430,7 +439,8 @@ void Grid<POINT>::getGridCoords(double const*const pnt, size_t* coords) const
 			if (pnt[k] > _max_pnt[k]) {
 				coords[k] = _n_steps[k]-1;
 			} else {
-				coords[k] = static_cast<size_t>((pnt[k]-_min_pnt[k]) * _inverse_step_sizes[k]);
+				coords[k] = std::min(static_cast<size_t>((pnt[k]-_min_pnt[k]) * _inverse_step_sizes[k]),
+				                     _n_steps[k]-1);
 			}
 		}
 	}
@@ -0,0 +1,585 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file FixedMatrix.h
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#ifndef FIXEDMATRIX_H_
+#define FIXEDMATRIX_H_
+
+#include <cstddef>
+#include <cmath>
+#include <cassert>
+#include <iostream>
+
+namespace MathLib {
+
+/**
+ * FixedMatrix represents a small dense matrix whose dimensions are known at
+ * compile time (for instance element matrices). In contrast to class Matrix
+ * the entries are stored in place (on the stack for local objects) and all
+ * loops have compile time trip counts, i.e. they are completely unrolled by
+ * the compiler for small sizes. The entries are stored row wise.
+ */
+template <typename T, std::size_t R, std::size_t C>
+class FixedMatrix
+{
+public:
+	/** the dimensions as compile time constants */
+	enum { N_ROWS = R, N_COLS = C, N_ENTRIES = R * C };
+
+	/** constructs a matrix with uninitialized entries */
+	FixedMatrix() {}
+
+	/** constructs a matrix and sets all entries to val */
+	explicit FixedMatrix(T const& val)
+	{
+		for (std::size_t k(0); k < R * C; k++)
+			_data[k] = val;
+	}
+
+	/** constructs a matrix from an array of R*C entries (row wise) */
+	explicit FixedMatrix(T const*const values)
+	{
+		for (std::size_t k(0); k < R * C; k++)
+			_data[k] = values[k];
+	}
+
+	static std::size_t getNRows() { return R; }
+	static std::size_t getNCols() { return C; }
+
+	T& operator() (std::size_t row, std::size_t col)
+	{
+		assert(row < R && col < C);
+		return _data[row * C + col];
+	}
+
+	T const& operator() (std::size_t row, std::size_t col) const
+	{
+		assert(row < R && col < C);
+		return _data[row * C + col];
+	}
+
+	/** get access to the entries (stored row wise) */
+	T* getEntryArray() { return _data; }
+	T const* getEntryArray() const { return _data; }
+
+	void setZero()
+	{
+		for (std::size_t k(0); k < R * C; k++)
+			_data[k] = T(0);
+	}
+
+	void setIdentity()
+	{
+		for (std::size_t i(0); i < R; i++)
+			for (std::size_t j(0); j < C; j++)
+				_data[i * C + j] = (i == j) ? T(1) : T(0);
+	}
+
+	FixedMatrix& operator+= (FixedMatrix const& mat)
+	{
+		for (std::size_t k(0); k < R * C; k++)
+			_data[k] += mat._data[k];
+		return *this;
+	}
+
+	FixedMatrix& operator-= (FixedMatrix const& mat)
+	{
+		for (std::size_t k(0); k < R * C; k++)
+			_data[k] -= mat._data[k];
+		return *this;
+	}
+
+	FixedMatrix& operator*= (T const& a)
+	{
+		for (std::size_t k(0); k < R * C; k++)
+			_data[k] *= a;
+		return *this;
+	}
+
+	FixedMatrix operator+ (FixedMatrix const& mat) const
+	{
+		FixedMatrix res(*this);
+		res += mat;
+		return res;
+	}
+
+	FixedMatrix operator- (FixedMatrix const& mat) const
+	{
+		FixedMatrix res(*this);
+		res -= mat;
+		return res;
+	}
+
+	/**
+	 * matrix matrix multiplication \f$ A \cdot B\f$
+	 * @param mat the matrix \f$ B \f$
+	 * @return the product
+	 */
+	template <std::size_t C2>
+	FixedMatrix<T, R, C2> operator* (FixedMatrix<T, C, C2> const& mat) const
+	{
+		FixedMatrix<T, R, C2> res;
+		multiply(mat, res);
+		return res;
+	}
+
+	/**
+	 * matrix matrix multiplication \f$ C = A \cdot B\f$ without temporary object
+	 * @param mat the matrix \f$ B \f$
+	 * @param res the matrix \f$ C \f$
+	 */
+	template <std::size_t C2>
+	void multiply (FixedMatrix<T, C, C2> const& mat, FixedMatrix<T, R, C2> &res) const
+	{
+		T const*const b(mat.getEntryArray());
+		T* c(res.getEntryArray());
+		for (std::size_t i(0); i < R; i++) {
+			for (std::size_t j(0); j < C2; j++)
+				c[i * C2 + j] = _data[i * C] * b[j];
+			for (std::size_t k(1); k < C; k++) {
+				const T a(_data[i * C + k]);
+				for (std::size_t j(0); j < C2; j++)
+					c[i * C2 + j] += a * b[k * C2 + j];
+			}
+		}
+	}
+
+	/**
+	 * Computes \f$ C = C + \alpha A^T \cdot B\f$, for instance for the
+	 * assembly of element matrices \f$ K = K + w B^T D B\f$.
+	 * @param alpha scalar factor
+	 * @param mat the matrix \f$ B \f$
+	 * @param res the matrix \f$ C \f$
+	 */
+	template <std::size_t C2>
+	void addTransposedProduct (T const& alpha, FixedMatrix<T, R, C2> const& mat,
+			FixedMatrix<T, C, C2> &res) const
+	{
+		T const*const b(mat.getEntryArray());
+		T* c(res.getEntryArray());
+		for (std::size_t k(0); k < R; k++) {
+			for (std::size_t i(0); i < C; i++) {
+				const T a(alpha * _data[k * C + i]);
+				for (std::size_t j(0); j < C2; j++)
+					c[i * C2 + j] += a * b[k * C2 + j];
+			}
+		}
+	}
+
+	/**
+	 * matrix vector multiplication \f$ y = \alpha A x\f$
+	 * @param alpha scalar factor
+	 * @param x vector of length C
+	 * @param y vector of length R
+	 */
+	void amux (T const& alpha, T const*const x, T* y) const
+	{
+		for (std::size_t i(0); i < R; i++) {
+			T t(0);
+			for (std::size_t j(0); j < C; j++)
+				t += _data[i * C + j] * x[j];
+			y[i] = alpha * t;
+		}
+	}
+
+	FixedMatrix<T, C, R> transpose() const
+	{
+		FixedMatrix<T, C, R> res;
+		for (std::size_t i(0); i < R; i++)
+			for (std::size_t j(0); j < C; j++)
+				res(j, i) = _data[i * C + j];
+		return res;
+	}
+
+	/**
+	 * writes the matrix entries into the output stream
+	 * @param out the output stream
+	 */
+	void write (std::ostream& out) const
+	{
+		for (std::size_t i(0); i < R; i++) {
+			for (std::size_t j(0); j < C; j++)
+				out << _data[i * C + j] << "\t";
+			out << std::endl;
+		}
+	}
+
+private:
+	T _data[R * C];
+};
+
+/**
+ * Helper for the computation of determinants and inverses of fixed size
+ * matrices. The general version uses a LU decomposition with partial pivoting,
+ * the specializations for N = 1, 2, 3 use the explicit formulas.
+ */
+template <typename T, std::size_t N>
+struct FixedMatrixInverse
+{
+	static T determinant(FixedMatrix<T, N, N> const& mat)
+	{
+		FixedMatrix<T, N, N> lu(mat);
+		T det(1);
+		for (std::size_t k(0); k < N; k++) {
+			std::size_t p(k);
+			for (std::size_t i(k + 1); i < N; i++)
+				if (std::fabs(lu(i, k)) > std::fabs(lu(p, k)))
+					p = i;
+			if (lu(p, k) == T(0))
+				return T(0);
+			if (p != k) {
+				for (std::size_t j(0); j < N; j++) {
+					const T t(lu(k, j));
+					lu(k, j) = lu(p, j);
+					lu(p, j) = t;
+				}
+				det = -det;
+			}
+			det *= lu(k, k);
+			for (std::size_t i(k + 1); i < N; i++) {
+				const T l(lu(i, k) / lu(k, k));
+				for (std::size_t j(k + 1); j < N; j++)
+					lu(i, j) -= l * lu(k, j);
+			}
+		}
+		return det;
+	}
+
+	static bool invert(FixedMatrix<T, N, N> const& mat, FixedMatrix<T, N, N> &inv)
+	{
+		// Gauss-Jordan elimination with partial pivoting
+		FixedMatrix<T, N, N> a(mat);
+		inv.setIdentity();
+		for (std::size_t k(0); k < N; k++) {
+			std::size_t p(k);
+			for (std::size_t i(k + 1); i < N; i++)
+				if (std::fabs(a(i, k)) > std::fabs(a(p, k)))
+					p = i;
+			if (a(p, k) == T(0))
+				return false;
+			if (p != k) {
+				for (std::size_t j(0); j < N; j++) {
+					T t(a(k, j)); a(k, j) = a(p, j); a(p, j) = t;
+					t = inv(k, j); inv(k, j) = inv(p, j); inv(p, j) = t;
+				}
+			}
+			const T d(T(1) / a(k, k));
+			for (std::size_t j(0); j < N; j++) {
+				a(k, j) *= d;
+				inv(k, j) *= d;
+			}
+			for (std::size_t i(0); i < N; i++) {
+				if (i == k)
+					continue;
+				const T l(a(i, k));
+				for (std::size_t j(0); j < N; j++) {
+					a(i, j) -= l * a(k, j);
+					inv(i, j) -= l * inv(k, j);
+				}
+			}
+		}
+		return true;
+	}
+};
+
+template <typename T>
+struct FixedMatrixInverse<T, 1>
+{
+	static T determinant(FixedMatrix<T, 1, 1> const& mat)
+	{
+		return mat(0, 0);
+	}
+
+	static bool invert(FixedMatrix<T, 1, 1> const& mat, FixedMatrix<T, 1, 1> &inv)
+	{
+		if (mat(0, 0) == T(0))
+			return false;
+		inv(0, 0) = T(1) / mat(0, 0);
+		return true;
+	}
+};
+
+template <typename T>
+struct FixedMatrixInverse<T, 2>
+{
+	static T determinant(FixedMatrix<T, 2, 2> const& mat)
+	{
+		return mat(0, 0) * mat(1, 1) - mat(0, 1) * mat(1, 0);
+	}
+
+	static bool invert(FixedMatrix<T, 2, 2> const& mat, FixedMatrix<T, 2, 2> &inv)
+	{
+		const T det(determinant(mat));
+		if (det == T(0))
+			return false;
+		const T d(T(1) / det);
+		// mat is read completely before inv is written, i.e. mat and inv may alias
+		const T a00(mat(0, 0)), a01(mat(0, 1)), a10(mat(1, 0)), a11(mat(1, 1));
+		inv(0, 0) = a11 * d;
+		inv(0, 1) = -a01 * d;
+		inv(1, 0) = -a10 * d;
+		inv(1, 1) = a00 * d;
+		return true;
+	}
+};
+
+template <typename T>
+struct FixedMatrixInverse<T, 3>
+{
+	static T determinant(FixedMatrix<T, 3, 3> const& m)
+	{
+		return m(0, 0) * (m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1))
+			- m(0, 1) * (m(1, 0) * m(2, 2) - m(1, 2) * m(2, 0))
+			+ m(0, 2) * (m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0));
+	}
+
+	static bool invert(FixedMatrix<T, 3, 3> const& m, FixedMatrix<T, 3, 3> &inv)
+	{
+		const T det(determinant(m));
+		if (det == T(0))
+			return false;
+		const T d(T(1) / det);
+		// compute into a temporary, i.e. m and inv may alias
+		FixedMatrix<T, 3, 3> res;
+		res(0, 0) = (m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1)) * d;
+		res(0, 1) = (m(0, 2) * m(2, 1) - m(0, 1) * m(2, 2)) * d;
+		res(0, 2) = (m(0, 1) * m(1, 2) - m(0, 2) * m(1, 1)) * d;
+		res(1, 0) = (m(1, 2) * m(2, 0) - m(1, 0) * m(2, 2)) * d;
+		res(1, 1) = (m(0, 0) * m(2, 2) - m(0, 2) * m(2, 0)) * d;
+		res(1, 2) = (m(0, 2) * m(1, 0) - m(0, 0) * m(1, 2)) * d;
+		res(2, 0) = (m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0)) * d;
+		res(2, 1) = (m(0, 1) * m(2, 0) - m(0, 0) * m(2, 1)) * d;
+		res(2, 2) = (m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0)) * d;
+		inv = res;
+		return true;
+	}
+};
+
+/**
+ * computes the determinant of a square fixed size matrix
+ */
+template <typename T, std::size_t N>
+T determinant(FixedMatrix<T, N, N> const& mat)
+{
+	return FixedMatrixInverse<T, N>::determinant(mat);
+}
+
+/**
+ * computes the inverse of a square fixed size matrix, mat and inv may be the
+ * same object (invert(A, A) inverts A in place)
+ * @param mat the matrix
+ * @param inv the inverse
+ * @return false if the matrix is singular
+ */
+template <typename T, std::size_t N>
+bool invert(FixedMatrix<T, N, N> const& mat, FixedMatrix<T, N, N> &inv)
+{
+	return FixedMatrixInverse<T, N>::invert(mat, inv);
+}
+
+/** overload the output operator for class FixedMatrix */
+template <typename T, std::size_t R, std::size_t C>
+std::ostream& operator<< (std::ostream &os, FixedMatrix<T, R, C> const& mat)
+{
+	mat.write (os);
+	return os;
+}
+
+/**
+ * FixedMatrixBatch stores many matrices of the same (fixed) size, for
+ * instance the Jacobians or the stiffness matrices of all elements of a mesh,
+ * in structure of arrays (SoA) layout: the entry (i,j) of all matrices is
+ * stored contiguously. The batched operations below loop over the matrices in
+ * the innermost loop, such that the compiler can vectorize across matrices.
+ */
+template <typename T, std::size_t R, std::size_t C>
+class FixedMatrixBatch
+{
+public:
+	/**
+	 * @param n_matrices the number of matrices in the batch
+	 */
+	explicit FixedMatrixBatch(std::size_t n_matrices) :
+		_n(n_matrices), _data(new T[R * C * n_matrices])
+	{}
+
+	~FixedMatrixBatch()
+	{
+		delete [] _data;
+	}
+
+	/** @return the number of matrices in the batch */
+	std::size_t size() const { return _n; }
+
+	/** access to entry (i,j) of matrix e */
+	T& operator() (std::size_t e, std::size_t i, std::size_t j)
+	{
+		assert(e < _n && i < R && j < C);
+		return _data[(i * C + j) * _n + e];
+	}
+
+	T const& operator() (std::size_t e, std::size_t i, std::size_t j) const
+	{
+		assert(e < _n && i < R && j < C);
+		return _data[(i * C + j) * _n + e];
+	}
+
+	/** @return pointer to the entries (i,j) of all matrices */
+	T* getEntries(std::size_t i, std::size_t j) { return _data + (i * C + j) * _n; }
+	T const* getEntries(std::size_t i, std::size_t j) const { return _data + (i * C + j) * _n; }
+
+	/** copies the matrix mat into the batch at position e */
+	void set(std::size_t e, FixedMatrix<T, R, C> const& mat)
+	{
+		for (std::size_t k(0); k < R * C; k++)
+			_data[k * _n + e] = mat.getEntryArray()[k];
+	}
+
+	/** copies the matrix at position e of the batch into mat */
+	void get(std::size_t e, FixedMatrix<T, R, C> &mat) const
+	{
+		for (std::size_t k(0); k < R * C; k++)
+			mat.getEntryArray()[k] = _data[k * _n + e];
+	}
+
+	void setZero()
+	{
+		for (std::size_t k(0); k < R * C * _n; k++)
+			_data[k] = T(0);
+	}
+
+private:
+	// the batch should not be copied
+	FixedMatrixBatch(FixedMatrixBatch const&);
+	FixedMatrixBatch& operator=(FixedMatrixBatch const&);
+
+	const std::size_t _n;
+	T* _data;
+};
+
+/**
+ * batched matrix matrix multiplication \f$ C_e = A_e B_e\f$ for all matrices
+ * of the batches
+ */
+template <typename T, std::size_t R, std::size_t K, std::size_t C>
+void multiply(FixedMatrixBatch<T, R, K> const& A, FixedMatrixBatch<T, K, C> const& B,
+		FixedMatrixBatch<T, R, C> &res)
+{
+	const std::size_t n(res.size());
+	assert(A.size() == n && B.size() == n);
+	for (std::size_t i(0); i < R; i++) {
+		for (std::size_t j(0); j < C; j++) {
+			T* __restrict__ c(res.getEntries(i, j));
+			{
+				T const*const __restrict__ a(A.getEntries(i, 0));
+				T const*const __restrict__ b(B.getEntries(0, j));
+				for (std::size_t e(0); e < n; e++)
+					c[e] = a[e] * b[e];
+			}
+			for (std::size_t k(1); k < K; k++) {
+				T const*const __restrict__ a(A.getEntries(i, k));
+				T const*const __restrict__ b(B.getEntries(k, j));
+				for (std::size_t e(0); e < n; e++)
+					c[e] += a[e] * b[e];
+			}
+		}
+	}
+}
+
+/**
+ * batched computation of \f$ C_e = C_e + w_e A_e^T B_e\f$ for all matrices of
+ * the batches (for instance \f$ K_e = K_e + w_e B_e^T (D B_e)\f$)
+ * @param w weights, one for every matrix of the batch
+ */
+template <typename T, std::size_t K, std::size_t R, std::size_t C>
+void addTransposedProduct(T const*const w, FixedMatrixBatch<T, K, R> const& A,
+		FixedMatrixBatch<T, K, C> const& B, FixedMatrixBatch<T, R, C> &res)
+{
+	const std::size_t n(res.size());
+	assert(A.size() == n && B.size() == n);
+	for (std::size_t i(0); i < R; i++) {
+		for (std::size_t j(0); j < C; j++) {
+			T* __restrict__ c(res.getEntries(i, j));
+			for (std::size_t k(0); k < K; k++) {
+				T const*const __restrict__ a(A.getEntries(k, i));
+				T const*const __restrict__ b(B.getEntries(k, j));
+				for (std::size_t e(0); e < n; e++)
+					c[e] += w[e] * a[e] * b[e];
+			}
+		}
+	}
+}
+
+/**
+ * batched computation of the determinants and inverses of 2x2 matrices
+ * (for instance Jacobians of 2d elements), A and inv may be the same batch
+ * @param det array for the determinants
+ */
+template <typename T>
+void invert(FixedMatrixBatch<T, 2, 2> const& A, FixedMatrixBatch<T, 2, 2> &inv, T* det)
+{
+	const std::size_t n(A.size());
+	T const*const a00(A.getEntries(0, 0)); T const*const a01(A.getEntries(0, 1));
+	T const*const a10(A.getEntries(1, 0)); T const*const a11(A.getEntries(1, 1));
+	T* i00(inv.getEntries(0, 0)); T* i01(inv.getEntries(0, 1));
+	T* i10(inv.getEntries(1, 0)); T* i11(inv.getEntries(1, 1));
+	for (std::size_t e(0); e < n; e++) {
+		const T b00(a00[e]), b01(a01[e]), b10(a10[e]), b11(a11[e]);
+		const T d(b00 * b11 - b01 * b10);
+		const T d_inv(T(1) / d);
+		det[e] = d;
+		i00[e] = b11 * d_inv;
+		i01[e] = -b01 * d_inv;
+		i10[e] = -b10 * d_inv;
+		i11[e] = b00 * d_inv;
+	}
+}
+
+/**
+ * batched computation of the determinants and inverses of 3x3 matrices
+ * (for instance Jacobians of 3d elements), A and inv may be the same batch
+ * @param det array for the determinants
+ */
+template <typename T>
+void invert(FixedMatrixBatch<T, 3, 3> const& A, FixedMatrixBatch<T, 3, 3> &inv, T* det)
+{
+	const std::size_t n(A.size());
+	T const*const m00(A.getEntries(0, 0)); T const*const m01(A.getEntries(0, 1)); T const*const m02(A.getEntries(0, 2));
+	T const*const m10(A.getEntries(1, 0)); T const*const m11(A.getEntries(1, 1)); T const*const m12(A.getEntries(1, 2));
+	T const*const m20(A.getEntries(2, 0)); T const*const m21(A.getEntries(2, 1)); T const*const m22(A.getEntries(2, 2));
+	T* i00(inv.getEntries(0, 0)); T* i01(inv.getEntries(0, 1)); T* i02(inv.getEntries(0, 2));
+	T* i10(inv.getEntries(1, 0)); T* i11(inv.getEntries(1, 1)); T* i12(inv.getEntries(1, 2));
+	T* i20(inv.getEntries(2, 0)); T* i21(inv.getEntries(2, 1)); T* i22(inv.getEntries(2, 2));
+	for (std::size_t e(0); e < n; e++) {
+		const T b00(m00[e]), b01(m01[e]), b02(m02[e]);
+		const T b10(m10[e]), b11(m11[e]), b12(m12[e]);
+		const T b20(m20[e]), b21(m21[e]), b22(m22[e]);
+		const T c00(b11 * b22 - b12 * b21);
+		const T c01(b12 * b20 - b10 * b22);
+		const T c02(b10 * b21 - b11 * b20);
+		const T d(b00 * c00 + b01 * c01 + b02 * c02);
+		const T d_inv(T(1) / d);
+		det[e] = d;
+		i00[e] = c00 * d_inv;
+		i01[e] = (b02 * b21 - b01 * b22) * d_inv;
+		i02[e] = (b01 * b12 - b02 * b11) * d_inv;
+		i10[e] = c01 * d_inv;
+		i11[e] = (b00 * b22 - b02 * b20) * d_inv;
+		i12[e] = (b02 * b10 - b00 * b12) * d_inv;
+		i20[e] = c02 * d_inv;
+		i21[e] = (b01 * b20 - b00 * b21) * d_inv;
+		i22[e] = (b00 * b11 - b01 * b10) * d_inv;
+	}
+}
+
+} // end namespace MathLib
+
+#endif /* FIXEDMATRIX_H_ */
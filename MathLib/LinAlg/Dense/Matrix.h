@@ -18,6 +18,8 @@
 #include <stdexcept>
 #include <iostream>
 
+#include "denseKernels.h"
+
 namespace MathLib {
 
 /**
@@ -39,6 +41,15 @@ public:
     */
    void axpy ( T alpha, const T* x, T beta, T* y) const;
 
+   /**
+    * Matrix vector multiplication \f$ y = \alpha \cdot A x\f$ without
+    * allocating memory for the result.
+    * @param alpha scalar factor
+    * @param x vector of length getNCols()
+    * @param y vector of length getNRows(), is overwritten
+    */
+   void amux ( T alpha, const T* x, T* y) const;
+
    /**
     * Matrix vector multiplication
     * @param x
@@ -65,12 +76,49 @@ public:
     */
    Matrix<T>* operator* (const Matrix<T>& mat) const throw (std::range_error);
 
+   /**
+    * Matrix matrix addition \f$ C = A + B\f$ without allocating memory.
+    * @param mat the matrix \f$ B \f$
+    * @param result the matrix \f$ C \f$ (has to be allocated by the caller)
+    */
+   void add (const Matrix<T>& mat, Matrix<T>& result) const throw (std::range_error);
+
+   /**
+    * Matrix matrix subtraction \f$ C = A - B\f$ without allocating memory.
+    * @param mat the matrix \f$ B \f$
+    * @param result the matrix \f$ C \f$ (has to be allocated by the caller)
+    */
+   void subtract (const Matrix<T>& mat, Matrix<T>& result) const throw (std::range_error);
+
+   /**
+    * Matrix matrix multiplication \f$ C = A \cdot B\f$ without allocating
+    * memory. The multiplication is cache blocked (see gemm()).
+    * @param mat the matrix \f$ B \f$
+    * @param result the matrix \f$ C \f$ (has to be allocated by the caller)
+    */
+   void multiply (const Matrix<T>& mat, Matrix<T>& result) const throw (std::range_error);
+
+   /**
+    * General matrix matrix multiplication \f$ C = \alpha A \cdot B + \beta C\f$.
+    * @param alpha scalar factor
+    * @param mat the matrix \f$ B \f$
+    * @param beta scalar factor
+    * @param result the matrix \f$ C \f$
+    */
+   void gemm (T alpha, const Matrix<T>& mat, T beta, Matrix<T>& result) const throw (std::range_error);
+
    /**
     * matrix transpose
     * @return the transpose of the matrix
     */
    Matrix<T>* transpose() const; // HB & ZC
 
+   /**
+    * matrix transpose without allocating memory
+    * @param result the transposed matrix (has to be allocated by the caller)
+    */
+   void transpose(Matrix<T>& result) const throw (std::range_error);
+
    Matrix<T>* getSubMatrix (size_t b_row, size_t b_col, size_t e_row, size_t e_col) const throw (std::range_error);
 
    /**
@@ -92,6 +140,13 @@ public:
 
    T const* getCoords () { return data; }
 
+   /**
+    * get access to the entries of the matrix (stored row wise)
+    * @return the entry array
+    */
+   T* getEntryArray () { return data; }
+   T const* getEntryArray () const { return data; }
+
 private:
    // zero based addressing, but Fortran storage layout
    //inline size_t address(size_t i, size_t j) const { return j*rows+i; };
@@ -107,12 +162,21 @@ template<class T> Matrix<T>::Matrix (size_t rows, size_t cols)
       : nrows (rows), ncols (cols), data (new T[nrows*ncols])
 {}
 
+template<class T> Matrix<T>::Matrix (size_t rows, size_t cols, const T& val)
+      : nrows (rows), ncols (cols), data (new T[nrows*ncols])
+{
+   const size_t n (nrows * ncols);
+   for (size_t k = 0; k < n; k++)
+      data[k] = val;
+}
+
 template<class T> Matrix<T>::Matrix (const Matrix& src) :
 	nrows (src.getNRows ()), ncols (src.getNCols ()), data (new T[nrows * ncols])
 {
-   for (size_t i = 0; i < nrows; i++)
-      for (size_t j = 0; j < ncols; j++)
-         data[address(i,j)] = src (i, j);
+   T const*const src_data (src.getEntryArray());
+   const size_t n (nrows * ncols);
+   for (size_t k = 0; k < n; k++)
+      data[k] = src_data[k];
 }
 
 template <class T> Matrix<T>::~Matrix ()
@@ -122,58 +186,44 @@ template <class T> Matrix<T>::~Matrix ()
 
 template<class T> void Matrix<T>::axpy ( T alpha, const T* x, T beta, T* y) const
 {
-   for (size_t i(0); i<nrows; i++) {
-      y[i] += beta * y[i];
-      for (size_t j(0); j<ncols; j++) {
-         y[i] += alpha * data[address(i,j)] * x[j];
-      }
-   }
+   MathLib::gemv (nrows, ncols, alpha, data, ncols, x, beta, y);
+}
+
+template<class T> void Matrix<T>::amux ( T alpha, const T* x, T* y) const
+{
+   MathLib::gemv (nrows, ncols, alpha, data, ncols, x, T(0), y);
 }
 
 template<class T> T* Matrix<T>::operator* (const T *x) const
 {
 	T *y (new T[nrows]);
-	for (size_t i(0); i < nrows; i++) {
-		y[i] = 0.0;
-		for (size_t j(0); j < ncols; j++) {
-			y[i] += data[address(i, j)] * x[j];
-		}
-	}
-
+	amux (T(1), x, y);
 	return y;
 }
 
 // HS initial implementation
 template<class T> Matrix<T>* Matrix<T>::operator+ (const Matrix<T>& mat) const throw (std::range_error)
 {
-	// make sure the two matrices have the same dimension.
-	if (nrows != mat.getNRows() || ncols != mat.getNCols())
-		throw std::range_error("Matrix::operator+, illegal matrix size!");
-
 	Matrix<T>* y(new Matrix<T> (nrows, ncols));
-	for (size_t i = 0; i < nrows; i++) {
-		for (size_t j = 0; j < ncols; j++) {
-			(*y)(i, j) = data[address(i, j)] + mat(i, j);
-		}
+	try {
+		add (mat, *y);
+	} catch (std::range_error &e) {
+		delete y;
+		throw std::range_error("Matrix::operator+, illegal matrix size!");
 	}
-
 	return y;
 }
 
 // HS initial implementation
 template<class T> Matrix<T>* Matrix<T>::operator- (const Matrix<T>& mat) const throw (std::range_error)
 {
-	// make sure the two matrices have the same dimension.
-	if (nrows != mat.getNRows() || ncols != mat.getNCols())
-		throw std::range_error("Matrix::operator-, illegal matrix size!");
-
 	Matrix<T>* y(new Matrix<T> (nrows, ncols));
-	for (size_t i = 0; i < nrows; i++) {
-		for (size_t j = 0; j < ncols; j++) {
-			(*y)(i, j) = data[address(i, j)] - mat(i, j);
-		}
+	try {
+		subtract (mat, *y);
+	} catch (std::range_error &e) {
+		delete y;
+		throw std::range_error("Matrix::operator-, illegal matrix size!");
 	}
-
 	return y;
 }
 
@@ -185,31 +235,90 @@ template<class T> Matrix<T>* Matrix<T>::operator* (const Matrix<T>& mat) const t
 		throw std::range_error(
 				"Matrix::operator*, number of rows and cols should be the same!");
 
-	size_t y_cols(mat.getNCols());
-	Matrix<T>* y(new Matrix<T> (nrows, y_cols, T(0)));
+	Matrix<T>* y(new Matrix<T> (nrows, mat.getNCols()));
+	multiply (mat, *y);
+	return y;
+}
 
-	for (size_t i = 0; i < nrows; i++) {
-		for (size_t j = 0; j < y_cols; j++) {
-			for (size_t k = 0; k < ncols; k++)
-				(*y)(i, j) += data[address(i, k)] * mat(k, j);
-		}
+template<class T> void Matrix<T>::add (const Matrix<T>& mat, Matrix<T>& result) const throw (std::range_error)
+{
+	if (nrows != mat.getNRows() || ncols != mat.getNCols()
+			|| nrows != result.getNRows() || ncols != result.getNCols())
+		throw std::range_error("Matrix::add, illegal matrix size!");
+
+	T const*const b (mat.getEntryArray());
+	T* c (result.getEntryArray());
+	const size_t n (nrows * ncols);
+	for (size_t k = 0; k < n; k++)
+		c[k] = data[k] + b[k];
+}
+
+template<class T> void Matrix<T>::subtract (const Matrix<T>& mat, Matrix<T>& result) const throw (std::range_error)
+{
+	if (nrows != mat.getNRows() || ncols != mat.getNCols()
+			|| nrows != result.getNRows() || ncols != result.getNCols())
+		throw std::range_error("Matrix::subtract, illegal matrix size!");
+
+	T const*const b (mat.getEntryArray());
+	T* c (result.getEntryArray());
+	const size_t n (nrows * ncols);
+	for (size_t k = 0; k < n; k++)
+		c[k] = data[k] - b[k];
+}
+
+template<class T> void Matrix<T>::multiply (const Matrix<T>& mat, Matrix<T>& result) const throw (std::range_error)
+{
+	gemm (T(1), mat, T(0), result);
+}
+
+template<class T> void Matrix<T>::gemm (T alpha, const Matrix<T>& mat, T beta, Matrix<T>& result) const throw (std::range_error)
+{
+	if (ncols != mat.getNRows() || nrows != result.getNRows() || mat.getNCols() != result.getNCols())
+		throw std::range_error("Matrix::gemm, illegal matrix size!");
+	if (&result == this || &result == &mat)
+		throw std::range_error("Matrix::gemm, result must not be an operand!");
+
+	T* c (result.getEntryArray());
+	const size_t n (result.getNRows() * result.getNCols());
+	if (beta == T(0)) {
+		for (size_t k = 0; k < n; k++)
+			c[k] = T(0);
+	} else if (beta != T(1)) {
+		for (size_t k = 0; k < n; k++)
+			c[k] *= beta;
 	}
 
-	return y;
+	MathLib::gemm (nrows, mat.getNCols(), ncols, alpha, data, ncols,
+			mat.getEntryArray(), mat.getNCols(), c, result.getNCols());
 }
 
 // HS initial implementation
 template<class T> Matrix<T>* Matrix<T>::transpose() const
 {
 	Matrix<T>* y(new Matrix<T> (ncols, nrows));
+	transpose (*y);
+	return y;
+}
 
-	for (size_t i = 0; i < nrows; i++) {
-		for (size_t j = 0; j < ncols; j++) {
-//			y->data[y->address(j, i)] = data[address(i, j)];
-			(*y)(j,i) = data[address(i, j)];
+template<class T> void Matrix<T>::transpose(Matrix<T>& result) const throw (std::range_error)
+{
+	if (result.getNRows() != ncols || result.getNCols() != nrows || &result == this)
+		throw std::range_error("Matrix::transpose, illegal matrix size!");
+
+	// blocked in order to use the cache lines of both matrices
+	const size_t bs (32);
+	T* y (result.getEntryArray());
+	for (size_t ib = 0; ib < nrows; ib += bs) {
+		const size_t ie (std::min(ib + bs, nrows));
+		for (size_t jb = 0; jb < ncols; jb += bs) {
+			const size_t je (std::min(jb + bs, ncols));
+			for (size_t i = ib; i < ie; i++) {
+				for (size_t j = jb; j < je; j++) {
+					y[j * nrows + i] = data[address(i, j)];
+				}
+			}
 		}
 	}
-	return y;
 }
 
 template<class T> Matrix<T>* Matrix<T>::getSubMatrix(
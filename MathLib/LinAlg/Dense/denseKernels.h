@@ -0,0 +1,171 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file denseKernels.h
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#ifndef DENSEKERNELS_H_
+#define DENSEKERNELS_H_
+
+#include <cstddef>
+#include <algorithm>
+
+namespace MathLib {
+
+/**
+ * Block sizes of the cache blocked matrix matrix multiplication. A block of
+ * B (GEMM_KC x GEMM_NC entries) should fit into the L2 cache, a row panel of
+ * the result (4 x GEMM_NC entries) into the L1 cache.
+ */
+const std::size_t GEMM_MC(64);
+const std::size_t GEMM_KC(256);
+const std::size_t GEMM_NC(512);
+
+/**
+ * Matrix vector multiplication \f$y = \alpha A x + \beta y\f$ for a dense
+ * matrix \f$A\f$ stored row wise with leading dimension lda. Four rows are
+ * processed at once such that every entry of x is loaded once per four rows.
+ * @param m number of rows of A
+ * @param n number of columns of A
+ * @param alpha scalar factor
+ * @param A the entries of the matrix
+ * @param lda leading dimension (distance of two rows in memory)
+ * @param x vector of length n
+ * @param beta scalar factor, if zero y is not read
+ * @param y vector of length m
+ */
+template <typename T>
+void gemv(std::size_t m, std::size_t n, T alpha, T const*const A, std::size_t lda,
+		T const*const __restrict__ x, T beta, T* __restrict__ y)
+{
+	std::size_t i(0);
+	for (; i + 4 <= m; i += 4) {
+		T const*const a0(A + i * lda);
+		T const*const a1(a0 + lda);
+		T const*const a2(a1 + lda);
+		T const*const a3(a2 + lda);
+		T t0(0), t1(0), t2(0), t3(0);
+		for (std::size_t j(0); j < n; j++) {
+			const T xj(x[j]);
+			t0 += a0[j] * xj;
+			t1 += a1[j] * xj;
+			t2 += a2[j] * xj;
+			t3 += a3[j] * xj;
+		}
+		if (beta == T(0)) {
+			y[i] = alpha * t0;
+			y[i + 1] = alpha * t1;
+			y[i + 2] = alpha * t2;
+			y[i + 3] = alpha * t3;
+		} else {
+			y[i] = alpha * t0 + beta * y[i];
+			y[i + 1] = alpha * t1 + beta * y[i + 1];
+			y[i + 2] = alpha * t2 + beta * y[i + 2];
+			y[i + 3] = alpha * t3 + beta * y[i + 3];
+		}
+	}
+	for (; i < m; i++) {
+		T const*const a0(A + i * lda);
+		T t0(0);
+		for (std::size_t j(0); j < n; j++)
+			t0 += a0[j] * x[j];
+		y[i] = (beta == T(0)) ? alpha * t0 : alpha * t0 + beta * y[i];
+	}
+}
+
+/**
+ * Kernel for gemm(): C(0:mr, 0:n) += alpha A(0:mr, 0:k) B(0:k, 0:n) for
+ * mr <= 4 rows. The innermost loop runs over contiguous entries of B and C
+ * and is vectorized by the compiler.
+ */
+template <typename T>
+void gemmRowKernel(std::size_t mr, std::size_t n, std::size_t k, T alpha,
+		T const*const A, std::size_t lda, T const*const B, std::size_t ldb,
+		T* C, std::size_t ldc)
+{
+	if (mr == 4) {
+		T* __restrict__ c0(C);
+		T* __restrict__ c1(C + ldc);
+		T* __restrict__ c2(C + 2 * ldc);
+		T* __restrict__ c3(C + 3 * ldc);
+		for (std::size_t p(0); p < k; p++) {
+			const T a0(alpha * A[p]);
+			const T a1(alpha * A[lda + p]);
+			const T a2(alpha * A[2 * lda + p]);
+			const T a3(alpha * A[3 * lda + p]);
+			T const*const __restrict__ b(B + p * ldb);
+			for (std::size_t j(0); j < n; j++) {
+				const T bj(b[j]);
+				c0[j] += a0 * bj;
+				c1[j] += a1 * bj;
+				c2[j] += a2 * bj;
+				c3[j] += a3 * bj;
+			}
+		}
+	} else {
+		for (std::size_t i(0); i < mr; i++) {
+			T* __restrict__ c(C + i * ldc);
+			for (std::size_t p(0); p < k; p++) {
+				const T a(alpha * A[i * lda + p]);
+				T const*const __restrict__ b(B + p * ldb);
+				for (std::size_t j(0); j < n; j++)
+					c[j] += a * b[j];
+			}
+		}
+	}
+}
+
+/**
+ * Cache blocked matrix matrix multiplication \f$C = C + \alpha A B\f$ for dense
+ * matrices stored row wise. The matrices may be sub matrices of larger
+ * matrices, i.e. the leading dimensions can be greater than the number of
+ * columns. For large matrices the row blocks of C are computed in parallel.
+ * @param m number of rows of A and C
+ * @param n number of columns of B and C
+ * @param k number of columns of A and rows of B
+ * @param alpha scalar factor
+ * @param A the entries of A
+ * @param lda leading dimension of A
+ * @param B the entries of B
+ * @param ldb leading dimension of B
+ * @param C the entries of C
+ * @param ldc leading dimension of C
+ */
+template <typename T>
+void gemm(std::size_t m, std::size_t n, std::size_t k, T alpha,
+		T const*const A, std::size_t lda, T const*const B, std::size_t ldb,
+		T* C, std::size_t ldc)
+{
+	if (m == 0 || n == 0 || k == 0)
+		return;
+
+	const OPENMP_LOOP_TYPE n_row_blocks((m + GEMM_MC - 1) / GEMM_MC);
+	const bool parallel(static_cast<double>(m) * n * k > 1e6 && n_row_blocks > 1);
+
+	for (std::size_t jb(0); jb < n; jb += GEMM_NC) {
+		const std::size_t nb(std::min(GEMM_NC, n - jb));
+		for (std::size_t pb(0); pb < k; pb += GEMM_KC) {
+			const std::size_t kb(std::min(GEMM_KC, k - pb));
+			OPENMP_LOOP_TYPE ib;
+			#pragma omp parallel for schedule(dynamic) if (parallel)
+			for (ib = 0; ib < n_row_blocks; ib++) {
+				const std::size_t i_beg(ib * GEMM_MC);
+				const std::size_t i_end(std::min(i_beg + GEMM_MC, m));
+				for (std::size_t i(i_beg); i < i_end; i += 4) {
+					gemmRowKernel(std::min(static_cast<std::size_t>(4), i_end - i), nb, kb, alpha,
+							A + i * lda + pb, lda, B + pb * ldb + jb, ldb, C + i * ldc + jb, ldc);
+				}
+			}
+		}
+	}
+}
+
+} // end namespace MathLib
+
+#endif /* DENSEKERNELS_H_ */
@@ -0,0 +1,459 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file HMatrix.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <algorithm>
+
+#include "HMatrix.h"
+#include "LowRankApproximation.h"
+#include "../Dense/Matrix.h"
+#include "../Dense/denseKernels.h"
+#include "../Solvers/GaussAlgorithm.h"
+
+namespace MathLib {
+
+/** node of the cluster tree, the cluster consists of the (permuted) indices [beg, end) */
+struct HMatrix::ClusterNode
+{
+	ClusterNode(unsigned b, unsigned e) :
+		beg(b), end(e), leaf_beg(0), leaf_end(0), diag_block(NULL),
+		coupling_rank(0), lu_mat(NULL), lu(NULL)
+	{}
+
+	~ClusterNode()
+	{
+		for (std::size_t k(0); k < sons.size(); k++)
+			delete sons[k];
+		delete lu;
+		delete lu_mat;
+	}
+
+	unsigned size() const { return end - beg; }
+
+	const unsigned beg;
+	const unsigned end;
+	/** the leaves of the subtree are _leaves[leaf_beg], ..., _leaves[leaf_end-1] */
+	unsigned leaf_beg;
+	unsigned leaf_end;
+	std::vector<ClusterNode*> sons;
+	/** the dense diagonal block (leaves only) */
+	Block* diag_block;
+	/** the blocks between different sons of this cluster */
+	std::vector<Block*> coupling;
+	/** number of columns of U (and V) of all coupling blocks */
+	unsigned coupling_rank;
+	/** W = D^{-1} U (size() x coupling_rank, column wise) */
+	std::vector<double> W;
+	/** LU factorization of the diagonal block (leaves) or of I + V^T W (other clusters) */
+	Matrix<double>* lu_mat;
+	GaussAlgorithm* lu;
+};
+
+/** block of the partition, either dense (row wise) or of low rank (U V^T, U and V column wise) */
+struct HMatrix::Block
+{
+	Block(ClusterNode const* r, ClusterNode const* c, ClusterNode* f) :
+		row(r), col(c), factor_node(f), low_rank(false), rank(0)
+	{}
+
+	ClusterNode const* const row;
+	ClusterNode const* const col;
+	/** the cluster whose factorization handles the block */
+	ClusterNode* const factor_node;
+	bool low_rank;
+	unsigned rank;
+	std::vector<double> dense;
+	std::vector<double> U;
+	std::vector<double> V;
+};
+
+HMatrix::HMatrix(MatrixEntryGenerator const& A, unsigned n, unsigned leaf_size,
+		double eps, CompressionMethod method) :
+	LinearOperator<double>(n, n), _op_perm(new unsigned[n]), _root(NULL), _factorized(false)
+{
+	for (unsigned i(0); i < n; i++)
+		_op_perm[i] = i;
+	_root = createClusterNode(0, n, std::max(leaf_size, 1u));
+	initialize(A, eps, method);
+}
+
+HMatrix::~HMatrix()
+{
+	for (std::size_t k(0); k < _blocks.size(); k++)
+		delete _blocks[k];
+	delete _root;
+	delete [] _op_perm;
+}
+
+HMatrix::ClusterNode* HMatrix::createClusterNode(unsigned beg, unsigned end, unsigned leaf_size)
+{
+	ClusterNode* const node(new ClusterNode(beg, end));
+	if (end - beg > leaf_size) {
+		const unsigned mid(beg + (end - beg) / 2);
+		node->sons.push_back(createClusterNode(beg, mid, leaf_size));
+		node->sons.push_back(createClusterNode(mid, end, leaf_size));
+	}
+	return node;
+}
+
+void HMatrix::initialize(MatrixEntryGenerator const& A, double eps, CompressionMethod method)
+{
+	collectLeaves(_root);
+	buildBlocks(A, eps, method, _root, _root, NULL);
+
+	// blocks covering the rows of the leaves
+	const std::size_t n_leaves(_leaves.size());
+	const std::size_t n_blocks(_blocks.size());
+	_leaf_block_ptr.assign(n_leaves + 1, 0);
+	for (std::size_t b(0); b < n_blocks; b++)
+		for (unsigned l(_blocks[b]->row->leaf_beg); l < _blocks[b]->row->leaf_end; l++)
+			_leaf_block_ptr[l + 1]++;
+	for (std::size_t l(0); l < n_leaves; l++)
+		_leaf_block_ptr[l + 1] += _leaf_block_ptr[l];
+	_leaf_blocks.resize(_leaf_block_ptr[n_leaves]);
+	std::vector<unsigned> pos(_leaf_block_ptr.begin(), _leaf_block_ptr.end() - 1);
+	for (std::size_t b(0); b < n_blocks; b++)
+		for (unsigned l(_blocks[b]->row->leaf_beg); l < _blocks[b]->row->leaf_end; l++)
+			_leaf_blocks[pos[l]++] = b;
+
+	_rank_offset.assign(n_blocks + 1, 0);
+	for (std::size_t b(0); b < n_blocks; b++)
+		_rank_offset[b + 1] = _rank_offset[b] + _blocks[b]->rank;
+}
+
+void HMatrix::collectLeaves(ClusterNode* node)
+{
+	node->leaf_beg = _leaves.size();
+	if (node->sons.empty())
+		_leaves.push_back(node);
+	for (std::size_t k(0); k < node->sons.size(); k++)
+		collectLeaves(node->sons[k]);
+	node->leaf_end = _leaves.size();
+}
+
+void HMatrix::buildBlocks(MatrixEntryGenerator const& A, double eps, CompressionMethod method,
+		ClusterNode* row, ClusterNode* col, ClusterNode* factor_node)
+{
+	if (row == col) {
+		if (row->sons.empty()) {
+			addDenseBlock(A, row, col, row);
+			row->diag_block = _blocks.back();
+			return;
+		}
+		for (std::size_t s(0); s < row->sons.size(); s++)
+			for (std::size_t t(0); t < row->sons.size(); t++)
+				buildBlocks(A, eps, method, row->sons[s], row->sons[t], row);
+		return;
+	}
+
+	// weak admissibility: try to compress every block of two different
+	// clusters, a low rank block is profitable if k (m + n) < m n
+	const unsigned m(row->size()), n(col->size());
+	const unsigned max_rank((static_cast<std::size_t>(m) * n - 1) / (m + n));
+	Block* const block(new Block(row, col, factor_node));
+	bool compressed(false);
+	if (method == SVD)
+		compressed = truncatedSVD(A, m, _op_perm + row->beg, n, _op_perm + col->beg,
+				eps, max_rank, block->U, block->V);
+	else if (adaptiveCrossApproximation(A, m, _op_perm + row->beg, n, _op_perm + col->beg,
+				eps, max_rank, block->U, block->V))
+		compressed = true;
+	if (compressed) {
+		if (method == ACA)
+			recompressLowRank(m, n, eps, block->U, block->V);
+		block->low_rank = true;
+		block->rank = block->U.size() / m;
+		_blocks.push_back(block);
+		return;
+	}
+	delete block;
+
+	if (!row->sons.empty() && !col->sons.empty()) {
+		for (std::size_t s(0); s < row->sons.size(); s++)
+			for (std::size_t t(0); t < col->sons.size(); t++)
+				buildBlocks(A, eps, method, row->sons[s], col->sons[t], factor_node);
+	} else if (!row->sons.empty()) {
+		for (std::size_t s(0); s < row->sons.size(); s++)
+			buildBlocks(A, eps, method, row->sons[s], col, factor_node);
+	} else if (!col->sons.empty()) {
+		for (std::size_t t(0); t < col->sons.size(); t++)
+			buildBlocks(A, eps, method, row, col->sons[t], factor_node);
+	} else
+		addDenseBlock(A, row, col, factor_node);
+}
+
+void HMatrix::addDenseBlock(MatrixEntryGenerator const& A, ClusterNode* row, ClusterNode* col,
+		ClusterNode* factor_node)
+{
+	Block* const block(new Block(row, col, factor_node));
+	const unsigned m(row->size()), n(col->size());
+	block->dense.resize(static_cast<std::size_t>(m) * n);
+	for (unsigned i(0); i < m; i++)
+		for (unsigned j(0); j < n; j++)
+			block->dense[i * n + j] = A(_op_perm[row->beg + i], _op_perm[col->beg + j]);
+	_blocks.push_back(block);
+}
+
+void HMatrix::amux(double d, double const * const __restrict__ x, double * __restrict__ y) const
+{
+	const unsigned n(_n_rows);
+	double* const xp(new double[n]);
+	double* const yp(new double[n]);
+	double* const t(new double[std::max(_rank_offset.back(), 1u)]);
+
+	OPENMP_LOOP_TYPE i;
+	#pragma omp parallel for schedule(static)
+	for (i = 0; i < static_cast<OPENMP_LOOP_TYPE>(n); i++)
+		xp[i] = x[_op_perm[i]];
+
+	// t = V^T x for all low rank blocks
+	const OPENMP_LOOP_TYPE n_blocks(_blocks.size());
+	OPENMP_LOOP_TYPE b;
+	#pragma omp parallel for schedule(dynamic)
+	for (b = 0; b < n_blocks; b++) {
+		Block const& block(*_blocks[b]);
+		const unsigned nc(block.col->size());
+		for (unsigned l(0); l < block.rank; l++) {
+			double const*const v(&block.V[l * nc]);
+			double const*const xc(xp + block.col->beg);
+			double s(0.0);
+			for (unsigned j(0); j < nc; j++)
+				s += v[j] * xc[j];
+			t[_rank_offset[b] + l] = s;
+		}
+	}
+
+	// every leaf collects the contributions of the blocks covering its rows,
+	// hence the rows are written by one thread only
+	const OPENMP_LOOP_TYPE n_leaves(_leaves.size());
+	OPENMP_LOOP_TYPE l;
+	#pragma omp parallel for schedule(dynamic)
+	for (l = 0; l < n_leaves; l++) {
+		ClusterNode const& leaf(*_leaves[l]);
+		double* const yl(yp + leaf.beg);
+		const unsigned ml(leaf.size());
+		for (unsigned k(0); k < ml; k++)
+			yl[k] = 0.0;
+		for (unsigned k(_leaf_block_ptr[l]); k < _leaf_block_ptr[l + 1]; k++) {
+			Block const& block(*_blocks[_leaf_blocks[k]]);
+			const unsigned row_offset(leaf.beg - block.row->beg);
+			if (block.low_rank) {
+				const unsigned m(block.row->size());
+				double const*const tb(t + _rank_offset[_leaf_blocks[k]]);
+				for (unsigned r(0); r < block.rank; r++) {
+					double const*const u(&block.U[r * m + row_offset]);
+					for (unsigned j(0); j < ml; j++)
+						yl[j] += tb[r] * u[j];
+				}
+			} else {
+				const unsigned nc(block.col->size());
+				gemv(ml, nc, 1.0, &block.dense[row_offset * nc], nc,
+						xp + block.col->beg, 1.0, yl);
+			}
+		}
+	}
+
+	#pragma omp parallel for schedule(static)
+	for (i = 0; i < static_cast<OPENMP_LOOP_TYPE>(n); i++)
+		y[_op_perm[i]] = d * yp[i];
+
+	delete [] xp;
+	delete [] yp;
+	delete [] t;
+}
+
+void HMatrix::factorize()
+{
+	factorize(_root);
+	_factorized = true;
+}
+
+void HMatrix::factorize(ClusterNode* node)
+{
+	const unsigned n(node->size());
+	delete node->lu;
+	delete node->lu_mat;
+	node->lu = NULL;
+	node->lu_mat = NULL;
+
+	if (node->sons.empty()) {
+		node->lu_mat = new Matrix<double>(n, n);
+		std::copy(node->diag_block->dense.begin(), node->diag_block->dense.end(),
+				node->lu_mat->getEntryArray());
+		node->lu = new GaussAlgorithm(*node->lu_mat);
+		return;
+	}
+
+	for (std::size_t k(0); k < node->sons.size(); k++)
+		factorize(node->sons[k]);
+
+	// the blocks between the sons: A = D + U V^T, a dense block B (m x n_c)
+	// contributes U = B and V = I
+	node->coupling.clear();
+	for (std::size_t b(0); b < _blocks.size(); b++)
+		if (_blocks[b]->factor_node == node)
+			node->coupling.push_back(_blocks[b]);
+	const std::size_t n_coupling(node->coupling.size());
+	std::vector<unsigned> col_offset(n_coupling + 1, 0);
+	for (std::size_t b(0); b < n_coupling; b++) {
+		Block const& block(*node->coupling[b]);
+		col_offset[b + 1] = col_offset[b] + (block.low_rank ? block.rank : block.col->size());
+	}
+	const unsigned K(col_offset[n_coupling]);
+	node->coupling_rank = K;
+	node->W.assign(static_cast<std::size_t>(n) * K, 0.0);
+	if (K == 0)
+		return;
+
+	for (std::size_t b(0); b < n_coupling; b++) {
+		Block const& block(*node->coupling[b]);
+		const unsigned m(block.row->size());
+		const unsigned row_offset(block.row->beg - node->beg);
+		const unsigned n_cols(col_offset[b + 1] - col_offset[b]);
+		for (unsigned j(0); j < n_cols; j++) {
+			double* const w(&node->W[(col_offset[b] + j) * static_cast<std::size_t>(n) + row_offset]);
+			if (block.low_rank)
+				std::copy(block.U.begin() + j * m, block.U.begin() + (j + 1) * m, w);
+			else
+				for (unsigned i(0); i < m; i++)
+					w[i] = block.dense[i * n_cols + j];
+		}
+	}
+
+	// W = D^{-1} U, the columns are independent
+	OPENMP_LOOP_TYPE j;
+	#pragma omp parallel for schedule(dynamic)
+	for (j = 0; j < static_cast<OPENMP_LOOP_TYPE>(K); j++)
+		solveSons(node, &node->W[j * static_cast<std::size_t>(n)]);
+
+	// capacitance matrix C = I + V^T W
+	node->lu_mat = new Matrix<double>(K, K, 0.0);
+	Matrix<double> &C(*node->lu_mat);
+	for (unsigned k(0); k < K; k++)
+		C(k, k) = 1.0;
+	for (std::size_t b(0); b < n_coupling; b++) {
+		Block const& block(*node->coupling[b]);
+		const unsigned nc(block.col->size());
+		const unsigned col_beg(block.col->beg - node->beg);
+		for (unsigned k(0); k < K; k++) {
+			double const*const w(&node->W[k * static_cast<std::size_t>(n) + col_beg]);
+			if (block.low_rank) {
+				for (unsigned r(0); r < block.rank; r++) {
+					double const*const v(&block.V[r * nc]);
+					double s(0.0);
+					for (unsigned i(0); i < nc; i++)
+						s += v[i] * w[i];
+					C(col_offset[b] + r, k) += s;
+				}
+			} else {
+				for (unsigned i(0); i < nc; i++)
+					C(col_offset[b] + i, k) += w[i];
+			}
+		}
+	}
+	node->lu = new GaussAlgorithm(C);
+}
+
+void HMatrix::precondApply(double* x) const
+{
+	if (!_factorized)
+		return;
+	const unsigned n(_n_rows);
+	double* const xp(new double[n]);
+	for (unsigned i(0); i < n; i++)
+		xp[i] = x[_op_perm[i]];
+	solve(_root, xp);
+	for (unsigned i(0); i < n; i++)
+		x[_op_perm[i]] = xp[i];
+	delete [] xp;
+}
+
+void HMatrix::solve(ClusterNode const* node, double* z) const
+{
+	if (node->sons.empty()) {
+		node->lu->execute(z);
+		return;
+	}
+
+	// A^{-1} z = D^{-1} z - W (I + V^T W)^{-1} V^T D^{-1} z
+	solveSons(node, z);
+	const unsigned K(node->coupling_rank);
+	if (K == 0)
+		return;
+
+	std::vector<double> t(K);
+	unsigned offset(0);
+	for (std::size_t b(0); b < node->coupling.size(); b++) {
+		Block const& block(*node->coupling[b]);
+		const unsigned nc(block.col->size());
+		double const*const zc(z + block.col->beg - node->beg);
+		if (block.low_rank) {
+			for (unsigned r(0); r < block.rank; r++) {
+				double const*const v(&block.V[r * nc]);
+				double s(0.0);
+				for (unsigned i(0); i < nc; i++)
+					s += v[i] * zc[i];
+				t[offset + r] = s;
+			}
+			offset += block.rank;
+		} else {
+			std::copy(zc, zc + nc, t.begin() + offset);
+			offset += nc;
+		}
+	}
+	node->lu->execute(&t[0]);
+
+	const unsigned n(node->size());
+	for (unsigned k(0); k < K; k++) {
+		double const*const w(&node->W[k * static_cast<std::size_t>(n)]);
+		for (unsigned i(0); i < n; i++)
+			z[i] -= t[k] * w[i];
+	}
+}
+
+void HMatrix::solveSons(ClusterNode const* node, double* z) const
+{
+	for (std::size_t k(0); k < node->sons.size(); k++)
+		solve(node->sons[k], z + node->sons[k]->beg - node->beg);
+}
+
+std::size_t HMatrix::getNStoredEntries() const
+{
+	std::size_t n_entries(0);
+	for (std::size_t b(0); b < _blocks.size(); b++)
+		n_entries += _blocks[b]->low_rank ? _blocks[b]->U.size() + _blocks[b]->V.size()
+				: _blocks[b]->dense.size();
+	return n_entries;
+}
+
+unsigned HMatrix::getNDenseBlocks() const
+{
+	unsigned n(0);
+	for (std::size_t b(0); b < _blocks.size(); b++)
+		if (!_blocks[b]->low_rank)
+			n++;
+	return n;
+}
+
+unsigned HMatrix::getNLowRankBlocks() const
+{
+	return _blocks.size() - getNDenseBlocks();
+}
+
+unsigned HMatrix::getMaxRank() const
+{
+	unsigned k(0);
+	for (std::size_t b(0); b < _blocks.size(); b++)
+		k = std::max(k, _blocks[b]->rank);
+	return k;
+}
+
+} // end namespace MathLib
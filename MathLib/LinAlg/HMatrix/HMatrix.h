@@ -0,0 +1,139 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file HMatrix.h
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#ifndef HMATRIX_H_
+#define HMATRIX_H_
+
+#include <cstddef>
+#include <vector>
+
+#include "../LinearOperator.h"
+#include "MatrixEntryGenerator.h"
+
+namespace MathLib {
+
+/**
+ * HMatrix is a hierarchical matrix approximation of a dense n x n matrix
+ * whose entries are given by a MatrixEntryGenerator. The index set is
+ * organized in a cluster tree obtained by recursive bisection of the index
+ * range. The nested dissection tree (class ClusterBase) can not be used:
+ * Cluster::subdivide() computes the permutation but creates no sons, i.e.
+ * the tree would consist of one dense n x n leaf. The matrix is partitioned
+ * into blocks along the cluster tree using the weak admissibility condition
+ * (HODLR, hierarchically off-diagonal low rank): every block of two
+ * different clusters is approximated by a matrix of low rank \f$ U V^T \f$
+ * (ACA or truncated SVD). If the rank needed for the requested accuracy is
+ * too large for the block to be stored profitably, the block is subdivided
+ * further. Diagonal blocks of leaf clusters and non compressible blocks of
+ * leaves are stored as dense matrices.
+ *
+ * Besides the matrix vector product amux() the class provides an
+ * approximate direct solver (factorize(), precondApply()): the inverse is
+ * computed recursively along the cluster tree with the Sherman-Morrison-
+ * Woodbury formula. An HMatrix with a coarse accuracy is a robust
+ * preconditioner for the (finer) operator.
+ */
+class HMatrix : public LinearOperator<double>
+{
+public:
+	/** how the admissible blocks are compressed */
+	enum CompressionMethod {
+		ACA, //!< adaptive cross approximation followed by recompression
+		SVD  //!< truncated SVD of the complete block (optimal rank, expensive)
+	};
+
+	/**
+	 * Builds the hierarchical matrix on the cluster tree obtained by
+	 * recursive bisection of the index range [0, n). This requires a
+	 * numbering where indices close to each other belong to geometrically
+	 * close degrees of freedom (for instance the nodes of a boundary curve
+	 * in the order of the curve).
+	 * @param A generator of the matrix entries
+	 * @param n number of rows and columns
+	 * @param leaf_size maximal number of indices in a leaf of the cluster tree
+	 * @param eps relative accuracy of the low rank blocks
+	 * @param method the compression method
+	 */
+	HMatrix(MatrixEntryGenerator const& A, unsigned n, unsigned leaf_size,
+			double eps, CompressionMethod method = ACA);
+
+	virtual ~HMatrix();
+
+	/**
+	 * y = d * A * x
+	 * @param d scalar factor
+	 * @param x vector to multiply with
+	 * @param y result vector
+	 */
+	void amux(double d, double const * const __restrict__ x, double * __restrict__ y) const;
+
+	/**
+	 * Computes the approximate inverse used by precondApply(). Every cluster
+	 * with sons stores \f$ W = D^{-1} U \f$ and the LU factorization of the
+	 * capacitance matrix \f$ I + V^T W \f$, where D is the block diagonal
+	 * part of the sons and \f$ U V^T \f$ collects the blocks between the
+	 * sons. The diagonal blocks of the leaves are factorized by
+	 * GaussAlgorithm.
+	 */
+	void factorize();
+
+	/**
+	 * Applies the approximate inverse: x = A^{-1} x. If factorize() was not
+	 * called before x is not changed.
+	 */
+	void precondApply(double* x) const;
+
+	/** @return the number of stored matrix entries (dense entries and entries of the low rank factors) */
+	std::size_t getNStoredEntries() const;
+
+	/** @return the number of dense blocks */
+	unsigned getNDenseBlocks() const;
+
+	/** @return the number of low rank blocks */
+	unsigned getNLowRankBlocks() const;
+
+	/** @return the maximal rank of the low rank blocks */
+	unsigned getMaxRank() const;
+
+private:
+	struct ClusterNode;
+	struct Block;
+
+	ClusterNode* createClusterNode(unsigned beg, unsigned end, unsigned leaf_size);
+	void initialize(MatrixEntryGenerator const& A, double eps, CompressionMethod method);
+	void collectLeaves(ClusterNode* node);
+	void buildBlocks(MatrixEntryGenerator const& A, double eps, CompressionMethod method,
+			ClusterNode* row, ClusterNode* col, ClusterNode* factor_node);
+	void addDenseBlock(MatrixEntryGenerator const& A, ClusterNode* row, ClusterNode* col,
+			ClusterNode* factor_node);
+	void factorize(ClusterNode* node);
+	void solve(ClusterNode const* node, double* z) const;
+	void solveSons(ClusterNode const* node, double* z) const;
+
+	/** indices of the cluster tree in the numbering of the generator (original_idx = _op_perm[permuted_idx]) */
+	unsigned* _op_perm;
+	ClusterNode* _root;
+	/** the leaves of the cluster tree in the order of the indices */
+	std::vector<ClusterNode*> _leaves;
+	/** the blocks of the partition */
+	std::vector<Block*> _blocks;
+	/** the blocks whose rows contain leaf l are _leaf_blocks[_leaf_block_ptr[l]], ..., _leaf_blocks[_leaf_block_ptr[l+1]-1] */
+	std::vector<unsigned> _leaf_block_ptr;
+	std::vector<unsigned> _leaf_blocks;
+	/** offsets of the low rank blocks in the vector of the products V^T x */
+	std::vector<unsigned> _rank_offset;
+	bool _factorized;
+};
+
+} // end namespace MathLib
+
+#endif /* HMATRIX_H_ */
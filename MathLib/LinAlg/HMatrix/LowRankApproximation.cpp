@@ -0,0 +1,289 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file LowRankApproximation.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "LowRankApproximation.h"
+
+namespace MathLib {
+
+namespace {
+
+inline double dot(unsigned n, double const*const x, double const*const y)
+{
+	double s(0.0);
+	for (unsigned i(0); i < n; i++)
+		s += x[i] * y[i];
+	return s;
+}
+
+/**
+ * QR decomposition of the m x k matrix Q (column wise) by the modified
+ * Gram-Schmidt method with reorthogonalization. Q is overwritten by the
+ * orthonormal factor, R (k x k, column wise) is the upper triangular factor.
+ * Linearly dependent columns are replaced by zero columns.
+ */
+void gramSchmidtQR(unsigned m, unsigned k, double* Q, double* R)
+{
+	for (unsigned l(0); l < k * k; l++)
+		R[l] = 0.0;
+	for (unsigned j(0); j < k; j++) {
+		double* const q(Q + j * m);
+		const double nrm_before(sqrt(dot(m, q, q)));
+		for (unsigned pass(0); pass < 2; pass++) {
+			for (unsigned l(0); l < j; l++) {
+				double const*const ql(Q + l * m);
+				const double h(dot(m, ql, q));
+				R[l + j * k] += h;
+				for (unsigned i(0); i < m; i++)
+					q[i] -= h * ql[i];
+			}
+		}
+		const double nrm(sqrt(dot(m, q, q)));
+		if (nrm > 1e-14 * nrm_before) {
+			R[j + j * k] = nrm;
+			for (unsigned i(0); i < m; i++)
+				q[i] /= nrm;
+		} else {
+			for (unsigned i(0); i < m; i++)
+				q[i] = 0.0;
+		}
+	}
+}
+
+/** C (m x k) = A (m x l) * B(0:l, 0:k), all matrices column wise, ldb leading dimension of B */
+void multiply(unsigned m, unsigned l, unsigned k, double const*const A,
+		double const*const B, unsigned ldb, double* C)
+{
+	for (unsigned j(0); j < k; j++) {
+		double* const c(C + j * m);
+		for (unsigned i(0); i < m; i++)
+			c[i] = 0.0;
+		for (unsigned p(0); p < l; p++) {
+			const double b(B[p + j * ldb]);
+			double const*const a(A + p * m);
+			for (unsigned i(0); i < m; i++)
+				c[i] += a[i] * b;
+		}
+	}
+}
+
+} // end anonymous namespace
+
+bool adaptiveCrossApproximation(MatrixEntryGenerator const& A, unsigned m,
+		unsigned const*const rows, unsigned n, unsigned const*const cols,
+		double eps, unsigned max_rank, std::vector<double> &U, std::vector<double> &V)
+{
+	U.clear();
+	V.clear();
+	std::vector<bool> used_row(m, false);
+	std::vector<double> r(n), c(m);
+	double nrm2_approx(0.0);
+	unsigned k(0);
+	unsigned i_piv(0);
+
+	while (true) {
+		used_row[i_piv] = true;
+		// row i_piv of the remainder
+		for (unsigned j(0); j < n; j++)
+			r[j] = A(rows[i_piv], cols[j]);
+		for (unsigned l(0); l < k; l++) {
+			const double u(U[l * m + i_piv]);
+			double const*const v(&V[l * n]);
+			for (unsigned j(0); j < n; j++)
+				r[j] -= u * v[j];
+		}
+		unsigned j_piv(0);
+		for (unsigned j(1); j < n; j++)
+			if (fabs(r[j]) > fabs(r[j_piv]))
+				j_piv = j;
+
+		if (r[j_piv] != 0.0) {
+			if (k == max_rank)
+				return false;
+			// column j_piv of the remainder
+			for (unsigned i(0); i < m; i++)
+				c[i] = A(rows[i], cols[j_piv]);
+			for (unsigned l(0); l < k; l++) {
+				const double v(V[l * n + j_piv]);
+				double const*const u(&U[l * m]);
+				for (unsigned i(0); i < m; i++)
+					c[i] -= v * u[i];
+			}
+			const double scale(1.0 / r[j_piv]);
+			for (unsigned j(0); j < n; j++)
+				r[j] *= scale;
+
+			// update of the Frobenius norm of the approximation
+			const double nrm2_c(dot(m, &c[0], &c[0]));
+			const double nrm2_r(dot(n, &r[0], &r[0]));
+			double cross(0.0);
+			for (unsigned l(0); l < k; l++)
+				cross += dot(m, &U[l * m], &c[0]) * dot(n, &V[l * n], &r[0]);
+			nrm2_approx += 2.0 * cross + nrm2_c * nrm2_r;
+
+			U.insert(U.end(), c.begin(), c.end());
+			V.insert(V.end(), r.begin(), r.end());
+			k++;
+			if (nrm2_c * nrm2_r <= eps * eps * nrm2_approx)
+				return true;
+		}
+
+		// the next pivot row is the unused row with the largest entry in c,
+		// if the current row vanishes the next unused row is taken
+		bool found(false);
+		for (unsigned i(0); i < m; i++) {
+			if (used_row[i])
+				continue;
+			if (!found || (r[j_piv] != 0.0 && fabs(c[i]) > fabs(c[i_piv]))) {
+				i_piv = i;
+				found = true;
+				if (r[j_piv] == 0.0)
+					break;
+			}
+		}
+		if (!found)
+			return true;
+	}
+}
+
+bool truncatedSVD(MatrixEntryGenerator const& A, unsigned m,
+		unsigned const*const rows, unsigned n, unsigned const*const cols,
+		double eps, unsigned max_rank, std::vector<double> &U, std::vector<double> &V)
+{
+	// the Jacobi method needs at least as many rows as columns, hence the
+	// transposed block is decomposed for m < n
+	const bool transposed(m < n);
+	const unsigned mt(transposed ? n : m), nt(transposed ? m : n);
+	std::vector<double> B(mt * nt), W(nt * nt), s(nt);
+	for (unsigned j(0); j < n; j++)
+		for (unsigned i(0); i < m; i++)
+			B[transposed ? j + i * n : i + j * m] = A(rows[i], cols[j]);
+
+	jacobiSVD(mt, nt, &B[0], &W[0], &s[0]);
+	const unsigned k(getTruncationRank(nt, &s[0], eps));
+	if (k > max_rank)
+		return false;
+
+	// B = X Sigma, W = Y
+	std::vector<double> &X_sigma(transposed ? V : U);
+	std::vector<double> &Y(transposed ? U : V);
+	X_sigma.assign(B.begin(), B.begin() + k * mt);
+	Y.assign(W.begin(), W.begin() + k * nt);
+	return true;
+}
+
+unsigned recompressLowRank(unsigned m, unsigned n, double eps,
+		std::vector<double> &U, std::vector<double> &V)
+{
+	const unsigned k(U.size() / m);
+	if (k == 0)
+		return 0;
+
+	std::vector<double> R_U(k * k), R_V(k * k);
+	gramSchmidtQR(m, k, &U[0], &R_U[0]);
+	gramSchmidtQR(n, k, &V[0], &R_V[0]);
+
+	// M = R_U R_V^T
+	std::vector<double> M(k * k, 0.0);
+	for (unsigned j(0); j < k; j++)
+		for (unsigned l(j); l < k; l++)
+			for (unsigned i(0); i <= l; i++)
+				M[i + j * k] += R_U[i + l * k] * R_V[j + l * k];
+
+	std::vector<double> Y(k * k), s(k);
+	jacobiSVD(k, k, &M[0], &Y[0], &s[0]);
+	const unsigned k_new(getTruncationRank(k, &s[0], eps));
+
+	// U = Q_U X Sigma, V = Q_V Y
+	std::vector<double> U_new(m * k_new), V_new(n * k_new);
+	if (k_new > 0) {
+		multiply(m, k, k_new, &U[0], &M[0], k, &U_new[0]);
+		multiply(n, k, k_new, &V[0], &Y[0], k, &V_new[0]);
+	}
+	U.swap(U_new);
+	V.swap(V_new);
+	return k_new;
+}
+
+void jacobiSVD(unsigned m, unsigned n, double* A, double* V, double* s)
+{
+	for (unsigned j(0); j < n; j++)
+		for (unsigned i(0); i < n; i++)
+			V[i + j * n] = (i == j) ? 1.0 : 0.0;
+
+	const unsigned max_sweeps(60);
+	for (unsigned sweep(0); sweep < max_sweeps; sweep++) {
+		bool rotated(false);
+		for (unsigned p(0); p + 1 < n; p++) {
+			double* const ap(A + p * m);
+			double* const vp(V + p * n);
+			for (unsigned q(p + 1); q < n; q++) {
+				double* const aq(A + q * m);
+				double* const vq(V + q * n);
+				const double alpha(dot(m, ap, ap));
+				const double beta(dot(m, aq, aq));
+				const double gamma(dot(m, ap, aq));
+				if (gamma == 0.0 || fabs(gamma) <= 1e-15 * sqrt(alpha * beta))
+					continue;
+				rotated = true;
+				// rotation that makes the columns p and q orthogonal
+				const double zeta((beta - alpha) / (2.0 * gamma));
+				const double t((zeta >= 0.0 ? 1.0 : -1.0) / (fabs(zeta) + sqrt(1.0 + zeta * zeta)));
+				const double cs(1.0 / sqrt(1.0 + t * t));
+				const double sn(cs * t);
+				for (unsigned i(0); i < m; i++) {
+					const double x(ap[i]), y(aq[i]);
+					ap[i] = cs * x - sn * y;
+					aq[i] = sn * x + cs * y;
+				}
+				for (unsigned i(0); i < n; i++) {
+					const double x(vp[i]), y(vq[i]);
+					vp[i] = cs * x - sn * y;
+					vq[i] = sn * x + cs * y;
+				}
+			}
+		}
+		if (!rotated)
+			break;
+	}
+
+	// sort the singular values (and the columns) in decreasing order
+	std::vector<std::pair<double, unsigned> > order(n);
+	for (unsigned j(0); j < n; j++)
+		order[j] = std::make_pair(-sqrt(dot(m, A + j * m, A + j * m)), j);
+	std::sort(order.begin(), order.end());
+	std::vector<double> A_copy(A, A + m * n), V_copy(V, V + n * n);
+	for (unsigned j(0); j < n; j++) {
+		const unsigned j_old(order[j].second);
+		s[j] = -order[j].first;
+		std::copy(A_copy.begin() + j_old * m, A_copy.begin() + (j_old + 1) * m, A + j * m);
+		std::copy(V_copy.begin() + j_old * n, V_copy.begin() + (j_old + 1) * n, V + j * n);
+	}
+}
+
+unsigned getTruncationRank(unsigned n, double const*const s, double eps)
+{
+	double nrm2(0.0);
+	for (unsigned j(0); j < n; j++)
+		nrm2 += s[j] * s[j];
+	double tail(0.0);
+	unsigned k(n);
+	while (k > 0 && tail + s[k - 1] * s[k - 1] <= eps * eps * nrm2) {
+		tail += s[k - 1] * s[k - 1];
+		k--;
+	}
+	return k;
+}
+
+} // end namespace MathLib
@@ -0,0 +1,90 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file LowRankApproximation.h
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#ifndef LOWRANKAPPROXIMATION_H_
+#define LOWRANKAPPROXIMATION_H_
+
+#include <vector>
+
+#include "MatrixEntryGenerator.h"
+
+namespace MathLib {
+
+/**
+ * Approximates the block A(rows, cols) of a matrix A by a matrix of low rank
+ * \f$ U V^T \f$ using the adaptive cross approximation (ACA) with partial
+ * pivoting. The factors U (m x k) and V (n x k) are stored column wise, i.e.
+ * column l of U starts at U[l*m]. In every step a row and a column of the
+ * remainder \f$ A - U V^T \f$ are computed, the pivot row of the next step is
+ * the row of the largest entry of the current column. The block is evaluated
+ * only at k rows and k columns. The iteration stops if the rank one update is
+ * smaller than eps times the (estimated) Frobenius norm of the approximation.
+ * @param A generator of the matrix entries
+ * @param m number of rows of the block
+ * @param rows row indices of the block
+ * @param n number of columns of the block
+ * @param cols column indices of the block
+ * @param eps relative accuracy
+ * @param max_rank maximal rank of the approximation
+ * @param U (output) the left factor
+ * @param V (output) the right factor
+ * @return true if the accuracy is reached with at most max_rank terms
+ */
+bool adaptiveCrossApproximation(MatrixEntryGenerator const& A, unsigned m,
+		unsigned const*const rows, unsigned n, unsigned const*const cols,
+		double eps, unsigned max_rank, std::vector<double> &U, std::vector<double> &V);
+
+/**
+ * Truncated singular value decomposition of the block: the block is
+ * evaluated completely and decomposed by jacobiSVD(). The approximation has
+ * the smallest rank such that the error in the Frobenius norm is at most eps
+ * times the norm of the block.
+ * @return true if the rank of the approximation is at most max_rank
+ */
+bool truncatedSVD(MatrixEntryGenerator const& A, unsigned m,
+		unsigned const*const rows, unsigned n, unsigned const*const cols,
+		double eps, unsigned max_rank, std::vector<double> &U, std::vector<double> &V);
+
+/**
+ * Reduces the rank of \f$ U V^T \f$ to the smallest rank with relative
+ * accuracy eps (Frobenius norm). U and V are orthogonalized (QR) and the
+ * small k x k matrix \f$ R_U R_V^T \f$ is decomposed by jacobiSVD(). The
+ * costs are \f$ O(k^2 (m+n)) \f$.
+ * @return the new rank
+ */
+unsigned recompressLowRank(unsigned m, unsigned n, double eps,
+		std::vector<double> &U, std::vector<double> &V);
+
+/**
+ * Singular value decomposition \f$ A = U \Sigma V^T \f$ by the one sided
+ * Jacobi method (Hestenes): the columns of A are orthogonalized by plane
+ * rotations that are accumulated in V.
+ * @param m number of rows of A, m >= n
+ * @param n number of columns of A
+ * @param A the matrix stored column wise, at the end the matrix
+ * \f$ U \Sigma \f$
+ * @param V (output) the n x n matrix V stored column wise
+ * @param s (output) the singular values in decreasing order
+ */
+void jacobiSVD(unsigned m, unsigned n, double* A, double* V, double* s);
+
+/**
+ * @param n number of singular values
+ * @param s the singular values in decreasing order
+ * @param eps relative accuracy
+ * @return the smallest k with \f$ \sum_{l \ge k} s_l^2 \le eps^2 \sum_l s_l^2 \f$
+ */
+unsigned getTruncationRank(unsigned n, double const*const s, double eps);
+
+} // end namespace MathLib
+
+#endif /* LOWRANKAPPROXIMATION_H_ */
@@ -0,0 +1,39 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file MatrixEntryGenerator.h
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#ifndef MATRIXENTRYGENERATOR_H_
+#define MATRIXENTRYGENERATOR_H_
+
+namespace MathLib {
+
+/**
+ * Interface for (dense) matrices whose entries are computed on demand, for
+ * instance the matrices of boundary integral operators or of nonlocal models.
+ * The hierarchical matrix approximation (see class HMatrix) evaluates only
+ * a small part of the entries.
+ */
+class MatrixEntryGenerator
+{
+public:
+	virtual ~MatrixEntryGenerator() {}
+
+	/**
+	 * @param i row index
+	 * @param j column index
+	 * @return the entry (i,j) of the matrix
+	 */
+	virtual double operator() (unsigned i, unsigned j) const = 0;
+};
+
+} // end namespace MathLib
+
+#endif /* MATRIXENTRYGENERATOR_H_ */
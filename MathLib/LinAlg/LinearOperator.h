@@ -0,0 +1,57 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file LinearOperator.h
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#ifndef LINEAROPERATOR_H_
+#define LINEAROPERATOR_H_
+
+#include "MatrixBase.h"
+
+namespace MathLib {
+
+/**
+ * class LinearOperator is the interface the iterative solvers (CG, BiCGStab,
+ * GMRes) use to access the system matrix. The solvers only need the
+ * application of the operator to a vector and of the (optional)
+ * preconditioner. Hence the operator must not be stored explicitly, it can be
+ * for instance evaluated element by element on the fly (see
+ * MeshLib::ElementByElementLaplacian).
+ */
+template <typename FP_TYPE>
+class LinearOperator : public MatrixBase
+{
+public:
+	LinearOperator(unsigned n_rows = 0, unsigned n_cols = 0) :
+		MatrixBase(n_rows, n_cols)
+	{}
+
+	virtual ~LinearOperator() {}
+
+	/**
+	 * y = d * A * x
+	 * @param d scalar factor
+	 * @param x vector to multiply with
+	 * @param y result vector
+	 */
+	virtual void amux(FP_TYPE d, FP_TYPE const * const __restrict__ x, FP_TYPE * __restrict__ y) const = 0;
+
+	/**
+	 * Applies the preconditioner in place: x = M^{-1} x. The default
+	 * implementation is the identity, i.e. no preconditioning.
+	 * @param x vector the preconditioner is applied to
+	 */
+	virtual void precondApply(FP_TYPE* /*x*/) const
+	{}
+};
+
+} // end namespace MathLib
+
+#endif /* LINEAROPERATOR_H_ */
@@ -42,6 +42,19 @@ bool generateDiagPrecond (unsigned n, unsigned const*const iA, unsigned const*co
 	return true;
 }
 
+bool generateDiagPrecondFromPositions(unsigned n, unsigned nnz, unsigned const*const diag_pos,
+				double const*const A, double* diag)
+{
+	for (unsigned r(0); r<n; ++r) {
+		if (diag_pos[r] == nnz) {
+			std::cout << "row " << r << " has no diagonal element " << std::endl;
+			return false;
+		}
+		diag[r] = 1.0/A[diag_pos[r]];
+	}
+	return true;
+}
+
 bool generateDiagPrecondRowSum(unsigned n, unsigned const*const iA, double const*const A, double* diag)
 {
 	unsigned idx; // first idx of next row
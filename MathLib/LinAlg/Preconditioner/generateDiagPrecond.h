@@ -27,6 +27,20 @@ namespace MathLib {
 bool generateDiagPrecond(unsigned n, unsigned const*const iA, unsigned const*const jA,
 				double const*const A, double* diag);
 
+/**
+ * diagonal preconditioner \f$P_{ii} = a_{ii}^{-1}\f$ for matrices with a
+ * shared sparsity pattern, the positions of the diagonal entries are known
+ * (see SparsityPattern::getDiagonalPositions())
+ * @param n number of rows / columns
+ * @param nnz number of non-zero entries, marks missing diagonal entries
+ * @param diag_pos positions of the diagonal entries within A
+ * @param A data entries of compressed row storage format
+ * @param diag inverse entries of the diagonal
+ * @return true, if all diagonal entries are distinct from zero, else false
+ */
+bool generateDiagPrecondFromPositions(unsigned n, unsigned nnz, unsigned const*const diag_pos,
+				double const*const A, double* diag);
+
 /**
  * diagonal preconditioner \f$P_{ii} = \left(\sum_{j} |a_{ij}|\right)^{-1}\f$ associated with \f$n \times n\f$ matrix \f$A\f$
  * @param n number of rows / columns
@@ -0,0 +1,90 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file tridiagonalEigenvalues.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include "tridiagonalEigenvalues.h"
+
+namespace MathLib {
+
+/**
+ * Sturm sequence count: number of eigenvalues of T that are smaller than x
+ */
+static unsigned countEigenvaluesBelow(unsigned n, double const*const alpha,
+				double const*const beta, double x)
+{
+	const double tiny(std::numeric_limits<double>::min());
+	unsigned cnt(0);
+	double q(alpha[0] - x);
+	for (unsigned k(0); k < n; k++) {
+		if (k > 0)
+			q = alpha[k] - x - beta[k - 1] * beta[k - 1] / q;
+		if (fabs(q) < tiny)
+			q = -tiny;
+		if (q < 0.0)
+			cnt++;
+	}
+	return cnt;
+}
+
+void tridiagonalExtremeEigenvalues(unsigned n, double const*const alpha,
+				double const*const beta, double &lambda_min, double &lambda_max)
+{
+	if (n == 0) {
+		lambda_min = lambda_max = 0.0;
+		return;
+	}
+
+	// Gershgorin bounds
+	double lo(alpha[0]), hi(alpha[0]);
+	for (unsigned k(0); k < n; k++) {
+		double r(0.0);
+		if (k > 0)
+			r += fabs(beta[k - 1]);
+		if (k + 1 < n)
+			r += fabs(beta[k]);
+		lo = std::min(lo, alpha[k] - r);
+		hi = std::max(hi, alpha[k] + r);
+	}
+	const double tol(std::numeric_limits<double>::epsilon() * std::max(fabs(lo), fabs(hi)));
+
+	// smallest eigenvalue: smallest x with at least one eigenvalue below x
+	double a(lo), b(hi);
+	while (b - a > tol) {
+		const double c(0.5 * (a + b));
+		if (c <= a || c >= b)
+			break;
+		if (countEigenvaluesBelow(n, alpha, beta, c) >= 1)
+			b = c;
+		else
+			a = c;
+	}
+	lambda_min = 0.5 * (a + b);
+
+	// largest eigenvalue: smallest x with all eigenvalues below x
+	a = lo;
+	b = hi;
+	while (b - a > tol) {
+		const double c(0.5 * (a + b));
+		if (c <= a || c >= b)
+			break;
+		if (countEigenvaluesBelow(n, alpha, beta, c) >= n)
+			b = c;
+		else
+			a = c;
+	}
+	lambda_max = 0.5 * (a + b);
+}
+
+} // end namespace MathLib
@@ -0,0 +1,33 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file tridiagonalEigenvalues.h
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#ifndef TRIDIAGONALEIGENVALUES_H_
+#define TRIDIAGONALEIGENVALUES_H_
+
+namespace MathLib {
+
+/**
+ * Computes the smallest and the largest eigenvalue of the symmetric
+ * tridiagonal \f$n \times n\f$ matrix \f$T\f$ (for instance the matrix
+ * generated by the Lanczos process) by bisection using Sturm sequences.
+ * @param n number of rows / columns
+ * @param alpha the n diagonal entries of \f$T\f$
+ * @param beta the n-1 off diagonal entries of \f$T\f$
+ * @param lambda_min the smallest eigenvalue
+ * @param lambda_max the largest eigenvalue
+ */
+void tridiagonalExtremeEigenvalues(unsigned n, double const*const alpha,
+				double const*const beta, double &lambda_min, double &lambda_max);
+
+} // end namespace MathLib
+
+#endif /* TRIDIAGONALEIGENVALUES_H_ */
@@ -0,0 +1,195 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file BatchedGaussAlgorithm.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <cassert>
+#include <cmath>
+
+#include "BatchedGaussAlgorithm.h"
+#include "swap.h"
+
+namespace MathLib {
+
+const std::size_t BatchedGaussAlgorithm::LANES;
+
+BatchedGaussAlgorithm::BatchedGaussAlgorithm(std::size_t n, std::size_t n_matrices) :
+	_n(n), _n_matrices(n_matrices), _n_groups((n_matrices + LANES - 1) / LANES),
+	_mat(new double[_n_groups * _n * _n * LANES]), _perm(new unsigned[_n_groups * _n * LANES]),
+	_singular(new bool[_n_groups * LANES])
+{
+	for (std::size_t k(0); k < _n_groups * LANES; k++)
+		_singular[k] = false;
+
+	// identity matrices in the padding lanes of the last group
+	if (_n_matrices % LANES != 0) {
+		double* a(_mat + (_n_groups - 1) * _n * _n * LANES);
+		for (std::size_t i(0); i < _n; i++)
+			for (std::size_t j(0); j < _n; j++)
+				for (std::size_t l(_n_matrices % LANES); l < LANES; l++)
+					a[(i * _n + j) * LANES + l] = (i == j) ? 1.0 : 0.0;
+	}
+}
+
+BatchedGaussAlgorithm::~BatchedGaussAlgorithm()
+{
+	delete [] _mat;
+	delete [] _perm;
+	delete [] _singular;
+}
+
+void BatchedGaussAlgorithm::setMatrix(std::size_t e, double const*const a)
+{
+	double* const mat(_mat + (e / LANES) * _n * _n * LANES + e % LANES);
+	for (std::size_t k(0); k < _n * _n; k++)
+		mat[k * LANES] = a[k];
+}
+
+bool BatchedGaussAlgorithm::isSingular(std::size_t e) const
+{
+	assert(e < _n_matrices);
+	return _singular[e];
+}
+
+bool BatchedGaussAlgorithm::factorize()
+{
+	bool success(true);
+	OPENMP_LOOP_TYPE g;
+	const OPENMP_LOOP_TYPE n_groups(_n_groups);
+	#pragma omp parallel for schedule(static)
+	for (g = 0; g < n_groups; g++) {
+		if (!factorizeGroup(g)) {
+			#pragma omp critical (batched_gauss_singular)
+			success = false;
+		}
+	}
+	return success;
+}
+
+bool BatchedGaussAlgorithm::factorizeGroup(std::size_t g)
+{
+	const std::size_t n(_n);
+	double* const a(_mat + g * n * n * LANES);
+	unsigned* const perm(_perm + g * n * LANES);
+	bool* const singular(_singular + g * LANES);
+
+	double max_val[LANES];
+	unsigned p[LANES];
+	double d_inv[LANES];
+	double l_fac[LANES];
+
+	// the flags of a previous factorization are not valid for new matrices
+	for (std::size_t l(0); l < LANES; l++)
+		singular[l] = false;
+
+	for (std::size_t k(0); k < n; k++) {
+		// search pivots
+		double const*const akk(a + (k * n + k) * LANES);
+		for (std::size_t l(0); l < LANES; l++) {
+			max_val[l] = fabs(akk[l]);
+			p[l] = k;
+		}
+		for (std::size_t i(k + 1); i < n; i++) {
+			double const*const aik(a + (i * n + k) * LANES);
+			for (std::size_t l(0); l < LANES; l++) {
+				const double v(fabs(aik[l]));
+				if (v > max_val[l]) {
+					max_val[l] = v;
+					p[l] = i;
+				}
+			}
+		}
+
+		// exchange rows
+		for (std::size_t l(0); l < LANES; l++) {
+			perm[k * LANES + l] = p[l];
+			if (p[l] != k) {
+				for (std::size_t j(0); j < n; j++)
+					BaseLib::swap(a[(k * n + j) * LANES + l], a[(p[l] * n + j) * LANES + l]);
+			}
+			if (max_val[l] == 0.0) {
+				singular[l] = true;
+				d_inv[l] = 0.0;
+			} else {
+				d_inv[l] = 1.0 / akk[l];
+			}
+		}
+
+		// eliminate
+		for (std::size_t i(k + 1); i < n; i++) {
+			double* const ai(a + i * n * LANES);
+			for (std::size_t l(0); l < LANES; l++) {
+				l_fac[l] = ai[k * LANES + l] * d_inv[l];
+				ai[k * LANES + l] = l_fac[l];
+			}
+			for (std::size_t j(k + 1); j < n; j++) {
+				double const*const akj(a + (k * n + j) * LANES);
+				double* const aij(ai + j * LANES);
+				for (std::size_t l(0); l < LANES; l++)
+					aij[l] -= l_fac[l] * akj[l];
+			}
+		}
+	}
+
+	bool success(true);
+	for (std::size_t l(0); l < LANES; l++)
+		if (singular[l])
+			success = false;
+	return success;
+}
+
+void BatchedGaussAlgorithm::execute(double* b) const
+{
+	const std::size_t n(_n);
+	OPENMP_LOOP_TYPE g;
+	const OPENMP_LOOP_TYPE n_groups(_n_groups);
+	#pragma omp parallel for schedule(static)
+	for (g = 0; g < n_groups; g++) {
+		double const*const a(_mat + g * n * n * LANES);
+		unsigned const*const perm(_perm + g * n * LANES);
+		double* const x(b + g * n * LANES);
+
+		// permute the right hand sides
+		for (std::size_t k(0); k < n; k++) {
+			for (std::size_t l(0); l < LANES; l++) {
+				const std::size_t p(perm[k * LANES + l]);
+				if (p != k)
+					BaseLib::swap(x[k * LANES + l], x[p * LANES + l]);
+			}
+		}
+
+		// forward solve L z = b
+		for (std::size_t r(1); r < n; r++) {
+			double* const xr(x + r * LANES);
+			for (std::size_t c(0); c < r; c++) {
+				double const*const arc(a + (r * n + c) * LANES);
+				double const*const xc(x + c * LANES);
+				for (std::size_t l(0); l < LANES; l++)
+					xr[l] -= arc[l] * xc[l];
+			}
+		}
+
+		// backward solve U x = z
+		for (std::size_t r(n); r > 0; r--) {
+			double* const xr(x + (r - 1) * LANES);
+			for (std::size_t c(r); c < n; c++) {
+				double const*const arc(a + ((r - 1) * n + c) * LANES);
+				double const*const xc(x + c * LANES);
+				for (std::size_t l(0); l < LANES; l++)
+					xr[l] -= arc[l] * xc[l];
+			}
+			double const*const arr(a + ((r - 1) * n + r - 1) * LANES);
+			for (std::size_t l(0); l < LANES; l++)
+				xr[l] /= arr[l];
+		}
+	}
+}
+
+} // end namespace MathLib
@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file BatchedGaussAlgorithm.h
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#ifndef BATCHEDGAUSSALGORITHM_H_
+#define BATCHEDGAUSSALGORITHM_H_
+
+#include <cstddef>
+#include <cassert>
+
+#include "DenseDirectLinearSolver.h"
+
+namespace MathLib {
+
+/**
+ * BatchedGaussAlgorithm solves many small dense linear systems
+ * \f$A_e x_e = b_e\f$ of the same size n at once (for instance local systems
+ * of all elements or integration points). The matrices are stored
+ * interleaved: LANES consecutive matrices form a group, within a group the
+ * entry (i,j) of all LANES matrices is stored contiguously. Hence, all loops
+ * of the LU factorization (with partial pivoting) and the forward /
+ * backward substitution run over the lanes in the innermost loop and are
+ * vectorized by the compiler. The groups are processed in parallel (OpenMP).
+ *
+ * If the number of matrices is not a multiple of LANES the last group is
+ * padded with identity matrices.
+ */
+class BatchedGaussAlgorithm : public MathLib::DenseDirectLinearSolver
+{
+public:
+	/** number of interleaved matrices (SIMD lanes) */
+	static const std::size_t LANES = 8;
+
+	/**
+	 * @param n the number of rows / columns of every matrix
+	 * @param n_matrices the number of matrices / linear systems
+	 */
+	BatchedGaussAlgorithm(std::size_t n, std::size_t n_matrices);
+	virtual ~BatchedGaussAlgorithm();
+
+	std::size_t getMatrixSize() const { return _n; }
+	std::size_t getNMatrices() const { return _n_matrices; }
+
+	/** access to the entry (i,j) of matrix e (before factorize() was called) */
+	double& operator() (std::size_t e, std::size_t i, std::size_t j)
+	{
+		assert(e < _n_matrices && i < _n && j < _n);
+		return _mat[((e / LANES) * _n * _n + i * _n + j) * LANES + e % LANES];
+	}
+
+	/**
+	 * copies the entries of matrix e from the row wise stored array a
+	 */
+	void setMatrix(std::size_t e, double const*const a);
+
+	/**
+	 * Computes the LU factorizations with partial pivoting of all matrices.
+	 * @return false if at least one matrix is singular (see isSingular())
+	 */
+	bool factorize();
+
+	/** @return true if the matrix e was found to be singular by the last call of factorize() */
+	bool isSingular(std::size_t e) const;
+
+	/**
+	 * the size of a vector holding the right hand sides / solutions of all
+	 * systems in the interleaved layout
+	 */
+	std::size_t getVectorSize() const { return _n_groups * _n * LANES; }
+
+	/** position of entry i of right hand side / solution e in the interleaved vector */
+	std::size_t getVectorIndex(std::size_t e, std::size_t i) const
+	{
+		return ((e / LANES) * _n + i) * LANES + e % LANES;
+	}
+
+	/**
+	 * Solves all linear systems using the computed factorizations.
+	 * @param b at the beginning the right hand sides, at the end the
+	 * solutions, both in the interleaved layout (size getVectorSize())
+	 */
+	void execute(double* b) const;
+
+private:
+	BatchedGaussAlgorithm(BatchedGaussAlgorithm const&);
+	BatchedGaussAlgorithm& operator=(BatchedGaussAlgorithm const&);
+
+	/** factorization of the matrices of group g, returns false if singular */
+	bool factorizeGroup(std::size_t g);
+
+	/** the size of the matrices */
+	const std::size_t _n;
+	/** the number of matrices */
+	const std::size_t _n_matrices;
+	/** the number of groups of LANES matrices */
+	const std::size_t _n_groups;
+	/** the interleaved matrices, after factorization the LU factors */
+	double* _mat;
+	/** the interleaved row permutations */
+	unsigned* _perm;
+	/** flags for singular matrices */
+	bool* _singular;
+};
+
+} // end namespace MathLib
+
+#endif /* BATCHEDGAUSSALGORITHM_H_ */
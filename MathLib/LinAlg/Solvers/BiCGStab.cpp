@@ -14,10 +14,11 @@
 
 #include "MathTools.h"
 #include "blas.h"
+#include "vectorKernels.h"
 
 namespace MathLib {
 
-unsigned BiCGStab(CRSMatrix<double, unsigned> const& A, double* const b, double* const x,
+unsigned BiCGStab(LinearOperator<double> const& A, double* const b, double* const x,
 		double& eps, unsigned& nsteps)
 {
 	const unsigned N(A.getNRows());
@@ -32,15 +33,15 @@ unsigned BiCGStab(CRSMatrix<double, unsigned> const& A, double* const b, double*
 	double resid;
 
 	// normb = |b|
-	double nrmb = blas::nrm2(N, b);
+	double nrmb = VectorKernels::nrm2(N, b);
 	if (nrmb < D_PREC) nrmb = D_ONE;
 
 	// r = r0 = b - A x0
-	blas::copy(N, b, r0);
-	A.amux(D_MONE, x, r0);
-	blas::copy(N, r0, r);
+	A.amux(D_ONE, x, r0);
+	double rr(VectorKernels::waxpyDot(N, D_MONE, r0, b, r0));
+	VectorKernels::copy(N, r0, r);
 
-	resid = blas::nrm2(N, r) / nrmb;
+	resid = sqrt(rr) / nrmb;
 
 	if (resid < eps) {
 		eps = resid;
@@ -50,52 +51,40 @@ unsigned BiCGStab(CRSMatrix<double, unsigned> const& A, double* const b, double*
 	}
 
 	double alpha = D_ZERO, omega = D_ZERO, rho2 = D_ZERO;
+	// rho1 = r0 * r, later on computed together with the update of r
+	double rho1(rr);
 
 	for (unsigned l = 1; l <= nsteps; ++l) {
-		// rho1 = r0 * r
-		const double rho1 = blas::scpr(N, r0, r);
 		if (fabs(rho1) < D_PREC) {
-			eps = blas::nrm2(N, r) / nrmb;
+			eps = sqrt(rr) / nrmb;
 			delete[] v;
 			return 2;
 		}
 
 		if (l == 1)
-			blas::copy(N, r, p); // p = r
+			VectorKernels::copy(N, r, p); // p = r
 		else {
-//			blas::axpy(N, -omega, v, p); // p = (p-omega v)*beta+r
 			const double beta = rho1 * alpha / (rho2 * omega);
-//			blas::scal(N, beta, p);
-//			blas::axpy(N, D_ONE, r, p);
 			// p = (p-omega v)*beta+r
-			for (unsigned k(0); k<N; k++) {
-				p[k] = (p[k] - omega * v[k]) * beta + r[k];
-			}
+			VectorKernels::updateBiCGStabDirection(N, beta, omega, v, r, p);
 		}
 
 		// p^ = C p
-		blas::copy(N, p, phat);
+		VectorKernels::copy(N, p, phat);
 		A.precondApply(phat);
 		// v = A p^
-		blas::setzero(N, v);
 		A.amux(D_ONE, phat, v);
 
-		alpha = rho1 / blas::scpr(N, r0, v);
+		alpha = rho1 / VectorKernels::dot(N, r0, v);
 
 		// s = r - alpha v
-//		blas::copy(N, r, s);
-//		blas::axpy(N, -alpha, v, s);
-		for (unsigned k(0); k<N; k++) {
-			s[k] = r[k] - alpha * v[k];
-		}
-
-		resid = blas::nrm2(N, s) / nrmb;
+		resid = sqrt(VectorKernels::waxpyDot(N, -alpha, v, r, s)) / nrmb;
 #ifndef NDEBUG
 		std::cout << "Step " << l << ", resid=" << resid << std::endl;
 #endif
 		if (resid < eps) {
 			// x += alpha p^
-			blas::axpy(N, alpha, phat, x);
+			VectorKernels::axpy(N, alpha, phat, x);
 			eps = resid;
 			nsteps = l;
 			delete[] v;
@@ -103,27 +92,23 @@ unsigned BiCGStab(CRSMatrix<double, unsigned> const& A, double* const b, double*
 		}
 
 		// s^ = C s
-		blas::copy(N, s, shat);
+		VectorKernels::copy(N, s, shat);
 		A.precondApply(shat);
 
 		// t = A s^
-		blas::setzero(N, t);
 		A.amux(D_ONE, shat, t);
 
 		// omega = t*s / t*t
-		omega = blas::scpr(N, t, s) / blas::scpr(N, t, t);
-
-		// x += alpha p^ + omega s^
-		blas::axpy(N, alpha, phat, x);
-		blas::axpy(N, omega, shat, x);
-
-		// r = s - omega t
-		blas::copy(N, s, r);
-		blas::axpy(N, -omega, t, r);
+		double ts, tt;
+		VectorKernels::dot2(N, t, s, t, ts, tt);
+		omega = ts / tt;
 
 		rho2 = rho1;
 
-		resid = blas::nrm2(N, r) / nrmb;
+		// x += alpha p^ + omega s^, r = s - omega t, rho1 = r0 * r
+		VectorKernels::updateBiCGStab(N, alpha, phat, omega, shat, s, t, r0, x, r, rr, rho1);
+
+		resid = sqrt(rr) / nrmb;
 
 		if (resid < eps) {
 			eps = resid;
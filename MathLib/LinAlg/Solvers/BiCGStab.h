@@ -13,13 +13,11 @@
 #ifndef BICGSTAB_H_
 #define BICGSTAB_H_
 
-#include "blas.h"
-#include "../Sparse/CRSMatrix.h"
-#include "../Sparse/CRSMatrixDiagPrecond.h"
+#include "../LinearOperator.h"
 
 namespace MathLib {
 
-unsigned BiCGStab(CRSMatrix<double, unsigned> const& A, double* const b, double* const x,
+unsigned BiCGStab(LinearOperator<double> const& A, double* const b, double* const x,
                   double& eps, unsigned& nsteps);
 
 } // end namespace MathLib
@@ -0,0 +1,167 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file BiCGStabL.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#ifndef NDEBUG
+#include <iostream>
+#endif
+
+#include "BiCGStabL.h"
+
+#include "GaussAlgorithm.h"
+#include "blas.h"
+#include "vectorKernels.h"
+
+namespace MathLib {
+
+namespace {
+
+/** w = A C v, where C is the preconditioner, tmp is a work vector */
+inline void applyPreconditionedMatrix(LinearOperator<double> const& A, unsigned n,
+		double const*const v, double* tmp, double* w)
+{
+	VectorKernels::copy(n, v, tmp);
+	A.precondApply(tmp);
+	A.amux(D_ONE, tmp, w);
+}
+
+/** x = x + C xhat, xhat is destroyed */
+inline void addPreconditionedCorrection(LinearOperator<double> const& A, unsigned n,
+		double* xhat, double* x)
+{
+	A.precondApply(xhat);
+	VectorKernels::axpy(n, D_ONE, xhat, x);
+}
+
+} // end anonymous namespace
+
+unsigned BiCGStabL(LinearOperator<double> const& A, double const*const b, double* const x,
+		unsigned l, double& eps, unsigned& nsteps)
+{
+	l = std::max(1u, std::min(l, 8u));
+	const unsigned N(A.getNRows());
+	// R[0], ..., R[l], U[0], ..., U[l], r tilde, x hat, work vector
+	double* const v(new double[(2 * l + 5) * N]);
+	double* R[9];
+	double* U[9];
+	for (unsigned j(0); j <= l; j++) {
+		R[j] = v + j * N;
+		U[j] = v + (l + 1 + j) * N;
+	}
+	double* const rt(v + (2 * l + 2) * N);
+	double* const xhat(rt + N);
+	double* const tmp(xhat + N);
+	const unsigned max_steps(nsteps);
+
+	double nrmb(VectorKernels::nrm2(N, b));
+	if (nrmb < D_PREC) nrmb = D_ONE;
+
+	// r = b - A x
+	A.amux(D_ONE, x, R[0]);
+	double resid(sqrt(VectorKernels::waxpyDot(N, D_MONE, R[0], b, R[0])) / nrmb);
+	nsteps = 0;
+	if (resid < eps) {
+		eps = resid;
+		delete [] v;
+		return 0;
+	}
+	VectorKernels::copy(N, R[0], rt);
+	const double nrm_rt(VectorKernels::nrm2(N, rt));
+	VectorKernels::setZero(N, U[0]);
+	VectorKernels::setZero(N, xhat);
+
+	std::vector<double> G((l + 1) * (l + 1));
+	Matrix<double> Z(l, l);
+	std::vector<double> gamma(l + 1);
+	double rho0(D_ONE), alpha(D_ZERO), omega(D_ONE);
+	unsigned ret(1);
+
+	while (nsteps + 2 * l <= max_steps) {
+		rho0 *= -omega;
+
+		// BiCG part, the breakdown tests are relative to the norms of the vectors
+		for (unsigned j(0); j < l; j++) {
+			double rho1, rjrj;
+			VectorKernels::dot2(N, R[j], rt, R[j], rho1, rjrj);
+			if (fabs(rho1) < D_PREC * sqrt(rjrj) * nrm_rt) {
+				ret = 2;
+				break;
+			}
+			const double beta(alpha * rho1 / rho0);
+			rho0 = rho1;
+			// u_i = r_i - beta u_i
+			for (unsigned i(0); i <= j; i++)
+				VectorKernels::xpay(N, R[i], -beta, U[i]);
+			applyPreconditionedMatrix(A, N, U[j], tmp, U[j + 1]);
+			nsteps++;
+			double sigma, uu;
+			VectorKernels::dot2(N, U[j + 1], rt, U[j + 1], sigma, uu);
+			if (fabs(sigma) < D_PREC * sqrt(uu) * nrm_rt) {
+				ret = 2;
+				break;
+			}
+			alpha = rho0 / sigma;
+			// r_i = r_i - alpha u_{i+1}
+			for (unsigned i(0); i <= j; i++)
+				VectorKernels::axpy(N, -alpha, U[i + 1], R[i]);
+			applyPreconditionedMatrix(A, N, R[j], tmp, R[j + 1]);
+			nsteps++;
+			VectorKernels::axpy(N, alpha, U[0], xhat);
+		}
+		if (ret == 2)
+			break;
+
+		// minimal residual part: min || r_0 - sum_j gamma_j r_j ||
+		VectorKernels::gram(N, l + 1, R, &G[0]);
+		for (unsigned i(0); i < l; i++) {
+			for (unsigned j(0); j < l; j++)
+				Z(i, j) = G[(i + 1) * (l + 1) + j + 1];
+			gamma[i + 1] = G[(i + 1) * (l + 1)];
+		}
+		GaussAlgorithm lu(Z);
+		lu.execute(&gamma[1]);
+		omega = gamma[l];
+
+		const double rr(VectorKernels::updateBiCGStabL(N, l, &gamma[0], R, U, xhat));
+		if (rr != rr) {
+			// the Gram matrix is singular
+			ret = 3;
+			break;
+		}
+		resid = sqrt(rr) / nrmb;
+#ifndef NDEBUG
+		std::cout << "Step " << nsteps << ", resid=" << resid << std::endl;
+#endif
+		if (resid < eps) {
+			ret = 0;
+			break;
+		}
+		if (fabs(omega) < D_PREC) {
+			ret = 3;
+			break;
+		}
+	}
+
+	addPreconditionedCorrection(A, N, xhat, x);
+	if (ret == 2 || ret == 3) {
+		// the current residual norm
+		A.amux(D_ONE, x, tmp);
+		resid = sqrt(VectorKernels::waxpyDot(N, D_MONE, tmp, b, tmp)) / nrmb;
+	}
+	eps = resid;
+	delete [] v;
+	return ret;
+}
+
+} // end namespace MathLib
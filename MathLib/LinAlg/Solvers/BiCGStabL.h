@@ -0,0 +1,50 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file BiCGStabL.h
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#ifndef BICGSTABL_H_
+#define BICGSTABL_H_
+
+#include "../LinearOperator.h"
+
+namespace MathLib {
+
+/**
+ * BiCGStab(l) method of Sleijpen and Fokkema for nonsymmetric systems. Every
+ * cycle consists of l BiCG steps followed by a minimal residual polynomial
+ * of degree l (instead of degree one in BiCGStab). For convection dominated
+ * problems, where the eigenvalues of the matrix are close to the imaginary
+ * axis, BiCGStab stagnates since the minimal residual step of degree one
+ * almost vanishes, the polynomials of higher degree avoid this.
+ *
+ * The system is preconditioned from the right with A.precondApply(). The
+ * minimal residual polynomial is computed from the Gram matrix of the
+ * residuals (one fused pass over the l+1 vectors), the updates of x, r and u
+ * at the end of a cycle are fused to one pass as well.
+ * @param A the matrix
+ * @param b the right hand side
+ * @param x (input) the start vector, (output) the solution
+ * @param l degree of the minimal residual polynomials (1 <= l <= 8), l = 1
+ * is mathematically equivalent to BiCGStab
+ * @param eps (input) relative tolerance of the residual norm, (output) the
+ * achieved relative residual norm
+ * @param nsteps (input) maximal number of matrix vector multiplications,
+ * (output) the number of matrix vector multiplications performed
+ * @return 0 if the method converged, 1 if the maximal number of steps is
+ * reached, 2 in case of a breakdown of the BiCG part, 3 in case of a
+ * breakdown of the minimal residual part
+ */
+unsigned BiCGStabL(LinearOperator<double> const& A, double const*const b, double* const x,
+		unsigned l, double& eps, unsigned& nsteps);
+
+} // end namespace MathLib
+
+#endif /* BICGSTABL_H_ */
@@ -14,8 +14,8 @@
 
 #include "MathTools.h"
 #include "blas.h"
-#include "../Sparse/CRSMatrix.h"
-#include "../Sparse/CRSMatrixDiagPrecond.h"
+#include "vectorKernels.h"
+#include "../LinearOperator.h"
 
 // CG solves the symmetric positive definite linear
 // system Ax=b using the Conjugate Gradient method.
@@ -32,7 +32,7 @@
 
 namespace MathLib {
 
-unsigned CG(CRSMatrix<double,unsigned> const * mat, double const * const b,
+unsigned CG(LinearOperator<double> const * mat, double const * const b,
 		double* const x, double& eps, unsigned& nsteps)
 {
 	unsigned N = mat->getNRows();
@@ -43,9 +43,9 @@ unsigned CG(CRSMatrix<double,unsigned> const * mat, double const * const b,
 	r = q + N;
 	rhat = r + N;
 
-	double nrmb = sqrt(scpr(b, b, N));
+	double nrmb = VectorKernels::nrm2(N, b);
 	if (nrmb < std::numeric_limits<double>::epsilon()) {
-		blas::setzero(N, x);
+		VectorKernels::setZero(N, x);
 		eps = 0.0;
 		nsteps = 0;
 		delete[] p;
@@ -53,12 +53,8 @@ unsigned CG(CRSMatrix<double,unsigned> const * mat, double const * const b,
 	}
 
 	// r0 = b - Ax0
-	mat->amux(D_MONE, x, r);
-	for (unsigned k(0); k < N; k++) {
-		r[k] = b[k] - r[k];
-	}
-
-	double resid = blas::nrm2(N, r);
+	mat->amux(D_ONE, x, r);
+	double resid = sqrt(VectorKernels::waxpyDot(N, D_MONE, r, b, r));
 	if (resid <= eps * nrmb) {
 		eps = resid / nrmb;
 		nsteps = 0;
@@ -71,35 +67,25 @@ unsigned CG(CRSMatrix<double,unsigned> const * mat, double const * const b,
 		std::cout << "Step " << l << ", resid=" << resid / nrmb << std::endl;
 #endif
 		// r^ = C r
-		blas::copy(N, r, rhat);
+		VectorKernels::copy(N, r, rhat);
 		mat->precondApply(rhat);
 
 		// rho = r * r^;
-		rho = scpr(r, rhat, N); // num_threads);
+		rho = VectorKernels::dot(N, r, rhat);
 
 		if (l > 1) {
-			double beta = rho / rho1;
 			// p = r^ + beta * p
-			unsigned k;
-			for (k = 0; k < N; k++) {
-				p[k] = rhat[k] + beta * p[k];
-			}
-		} else blas::copy(N, rhat, p);
+			VectorKernels::xpay(N, rhat, rho / rho1, p);
+		} else VectorKernels::copy(N, rhat, p);
 
 		// q = Ap
-		blas::setzero(N, q);
 		mat->amux(D_ONE, p, q);
 
 		// alpha = rho / p*q
-		double alpha = rho / scpr(p, q, N);
-
-		// x += alpha * p
-		blas::axpy(N, alpha, p, x);
-
-		// r -= alpha * q
-		blas::axpy(N, -alpha, q, r);
+		double alpha = rho / VectorKernels::dot(N, p, q);
 
-		resid = sqrt(scpr(r, r, N));
+		// x += alpha * p, r -= alpha * q
+		resid = sqrt(VectorKernels::updateCG(N, alpha, p, q, x, r));
 
 		if (resid <= eps * nrmb) {
 			eps = resid / nrmb;
@@ -16,13 +16,13 @@
 namespace MathLib {
 
 // forward declaration
-template <typename PF_TYPE, typename IDX_TYPE> class CRSMatrix;
+template <typename FP_TYPE> class LinearOperator;
 
-unsigned CG(CRSMatrix<double,unsigned> const * mat, double const * const b,
+unsigned CG(LinearOperator<double> const * mat, double const * const b,
 		double* const x, double& eps, unsigned& nsteps);
 
 #ifdef _OPENMP
-unsigned CGParallel(CRSMatrix<double,unsigned> const * mat, double const * const b,
+unsigned CGParallel(LinearOperator<double> const * mat, double const * const b,
 		double* const x, double& eps, unsigned& nsteps);
 #endif
 
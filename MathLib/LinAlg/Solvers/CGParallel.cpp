@@ -18,8 +18,9 @@
 
 #include "MathTools.h"
 #include "blas.h"
-#include "../Sparse/CRSMatrix.h"
-#include "../Sparse/CRSMatrixDiagPrecond.h"
+#include "vectorKernels.h"
+#include "../firstTouch.h"
+#include "../LinearOperator.h"
 
 // CG solves the symmetric positive definite linear
 // system Ax=b using the Conjugate Gradient method.
@@ -37,33 +38,33 @@
 namespace MathLib {
 
 #ifdef _OPENMP
-unsigned CGParallel(CRSMatrix<double,unsigned> const * mat, double const * const b,
+unsigned CGParallel(LinearOperator<double> const * mat, double const * const b,
 		double* const x, double& eps, unsigned& nsteps)
 {
 	const unsigned N(mat->getNRows());
-	double * __restrict__ p(new double[N]);
-	double * __restrict__ q(new double[N]);
-	double * __restrict__ r(new double[N]);
-	double * __restrict__ rhat(new double[N]);
+	// the vectors are distributed over the NUMA nodes like the rows of the matrix
+	double * __restrict__ p(newFirstTouch<double>(N));
+	double * __restrict__ q(newFirstTouch<double>(N));
+	double * __restrict__ r(newFirstTouch<double>(N));
+	double * __restrict__ rhat(newFirstTouch<double>(N));
 	double rho, rho1 = 0.0;
 
-	double nrmb = sqrt(scpr(b, b, N));
+	double nrmb = VectorKernels::nrm2(N, b);
 
 	if (nrmb < std::numeric_limits<double>::epsilon()) {
-		blas::setzero(N, x);
+		VectorKernels::setZero(N, x);
 		eps = 0.0;
 		nsteps = 0;
 		delete[] p;
+		delete[] q;
+		delete[] r;
+		delete[] rhat;
 		return 0;
 	}
 
 	// r0 = b - Ax0
-	mat->amux(D_MONE, x, r);
-	for (unsigned k(0); k < N; k++) {
-		r[k] = b[k] - r[k];
-	}
-
-	double resid = blas::nrm2(N, r);
+	mat->amux(D_ONE, x, r);
+	double resid = sqrt(VectorKernels::waxpyDot(N, D_MONE, r, b, r));
 	if (resid <= eps * nrmb) {
 		eps = resid / nrmb;
 		nsteps = 0;
@@ -74,63 +75,33 @@ unsigned CGParallel(CRSMatrix<double,unsigned> const * mat, double const * const
 		return 0;
 	}
 
-	OPENMP_LOOP_TYPE k;
 	for (unsigned l = 1; l <= nsteps; ++l) {
 #ifndef NDEBUG
 		std::cout << "Step " << l << ", resid=" << resid / nrmb << std::endl;
 #endif
 
 		// r^ = C r
-		// rhat = r
-//		blas::copy(N, r, rhat);
-		#pragma omp parallel for
-		for (k = 0; k < N; k++) {
-			rhat[k] = r[k];
-		}
+		VectorKernels::copy(N, r, rhat);
 		mat->precondApply(rhat);
 
 		// rho = r * r^;
-		rho = scpr(r, rhat, N);
+		rho = VectorKernels::dot(N, r, rhat);
 
 		if (l > 1) {
-			double beta = rho / rho1;
 			// p = r^ + beta * p
-			#pragma omp parallel for
-			for (k = 0; k < N; k++) {
-				p[k] = rhat[k] + beta * p[k];
-			}
+			VectorKernels::xpay(N, rhat, rho / rho1, p);
 		} else {
-//				blas::copy(N, rhat, p);
-			#pragma omp parallel for
-			for (k = 0; k < N; k++) {
-				p[k] = rhat[k];
-			}
+			VectorKernels::copy(N, rhat, p);
 		}
 
 		// q = Ap
 		mat->amux(D_ONE, p, q);
 
 		// alpha = rho / p*q
-		double alpha = rho / scpr(p, q, N);
-
-		#pragma omp parallel
-		{
-			// x += alpha * p
-			#pragma omp for nowait
-			for (k = 0; k < N; k++) {
-				x[k] += alpha * p[k];
-			}
-
-			// r -= alpha * q
-			#pragma omp for nowait
-			for (k = 0; k < N; k++) {
-				r[k] -= alpha * q[k];
-			}
-
-			#pragma omp barrier
-		} // end #pragma omp parallel
-
-		resid = sqrt(scpr(r, r, N));
+		double alpha = rho / VectorKernels::dot(N, p, q);
+
+		// x += alpha * p, r -= alpha * q
+		resid = sqrt(VectorKernels::updateCG(N, alpha, p, q, x, r));
 
 		if (resid <= eps * nrmb) {
 			eps = resid / nrmb;
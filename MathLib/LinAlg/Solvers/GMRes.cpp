@@ -13,8 +13,10 @@
 #include "GMRes.h"
 
 #include <cmath>
+#include <iostream>
 #include <limits>
 #include "blas.h"
+#include "vectorKernels.h"
 
 namespace MathLib {
 
@@ -42,7 +44,7 @@ inline void applPlRot(double& dx, double& dy, double cs, double sn)
 }
 
 // solve H y = s and update x += MVy
-static void update(const CRSMatrix<double,unsigned>& A, unsigned k, double* H,
+static void update(const LinearOperator<double>& A, unsigned k, double* H,
 		unsigned ldH, double* s, double* V, double* x)
 {
 	const size_t n(A.getNRows());
@@ -58,13 +60,13 @@ static void update(const CRSMatrix<double,unsigned>& A, unsigned k, double* H,
 	blas::setzero(n, xh);
 	blas::gemva(n, k, D_ONE, V, y, xh);
 	A.precondApply(xh);
-	blas::add(n, xh, x);
+	VectorKernels::axpy(n, D_ONE, xh, x);
 
 	delete[] xh;
 	delete[] y;
 }
 
-unsigned GMRes(const CRSMatrix<double,unsigned>& A, double* const b, double* const x,
+unsigned GMRes(const LinearOperator<double>& A, double* const b, double* const x,
 		double& eps, unsigned m, unsigned& nsteps)
 {
 	double resid;
@@ -81,9 +83,9 @@ unsigned GMRes(const CRSMatrix<double,unsigned>& A, double* const b, double* con
 	double *xh = s + m + 1; // m+1
 
 	// normb = norm(b)
-	double normb = blas::nrm2(n, b);
+	double normb = VectorKernels::nrm2(n, b);
 	if (normb == 0.0) {
-		blas::setzero(n, x);
+		VectorKernels::setZero(n, x);
 		eps = 0.0;
 		nsteps = 0;
 		delete[] r;
@@ -91,10 +93,8 @@ unsigned GMRes(const CRSMatrix<double,unsigned>& A, double* const b, double* con
 	}
 
 	// r = b - Ax
-	blas::copy(n, b, r);
-	A.amux(D_MONE, x, r);
-
-	double beta = blas::nrm2(n, r);
+	A.amux(D_ONE, x, r);
+	double beta = sqrt(VectorKernels::waxpyDot(n, D_MONE, r, b, r));
 
 	if ((resid = beta / normb) <= eps) {
 		eps = resid;
@@ -104,8 +104,8 @@ unsigned GMRes(const CRSMatrix<double,unsigned>& A, double* const b, double* con
 	}
 
 	while (j <= nsteps) {
-		blas::copy(n, r, V); // v0 first orthonormal vector
-		blas::scal(n, 1.0 / beta, V);
+		VectorKernels::copy(n, r, V); // v0 first orthonormal vector
+		VectorKernels::scal(n, 1.0 / beta, V);
 
 		s[0] = beta;
 		blas::setzero(m, s + 1);
@@ -113,18 +113,23 @@ unsigned GMRes(const CRSMatrix<double,unsigned>& A, double* const b, double* con
 		for (unsigned i = 0; i < m && j <= nsteps; i++, j++) {
 
 			// w = A M * v[i];
-			blas::copy(n, V + i * n, xh);
+			double* const w(V + (i + 1) * n);
+			VectorKernels::copy(n, V + i * n, xh);
 			A.precondApply(xh);
-			blas::setzero(n, V + (i + 1) * n);
-			A.amux(D_ONE, xh, V + (i + 1) * n);
+			A.amux(D_ONE, xh, w);
 
+			// modified Gram-Schmidt, the update of w with v[k] is fused with
+			// the scalar product of w and v[k+1] (or with |w|^2 for k = i)
+			H[i * (m + 1)] = VectorKernels::dot(n, w, V);
 			for (unsigned k = 0; k <= i; k++) {
-				H[k + i * (m + 1)] = blas::scpr(n, V + (i + 1) * n, V + k * n);
-				blas::axpy(n, -H[k + i * (m + 1)], V + k * n, V + (i + 1) * n);
+				double const*const z((k < i) ? V + (k + 1) * n : w);
+				const double wz(VectorKernels::axpyDot(n, -H[k + i * (m + 1)], V + k * n, w, z));
+				if (k < i)
+					H[k + 1 + i * (m + 1)] = wz;
+				else
+					H[i * (m + 2) + 1] = sqrt(wz);
 			}
-
-			H[i * (m + 2) + 1] = blas::nrm2(n, V + (i + 1) * n);
-			blas::scal(n, 1.0 / H[i * (m + 2) + 1], V + (i + 1) * n);
+			VectorKernels::scal(n, 1.0 / H[i * (m + 2) + 1], w);
 
 			// apply old Givens rotations to the last column in H
 			for (unsigned k = 0; k < i; k++)
@@ -152,9 +157,8 @@ unsigned GMRes(const CRSMatrix<double,unsigned>& A, double* const b, double* con
 		update(A, m, H, m + 1, s, V, x);
 
 		// r = b - A x;
-		blas::copy(n, b, r);
-		A.amux(D_MONE, x, r);
-		beta = blas::nrm2(n, r);
+		A.amux(D_ONE, x, r);
+		beta = sqrt(VectorKernels::waxpyDot(n, D_MONE, r, b, r));
 
 		if ((resid = beta / normb) < eps) {
 			eps = resid;
@@ -13,11 +13,11 @@
 #ifndef GMRES_H_
 #define GMRES_H_
 
-#include "../Sparse/CRSMatrix.h"
+#include "../LinearOperator.h"
 
 namespace MathLib {
 
-unsigned GMRes(const CRSMatrix<double,unsigned>& mat, double* const b, double* const x,
+unsigned GMRes(const LinearOperator<double>& mat, double* const b, double* const x,
                         double& eps, unsigned m, unsigned& steps);
 
 } // end namespace MathLib
@@ -11,41 +11,76 @@
  */
 
 #include <cmath>
+#include <algorithm>
 #include "GaussAlgorithm.h"
+#include "../Dense/denseKernels.h"
 #include "swap.h"
 
 namespace MathLib {
 
+const size_t GaussAlgorithm::BLOCK_SIZE = 64;
+
 GaussAlgorithm::GaussAlgorithm (Matrix <double> &A) :
 	_mat (A), _n(_mat.getNRows()), _perm (new size_t [_n])
 {
-	size_t k, i, j, nr (_mat.getNRows()), nc(_mat.getNCols());
-	double l;
+	const size_t nr (_mat.getNRows()), nc(_mat.getNCols());
+	double* const a (_mat.getEntryArray());
+
+	// blocked right looking LU factorization with partial pivoting
+	for (size_t kb=0; kb<nc; kb+=BLOCK_SIZE) {
+		const size_t ke (std::min(kb+BLOCK_SIZE, nc));
 
-	for (k=0; k<nc; k++) {
-		// search pivot
-		double t = fabs(_mat(k, k));
-		_perm[k] = k;
-		for (i=k+1; i<nr; i++) {
-			if (fabs(_mat(i,k)) > t) {
-				t = _mat(i,k);
-				_perm[k] = i;
+		// factorize the panel (columns kb, ..., ke-1)
+		for (size_t k=kb; k<ke; k++) {
+			// search pivot
+			double t = fabs(a[k*nc+k]);
+			_perm[k] = k;
+			for (size_t i=k+1; i<nr; i++) {
+				if (fabs(a[i*nc+k]) > t) {
+					t = fabs(a[i*nc+k]);
+					_perm[k] = i;
+				}
+			}
+
+			// exchange rows
+			if (_perm[k] != k) {
+				double* const row_k (a + k*nc);
+				double* const row_p (a + _perm[k]*nc);
+				for (size_t j=0; j<nc; j++) BaseLib::swap (row_p[j], row_k[j]);
 			}
-		}
 
-		// exchange rows
-		if (_perm[k] != k) {
-			for (j=0; j<nc; j++) BaseLib::swap (_mat(_perm[k],j), _mat(k,j));
+			// eliminate within the panel
+			double const* const row_k (a + k*nc);
+			const double d (row_k[k]);
+			for (size_t i=k+1; i<nr; i++) {
+				double* const row_i (a + i*nc);
+				const double l (row_i[k] / d);
+				for (size_t j=k+1; j<ke; j++) {
+					row_i[j] -= row_k[j] * l;
+				}
+				row_i[k] = l;
+			}
 		}
 
-		// eliminate
-		for (i=k+1; i<nr; i++) {
-			l=_mat(i,k)/_mat(k,k);
-			for (j=k; j<nc; j++) {
-				_mat(i,j) -= _mat(k,j) * l;
+		if (ke == nc)
+			break;
+
+		// U12 = L11^{-1} A12
+		for (size_t k=kb; k<ke; k++) {
+			double const* const row_k (a + k*nc);
+			for (size_t i=k+1; i<ke; i++) {
+				double* const row_i (a + i*nc);
+				const double l (row_i[k]);
+				for (size_t j=ke; j<nc; j++) {
+					row_i[j] -= row_k[j] * l;
+				}
 			}
-			_mat(i,k) = l;
 		}
+
+		// A22 = A22 - L21 U12
+		if (ke < nr)
+			MathLib::gemm (nr-ke, nc-ke, ke-kb, -1.0, a + ke*nc + kb, nc,
+					a + kb*nc + ke, nc, a + ke*nc + ke, nc);
 	}
 }
 
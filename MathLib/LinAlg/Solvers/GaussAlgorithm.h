@@ -27,6 +27,11 @@ namespace MathLib {
  * Gauss-Elimination with partial pivoting (rows are exchanged). In doing so
  * the entries of A change! The solution for a specific
  * right hand side is computed by the method execute().
+ *
+ * The elimination is blocked (right looking): a panel of BLOCK_SIZE columns
+ * is factorized, the corresponding block row of U is computed by a triangular
+ * solve and the trailing matrix is updated by a cache blocked matrix matrix
+ * multiplication (see gemm()).
  */
 class GaussAlgorithm : public MathLib::DenseDirectLinearSolver {
 public:
@@ -60,6 +65,11 @@ private:
 	 */
 	void permuteRHS (double* b) const;
 
+	/**
+	 * the number of columns of a panel in the blocked factorization
+	 */
+	static const size_t BLOCK_SIZE;
+
 	/**
 	 * a reference to the matrix
 	 */
@@ -0,0 +1,229 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file IDRs.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#ifndef NDEBUG
+#include <iostream>
+#endif
+
+#include "IDRs.h"
+
+#include "blas.h"
+#include "vectorKernels.h"
+
+namespace MathLib {
+
+namespace {
+
+/**
+ * Initializes the shadow vectors with pseudo random numbers and
+ * orthonormalizes them. The seed is advanced, i.e. a further call yields a
+ * new shadow space, the iteration is reproducible nevertheless.
+ */
+void initShadowSpace(unsigned n, unsigned s, double* const*const P, unsigned &seed)
+{
+	for (unsigned k(0); k < s; k++) {
+		for (unsigned i(0); i < n; i++) {
+			seed = 1664525u * seed + 1013904223u;
+			P[k][i] = static_cast<double>(seed) / 4294967296.0 - 0.5;
+		}
+		for (unsigned j(0); j < k; j++)
+			VectorKernels::axpy(n, -VectorKernels::dot(n, P[j], P[k]), P[j], P[k]);
+		VectorKernels::scal(n, D_ONE / VectorKernels::nrm2(n, P[k]), P[k]);
+	}
+}
+
+} // end anonymous namespace
+
+unsigned IDRs(LinearOperator<double> const& A, double const*const b, double* const x,
+		unsigned s, double& eps, unsigned& nsteps)
+{
+	s = std::max(1u, std::min(s, 16u));
+	const unsigned N(A.getNRows());
+	// P[0], ..., P[s-1], G[0], ..., G[s-1], U[0], ..., U[s-1], r, v, t
+	double* const work(new double[(3 * s + 3) * N]);
+	std::vector<double*> P(s), G(s), U(s);
+	for (unsigned k(0); k < s; k++) {
+		P[k] = work + k * N;
+		G[k] = work + (s + k) * N;
+		U[k] = work + (2 * s + k) * N;
+	}
+	double* const r(work + 3 * s * N);
+	double* v(r + N);
+	double* const t(v + N);
+	const unsigned max_steps(nsteps);
+
+	double nrmb(VectorKernels::nrm2(N, b));
+	if (nrmb < D_PREC) nrmb = D_ONE;
+
+	// r = b - A x
+	A.amux(D_ONE, x, r);
+	double rr(VectorKernels::waxpyDot(N, D_MONE, r, b, r));
+	double resid(sqrt(rr) / nrmb);
+	nsteps = 0;
+	if (resid < eps) {
+		eps = resid;
+		delete [] work;
+		return 0;
+	}
+
+	unsigned seed(12345u);
+	// M = P^T G, lower triangular, row wise
+	std::vector<double> M(s * s);
+	std::vector<double> f(s), c(s), alpha(s), m(s + 1);
+	// the shadow vectors followed by a slot for G(:,k)
+	std::vector<double const*> PG(P.begin(), P.end());
+	PG.push_back(NULL);
+	double om(D_ONE);
+	unsigned ret(1);
+	// a breakdown (P(:,k)^T G(:,k) = 0) restarts the method with a new shadow
+	// space, a second breakdown before a cycle is completed is reported
+	bool restart(true), cycle_completed(true);
+
+	while (nsteps + s + 1 <= max_steps) {
+		if (restart) {
+			if (!cycle_completed) {
+				ret = 2;
+				break;
+			}
+			initShadowSpace(N, s, &P[0], seed);
+			for (unsigned k(0); k < s; k++) {
+				VectorKernels::setZero(N, G[k]);
+				VectorKernels::setZero(N, U[k]);
+			}
+			std::fill(M.begin(), M.end(), 0.0);
+			for (unsigned k(0); k < s; k++)
+				M[k * s + k] = D_ONE;
+			om = D_ONE;
+			if (nsteps > 0) {
+				// replace the recursively updated residual by the true residual
+				A.amux(D_ONE, x, r);
+				rr = VectorKernels::waxpyDot(N, D_MONE, r, b, r);
+				resid = sqrt(rr) / nrmb;
+				nsteps++;
+#ifndef NDEBUG
+				std::cout << "Step " << nsteps << ", restart with a new shadow space, resid=" << resid << std::endl;
+#endif
+				if (resid < eps) {
+					ret = 0;
+					break;
+				}
+			}
+			restart = false;
+			cycle_completed = false;
+		}
+
+		// f = P^T r
+		VectorKernels::mdot(N, s, r, &P[0], &f[0]);
+
+		for (unsigned k(0); k < s; k++) {
+			// M(k:s, k:s) c = f(k:s)
+			for (unsigned i(k); i < s; i++) {
+				double ci(f[i]);
+				for (unsigned j(k); j < i; j++)
+					ci -= M[i * s + j] * c[j - k];
+				c[i - k] = ci / M[i * s + i];
+			}
+			// v = C (r - G(:, k:s) c)
+			for (unsigned i(0); i < s - k; i++)
+				alpha[i] = -c[i];
+			VectorKernels::copy(N, r, v);
+			VectorKernels::maxpy(N, s - k, &alpha[0], &G[k], v);
+			A.precondApply(v);
+			// U(:,k) = om v + U(:, k:s) c, the old U(:,k) becomes the new work vector
+			VectorKernels::scal(N, om, v);
+			VectorKernels::maxpy(N, s - k, &c[0], &U[k], v);
+			std::swap(U[k], v);
+			A.amux(D_ONE, U[k], G[k]);
+			nsteps++;
+
+			// biorthogonalize G(:,k) against P(:, 0:k)
+			if (k > 0) {
+				VectorKernels::mdot(N, k, G[k], &P[0], &m[0]);
+				for (unsigned i(0); i < k; i++) {
+					double ai(m[i]);
+					for (unsigned j(0); j < i; j++)
+						ai -= M[i * s + j] * alpha[j];
+					alpha[i] = ai / M[i * s + i];
+				}
+				for (unsigned i(0); i < k; i++)
+					alpha[i] = -alpha[i];
+				VectorKernels::maxpy(N, k, &alpha[0], &G[0], G[k]);
+				VectorKernels::maxpy(N, k, &alpha[0], &U[0], U[k]);
+			}
+
+			// M(k:s, k) = P(:, k:s)^T G(:,k), together with |G(:,k)|^2 for the breakdown test
+			PG[s] = G[k];
+			VectorKernels::mdot(N, s - k + 1, G[k], &PG[k], &m[0]);
+			for (unsigned i(k); i < s; i++)
+				M[i * s + k] = m[i - k];
+			if (fabs(M[k * s + k]) <= 1e-12 * sqrt(m[s - k])) {
+				restart = true;
+				break;
+			}
+
+			// x = x + beta U(:,k), r = r - beta G(:,k)
+			const double beta(f[k] / M[k * s + k]);
+			rr = VectorKernels::updateCG(N, beta, U[k], G[k], x, r);
+			resid = sqrt(rr) / nrmb;
+			if (resid < eps) {
+				ret = 0;
+				break;
+			}
+			for (unsigned i(k + 1); i < s; i++)
+				f[i] -= beta * M[i * s + k];
+		}
+		if (ret != 1)
+			break;
+		if (restart)
+			continue;
+
+		// dimension reduction step: r is in G_j, the residual of G_{j+1} is r - om A C r
+		VectorKernels::copy(N, r, v);
+		A.precondApply(v);
+		A.amux(D_ONE, v, t);
+		nsteps++;
+		double tr, tt;
+		VectorKernels::dot2(N, t, r, t, tr, tt);
+		if (tt <= D_PREC * D_PREC * rr) {
+			ret = 2;
+			break;
+		}
+		// maintaining the convergence: limit the angle between t and r
+		const double rho(fabs(tr) / (sqrt(tt) * sqrt(rr)));
+		if (rho < D_PREC) {
+			ret = 2;
+			break;
+		}
+		om = tr / tt;
+		if (rho < 0.7)
+			om *= 0.7 / rho;
+		rr = VectorKernels::updateCG(N, om, v, t, x, r);
+		resid = sqrt(rr) / nrmb;
+#ifndef NDEBUG
+		std::cout << "Step " << nsteps << ", resid=" << resid << std::endl;
+#endif
+		if (resid < eps) {
+			ret = 0;
+			break;
+		}
+		cycle_completed = true;
+	}
+
+	eps = resid;
+	delete [] work;
+	return ret;
+}
+
+} // end namespace MathLib
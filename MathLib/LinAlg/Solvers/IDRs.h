@@ -0,0 +1,55 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file IDRs.h
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#ifndef IDRS_H_
+#define IDRS_H_
+
+#include "../LinearOperator.h"
+
+namespace MathLib {
+
+/**
+ * Induced dimension reduction method IDR(s) for nonsymmetric systems in the
+ * variant with biorthogonalization of van Gijzen and Sonneveld (ACM TOMS 38,
+ * 2011). The residuals are forced into a sequence of nested subspaces of
+ * shrinking dimension, defined by s random shadow vectors. Every cycle needs
+ * s+1 matrix vector multiplications; for s = 1 the method is mathematically
+ * equivalent to BiCGStab, larger s (4 or 8) converge much more robustly for
+ * convection dominated problems with storage for 3s+3 vectors only.
+ *
+ * The system is preconditioned from the right with A.precondApply(). The
+ * scalar products with the shadow vectors are computed in one fused pass
+ * (VectorKernels::mdot()), the orthogonalization against the previous
+ * directions as one multi-vector update (VectorKernels::maxpy()). The
+ * parameter omega is chosen by the "maintaining the convergence" strategy
+ * (angle 0.7) for stability. If a shadow space projection breaks down
+ * (P(:,k)^T G(:,k) vanishes relative to |G(:,k)|) the method is restarted
+ * from the current iterate with the true residual and a new random shadow
+ * space.
+ * @param A the matrix
+ * @param b the right hand side
+ * @param x (input) the start vector, (output) the solution
+ * @param s dimension of the shadow space (1 <= s <= 16)
+ * @param eps (input) relative tolerance of the residual norm, (output) the
+ * achieved relative residual norm
+ * @param nsteps (input) maximal number of matrix vector multiplications,
+ * (output) the number of matrix vector multiplications performed
+ * @return 0 if the method converged, 1 if the maximal number of steps is
+ * reached, 2 in case of a breakdown that persists after a restart (before a
+ * cycle is completed) or a breakdown of the minimal residual step
+ */
+unsigned IDRs(LinearOperator<double> const& A, double const*const b, double* const x,
+		unsigned s, double& eps, unsigned& nsteps);
+
+} // end namespace MathLib
+
+#endif /* IDRS_H_ */
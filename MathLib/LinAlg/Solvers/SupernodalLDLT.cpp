@@ -0,0 +1,554 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file SupernodalLDLT.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <limits>
+#include <cmath>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// BaseLib
+#include "quicksort.h"
+
+#include "SupernodalLDLT.h"
+
+namespace MathLib {
+
+namespace {
+
+const unsigned NO_IDX(std::numeric_limits<unsigned>::max());
+
+/** block size of the dense kernels */
+const unsigned BLOCK_SIZE(32);
+
+/** maximal fraction of explicit zeros in the panel of a relaxed supernode */
+const double RELAXED_ZERO_FRACTION(0.05);
+
+/**
+ * Eliminates the first k columns of the dense symmetric m x m matrix F (column
+ * major, only the lower triangular part is used) by a blocked right looking
+ * \f$L D L^T\f$ factorization. At the end the first k columns contain the
+ * factors D (diagonal) and L (strictly lower part), the trailing
+ * (m-k) x (m-k) block contains the Schur complement.
+ * @return false if a zero pivot occurred
+ */
+bool partialLDLT(unsigned m, unsigned k, double* F, double* W, bool parallel)
+{
+	for (unsigned jb(0); jb < k; jb += BLOCK_SIZE) {
+		const unsigned je(std::min(jb + BLOCK_SIZE, k));
+
+		// unblocked factorization of the block columns jb, ..., je-1
+		for (unsigned j(jb); j < je; j++) {
+			double* Fj(F + static_cast<std::size_t>(j) * m);
+			const double d(Fj[j]);
+			if (d == 0.0 || d != d)
+				return false;
+			for (unsigned c(j + 1); c < je; c++) {
+				const double w(Fj[c] / d);
+				double* Fc(F + static_cast<std::size_t>(c) * m);
+				for (unsigned i(c); i < m; i++)
+					Fc[i] -= Fj[i] * w;
+			}
+			const double d_inv(1.0 / d);
+			for (unsigned i(j + 1); i < m; i++)
+				Fj[i] *= d_inv;
+		}
+
+		if (je == m)
+			continue;
+
+		// W(c,p) = L(c,p) * D(p)
+		for (unsigned p(jb); p < je; p++) {
+			double const*const Lp(F + static_cast<std::size_t>(p) * m);
+			double* Wp(W + static_cast<std::size_t>(p - jb) * m);
+			const double d(Lp[p]);
+			for (unsigned c(je); c < m; c++)
+				Wp[c] = Lp[c] * d;
+		}
+
+		// update the trailing columns: F(i,c) -= sum_p L(i,p) D(p) L(c,p)
+		OPENMP_LOOP_TYPE c;
+		const OPENMP_LOOP_TYPE c_beg(je), c_end(m);
+		#pragma omp parallel for schedule(dynamic, 8) if (parallel)
+		for (c = c_beg; c < c_end; c++) {
+			double* Fc(F + static_cast<std::size_t>(c) * m);
+			for (unsigned p(jb); p < je; p++) {
+				double const*const Lp(F + static_cast<std::size_t>(p) * m);
+				const double w(W[static_cast<std::size_t>(p - jb) * m + c]);
+				for (unsigned i(c); i < m; i++)
+					Fc[i] -= Lp[i] * w;
+			}
+		}
+	}
+	return true;
+}
+
+} // end anonymous namespace
+
+SupernodalLDLT::SupernodalLDLT(CRSMatrix<double, unsigned> const& A,
+		unsigned const*const op_perm, unsigned const*const po_perm) :
+	_n(A.getNRows()), _nnz_a(A.getNNZ()), _pattern_row_ptr(new unsigned[_n + 1]),
+	_pattern_col_idx(new unsigned[_nnz_a]), _op_perm(new unsigned[_n]), _po_perm(new unsigned[_n]),
+	_a_col_ptr(NULL), _a_row_idx(NULL), _a_src(NULL), _n_snodes(0), _snode_ptr(NULL),
+	_row_ptr(NULL), _row_idx(NULL), _child_ptr(NULL), _child_idx(NULL), _n_levels(0),
+	_level_ptr(NULL), _level_snodes(NULL), _panel_ptr(NULL), _values(NULL), _work(new double[_n]), _factorized(false)
+{
+	std::copy(A.getRowPtrArray(), A.getRowPtrArray() + _n + 1, _pattern_row_ptr);
+	std::copy(A.getColIdxArray(), A.getColIdxArray() + _nnz_a, _pattern_col_idx);
+
+	if (op_perm != NULL && po_perm != NULL) {
+		for (unsigned k(0); k < _n; k++) {
+			_op_perm[k] = op_perm[k];
+			_po_perm[k] = po_perm[k];
+		}
+	} else {
+		for (unsigned k(0); k < _n; k++)
+			_op_perm[k] = _po_perm[k] = k;
+	}
+
+	unsigned* parent(new unsigned[_n]);
+	unsigned* col_cnt(new unsigned[_n]);
+	analyzePattern(A, parent, col_cnt);
+	createSupernodes(parent, col_cnt);
+	delete[] col_cnt;
+	delete[] parent;
+
+	_values = new double[_panel_ptr[_n_snodes]];
+	_factorized = factorize(A.getEntryArray());
+	if (!_factorized)
+		std::cerr << "SupernodalLDLT: zero pivot - could not factorize matrix" << std::endl;
+}
+
+SupernodalLDLT::~SupernodalLDLT()
+{
+	delete[] _pattern_row_ptr;
+	delete[] _pattern_col_idx;
+	delete[] _op_perm;
+	delete[] _po_perm;
+	delete[] _a_col_ptr;
+	delete[] _a_row_idx;
+	delete[] _a_src;
+	delete[] _snode_ptr;
+	delete[] _row_ptr;
+	delete[] _row_idx;
+	delete[] _child_ptr;
+	delete[] _child_idx;
+	delete[] _level_ptr;
+	delete[] _level_snodes;
+	delete[] _panel_ptr;
+	delete[] _values;
+	delete[] _work;
+}
+
+void SupernodalLDLT::analyzePattern(CRSMatrix<double, unsigned> const& A, unsigned* parent,
+		unsigned* col_cnt)
+{
+	unsigned const*const iA(A.getRowPtrArray());
+	unsigned const*const jA(A.getColIdxArray());
+
+	// *** lower triangular part of the permuted matrix in compressed column storage
+	// (column j of the lower part is the upper part of row j)
+	_a_col_ptr = new unsigned[_n + 1];
+	_a_col_ptr[0] = 0;
+	for (unsigned j(0); j < _n; j++) {
+		const unsigned r(_op_perm[j]);
+		unsigned cnt(0);
+		for (unsigned k(iA[r]); k < iA[r + 1]; k++)
+			if (_po_perm[jA[k]] >= j)
+				cnt++;
+		_a_col_ptr[j + 1] = _a_col_ptr[j] + cnt;
+	}
+	_a_row_idx = new unsigned[_a_col_ptr[_n]];
+	_a_src = new unsigned[_a_col_ptr[_n]];
+	for (unsigned j(0); j < _n; j++) {
+		const unsigned r(_op_perm[j]);
+		unsigned pos(_a_col_ptr[j]);
+		for (unsigned k(iA[r]); k < iA[r + 1]; k++) {
+			const unsigned i(_po_perm[jA[k]]);
+			if (i >= j) {
+				_a_row_idx[pos] = i;
+				_a_src[pos] = k;
+				pos++;
+			}
+		}
+		BaseLib::quicksort(_a_row_idx, static_cast<std::size_t>(_a_col_ptr[j]),
+				static_cast<std::size_t>(_a_col_ptr[j + 1]), _a_src);
+	}
+
+	// *** elimination tree (algorithm of Liu with path compression)
+	unsigned* ancestor(new unsigned[_n]);
+	for (unsigned k(0); k < _n; k++) {
+		parent[k] = NO_IDX;
+		ancestor[k] = NO_IDX;
+		const unsigned r(_op_perm[k]);
+		for (unsigned l(iA[r]); l < iA[r + 1]; l++) {
+			unsigned i(_po_perm[jA[l]]);
+			while (i != NO_IDX && i < k) {
+				const unsigned i_next(ancestor[i]);
+				ancestor[i] = k;
+				if (i_next == NO_IDX)
+					parent[i] = k;
+				i = i_next;
+			}
+		}
+	}
+
+	// *** column counts: the pattern of row k of L is the row subtree of k
+	unsigned* mark(ancestor);
+	for (unsigned k(0); k < _n; k++) {
+		col_cnt[k] = 1;
+		mark[k] = NO_IDX;
+	}
+	for (unsigned k(0); k < _n; k++) {
+		mark[k] = k;
+		const unsigned r(_op_perm[k]);
+		for (unsigned l(iA[r]); l < iA[r + 1]; l++) {
+			unsigned i(_po_perm[jA[l]]);
+			if (i >= k)
+				continue;
+			while (mark[i] != k) {
+				col_cnt[i]++;
+				mark[i] = k;
+				i = parent[i];
+			}
+		}
+	}
+	delete[] ancestor;
+}
+
+void SupernodalLDLT::createSupernodes(unsigned const*const parent, unsigned const*const col_cnt)
+{
+	// *** (relaxed) supernodes: column j is added to the supernode of column
+	// j-1 if j-1 is the only child of j - in this case the pattern of column
+	// j-1 is contained in the pattern of column j (except of j-1 itself). For
+	// fundamental supernodes the patterns are equal, relaxed supernodes
+	// contain a small number of explicit zeros.
+	unsigned* n_children(new unsigned[_n]);
+	for (unsigned j(0); j < _n; j++)
+		n_children[j] = 0;
+	for (unsigned j(0); j < _n; j++)
+		if (parent[j] != NO_IDX)
+			n_children[parent[j]]++;
+
+	std::vector<unsigned> snode_ptr;
+	snode_ptr.push_back(0);
+	std::size_t nnz_snode(_n > 0 ? col_cnt[0] : 0);
+	for (unsigned j(1); j < _n; j++) {
+		bool merge(false);
+		if (parent[j - 1] == j && n_children[j] == 1) {
+			const std::size_t width(j - snode_ptr.back() + 1);
+			const std::size_t m(width + col_cnt[j] - 1);
+			const std::size_t n_stored(width * m - width * (width - 1) / 2);
+			merge = (n_stored - (nnz_snode + col_cnt[j]) <= RELAXED_ZERO_FRACTION * n_stored);
+		}
+		if (merge) {
+			nnz_snode += col_cnt[j];
+		} else {
+			snode_ptr.push_back(j);
+			nnz_snode = col_cnt[j];
+		}
+	}
+	if (_n > 0)
+		snode_ptr.push_back(_n);
+	delete[] n_children;
+
+	_n_snodes = snode_ptr.size() - 1;
+	_snode_ptr = new unsigned[_n_snodes + 1];
+	std::copy(snode_ptr.begin(), snode_ptr.end(), _snode_ptr);
+
+	unsigned* col2snode(new unsigned[_n]);
+	for (unsigned s(0); s < _n_snodes; s++)
+		for (unsigned j(_snode_ptr[s]); j < _snode_ptr[s + 1]; j++)
+			col2snode[j] = s;
+
+	// *** supernodal elimination tree
+	unsigned* sparent(new unsigned[_n_snodes]);
+	_child_ptr = new unsigned[_n_snodes + 1];
+	for (unsigned s(0); s <= _n_snodes; s++)
+		_child_ptr[s] = 0;
+	for (unsigned s(0); s < _n_snodes; s++) {
+		const unsigned p(parent[_snode_ptr[s + 1] - 1]);
+		sparent[s] = (p == NO_IDX) ? NO_IDX : col2snode[p];
+		if (p != NO_IDX)
+			_child_ptr[sparent[s] + 1]++;
+	}
+	for (unsigned s(0); s < _n_snodes; s++)
+		_child_ptr[s + 1] += _child_ptr[s];
+	_child_idx = new unsigned[_child_ptr[_n_snodes]];
+	{
+		unsigned* pos(new unsigned[_n_snodes]);
+		std::copy(_child_ptr, _child_ptr + _n_snodes, pos);
+		for (unsigned s(0); s < _n_snodes; s++)
+			if (sparent[s] != NO_IDX)
+				_child_idx[pos[sparent[s]]++] = s;
+		delete[] pos;
+	}
+	delete[] col2snode;
+
+	// *** row structures and sizes of the dense panels
+	_row_ptr = new std::size_t[_n_snodes + 1];
+	_panel_ptr = new std::size_t[_n_snodes + 1];
+	_row_ptr[0] = 0;
+	_panel_ptr[0] = 0;
+	for (unsigned s(0); s < _n_snodes; s++) {
+		const std::size_t k(_snode_ptr[s + 1] - _snode_ptr[s]);
+		const std::size_t m(k + col_cnt[_snode_ptr[s + 1] - 1] - 1);
+		_row_ptr[s + 1] = _row_ptr[s] + m;
+		_panel_ptr[s + 1] = _panel_ptr[s] + m * k;
+	}
+	_row_idx = new unsigned[_row_ptr[_n_snodes]];
+
+	unsigned* mark(new unsigned[_n]);
+	for (unsigned j(0); j < _n; j++)
+		mark[j] = NO_IDX;
+	for (unsigned s(0); s < _n_snodes; s++) {
+		std::size_t pos(_row_ptr[s]);
+		for (unsigned j(_snode_ptr[s]); j < _snode_ptr[s + 1]; j++) {
+			_row_idx[pos++] = j;
+			mark[j] = s;
+		}
+		const std::size_t below(pos);
+		// entries of the matrix
+		for (unsigned j(_snode_ptr[s]); j < _snode_ptr[s + 1]; j++) {
+			for (unsigned l(_a_col_ptr[j]); l < _a_col_ptr[j + 1]; l++) {
+				const unsigned i(_a_row_idx[l]);
+				if (mark[i] != s) {
+					mark[i] = s;
+					_row_idx[pos++] = i;
+				}
+			}
+		}
+		// fill in from the children
+		for (unsigned c(_child_ptr[s]); c < _child_ptr[s + 1]; c++) {
+			const unsigned t(_child_idx[c]);
+			const std::size_t t_below(_row_ptr[t] + _snode_ptr[t + 1] - _snode_ptr[t]);
+			for (std::size_t l(t_below); l < _row_ptr[t + 1]; l++) {
+				const unsigned i(_row_idx[l]);
+				if (mark[i] != s) {
+					mark[i] = s;
+					_row_idx[pos++] = i;
+				}
+			}
+		}
+		assert(pos == _row_ptr[s + 1]);
+		std::sort(_row_idx + below, _row_idx + pos);
+	}
+	delete[] mark;
+
+	// *** levels of the supernodal elimination tree - the subtrees rooted in
+	// the supernodes of one level are independent
+	unsigned* level(new unsigned[_n_snodes]);
+	_n_levels = 0;
+	for (unsigned s(0); s < _n_snodes; s++) {
+		level[s] = 0;
+		for (unsigned c(_child_ptr[s]); c < _child_ptr[s + 1]; c++)
+			level[s] = std::max(level[s], level[_child_idx[c]] + 1);
+		_n_levels = std::max(_n_levels, level[s] + 1);
+	}
+	_level_ptr = new unsigned[_n_levels + 1];
+	for (unsigned l(0); l <= _n_levels; l++)
+		_level_ptr[l] = 0;
+	for (unsigned s(0); s < _n_snodes; s++)
+		_level_ptr[level[s] + 1]++;
+	for (unsigned l(0); l < _n_levels; l++)
+		_level_ptr[l + 1] += _level_ptr[l];
+	_level_snodes = new unsigned[_n_snodes];
+	{
+		unsigned* pos(new unsigned[_n_levels]);
+		std::copy(_level_ptr, _level_ptr + _n_levels, pos);
+		for (unsigned s(0); s < _n_snodes; s++)
+			_level_snodes[pos[level[s]]++] = s;
+		delete[] pos;
+	}
+	delete[] level;
+	delete[] sparent;
+}
+
+bool SupernodalLDLT::factorize(double const*const a_data)
+{
+	unsigned n_threads(1);
+#ifdef _OPENMP
+	n_threads = omp_get_max_threads();
+#endif
+	unsigned* maps(new unsigned[static_cast<std::size_t>(n_threads) * _n]);
+	double** update(new double*[_n_snodes]);
+	for (unsigned s(0); s < _n_snodes; s++)
+		update[s] = NULL;
+
+	bool success(true);
+	for (unsigned l(0); l < _n_levels && success; l++) {
+		const unsigned beg(_level_ptr[l]), end(_level_ptr[l + 1]);
+		if (end - beg < 2) {
+			// use the parallel dense kernels within the supernode
+			success = factorizeSupernode(_level_snodes[beg], a_data, maps, update, true);
+		} else {
+			// process independent subtrees in parallel
+			OPENMP_LOOP_TYPE k;
+			const OPENMP_LOOP_TYPE k_beg(beg), k_end(end);
+			#pragma omp parallel for schedule(dynamic)
+			for (k = k_beg; k < k_end; k++) {
+				unsigned thread_id(0);
+#ifdef _OPENMP
+				thread_id = omp_get_thread_num();
+#endif
+				if (!factorizeSupernode(_level_snodes[k], a_data,
+						maps + static_cast<std::size_t>(thread_id) * _n, update, false)) {
+					#pragma omp critical (supernodal_ldlt_failure)
+					success = false;
+				}
+			}
+		}
+	}
+
+	for (unsigned s(0); s < _n_snodes; s++)
+		delete[] update[s];
+	delete[] update;
+	delete[] maps;
+	return success;
+}
+
+bool SupernodalLDLT::factorizeSupernode(unsigned s, double const*const a_data, unsigned* map,
+		double** update, bool parallel_kernel)
+{
+	const unsigned f(_snode_ptr[s]);
+	const unsigned k(_snode_ptr[s + 1] - f);
+	const unsigned m(_row_ptr[s + 1] - _row_ptr[s]);
+	unsigned const*const rows(_row_idx + _row_ptr[s]);
+
+	for (unsigned r(0); r < m; r++)
+		map[rows[r]] = r;
+
+	// *** assemble the frontal matrix
+	double* F(new double[static_cast<std::size_t>(m) * m]);
+	std::fill(F, F + static_cast<std::size_t>(m) * m, 0.0);
+	for (unsigned c(0); c < k; c++) {
+		const unsigned j(f + c);
+		double* Fc(F + static_cast<std::size_t>(c) * m);
+		for (unsigned l(_a_col_ptr[j]); l < _a_col_ptr[j + 1]; l++)
+			Fc[map[_a_row_idx[l]]] += a_data[_a_src[l]];
+	}
+
+	// *** extend-add of the update matrices of the children
+	for (unsigned c(_child_ptr[s]); c < _child_ptr[s + 1]; c++) {
+		const unsigned t(_child_idx[c]);
+		const unsigned kt(_snode_ptr[t + 1] - _snode_ptr[t]);
+		const unsigned mt(_row_ptr[t + 1] - _row_ptr[t] - kt);
+		unsigned const*const rt(_row_idx + _row_ptr[t] + kt);
+		double const*const U(update[t]);
+		for (unsigned cc(0); cc < mt; cc++) {
+			double* Fc(F + static_cast<std::size_t>(map[rt[cc]]) * m);
+			double const*const Uc(U + static_cast<std::size_t>(cc) * mt);
+			for (unsigned rr(cc); rr < mt; rr++)
+				Fc[map[rt[rr]]] += Uc[rr];
+		}
+		delete[] update[t];
+		update[t] = NULL;
+	}
+
+	// *** eliminate the columns of the supernode
+	double* W(new double[static_cast<std::size_t>(std::min(k, BLOCK_SIZE)) * m]);
+	const bool success(partialLDLT(m, k, F, W, parallel_kernel));
+	delete[] W;
+	if (!success) {
+		delete[] F;
+		return false;
+	}
+
+	// *** store the panel and the update matrix
+	std::copy(F, F + static_cast<std::size_t>(m) * k, _values + _panel_ptr[s]);
+	const unsigned m2(m - k);
+	if (m2 > 0) {
+		double* U(new double[static_cast<std::size_t>(m2) * m2]);
+		for (unsigned cc(0); cc < m2; cc++) {
+			double const*const Fc(F + static_cast<std::size_t>(k + cc) * m + k);
+			double* Uc(U + static_cast<std::size_t>(cc) * m2);
+			for (unsigned rr(cc); rr < m2; rr++)
+				Uc[rr] = Fc[rr];
+		}
+		update[s] = U;
+	}
+	delete[] F;
+	return true;
+}
+
+bool SupernodalLDLT::refactorize(CRSMatrix<double, unsigned> const& A)
+{
+	// the symbolic factorization is valid only for exactly the same pattern
+	if (A.getNRows() != _n || A.getNNZ() != _nnz_a
+		|| !std::equal(_pattern_row_ptr, _pattern_row_ptr + _n + 1, A.getRowPtrArray())
+		|| !std::equal(_pattern_col_idx, _pattern_col_idx + _nnz_a, A.getColIdxArray())) {
+		_factorized = false;
+		return false;
+	}
+	_factorized = factorize(A.getEntryArray());
+	return _factorized;
+}
+
+void SupernodalLDLT::execute(double* b) const
+{
+	double* const y(_work);
+	for (unsigned i(0); i < _n; i++)
+		y[i] = b[_op_perm[i]];
+
+	// forward substitution L z = y
+	for (unsigned s(0); s < _n_snodes; s++) {
+		const unsigned f(_snode_ptr[s]);
+		const unsigned k(_snode_ptr[s + 1] - f);
+		const unsigned m(_row_ptr[s + 1] - _row_ptr[s]);
+		unsigned const*const rows(_row_idx + _row_ptr[s]);
+		double const*const panel(_values + _panel_ptr[s]);
+		for (unsigned c(0); c < k; c++) {
+			const double yc(y[f + c]);
+			if (yc == 0.0)
+				continue;
+			double const*const Lc(panel + static_cast<std::size_t>(c) * m);
+			for (unsigned r(c + 1); r < m; r++)
+				y[rows[r]] -= Lc[r] * yc;
+		}
+	}
+
+	// diagonal D w = z
+	for (unsigned s(0); s < _n_snodes; s++) {
+		const unsigned f(_snode_ptr[s]);
+		const unsigned k(_snode_ptr[s + 1] - f);
+		const unsigned m(_row_ptr[s + 1] - _row_ptr[s]);
+		double const*const panel(_values + _panel_ptr[s]);
+		for (unsigned c(0); c < k; c++)
+			y[f + c] /= panel[static_cast<std::size_t>(c) * m + c];
+	}
+
+	// backward substitution L^T x = w
+	for (unsigned s(_n_snodes); s > 0; s--) {
+		const unsigned f(_snode_ptr[s - 1]);
+		const unsigned k(_snode_ptr[s] - f);
+		const unsigned m(_row_ptr[s] - _row_ptr[s - 1]);
+		unsigned const*const rows(_row_idx + _row_ptr[s - 1]);
+		double const*const panel(_values + _panel_ptr[s - 1]);
+		for (unsigned c(k); c > 0; c--) {
+			double const*const Lc(panel + static_cast<std::size_t>(c - 1) * m);
+			double t(y[f + c - 1]);
+			for (unsigned r(c); r < m; r++)
+				t -= Lc[r] * y[rows[r]];
+			y[f + c - 1] = t;
+		}
+	}
+
+	for (unsigned i(0); i < _n; i++)
+		b[_op_perm[i]] = y[i];
+}
+
+} // end namespace MathLib
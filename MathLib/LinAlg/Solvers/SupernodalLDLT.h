@@ -0,0 +1,184 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file SupernodalLDLT.h
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#ifndef SUPERNODALLDLT_H_
+#define SUPERNODALLDLT_H_
+
+#include <cstddef>
+
+#include "DirectLinearSolver.h"
+#include "../Sparse/CRSMatrix.h"
+
+namespace MathLib {
+
+/**
+ * Class SupernodalLDLT is a direct solver for sparse symmetric linear systems
+ * \f$A x = b\f$. The matrix is factorized as \f$P A P^T = L D L^T\f$, where
+ * \f$P\f$ is a fill reducing permutation (for instance the nested dissection
+ * permutation computed by Cluster::createClusterTree()), \f$L\f$ is a unit
+ * lower triangular matrix and \f$D\f$ is a diagonal matrix. For symmetric
+ * positive definite matrices the entries of \f$D\f$ are positive and
+ * \f$L D^{1/2}\f$ is the Cholesky factor.
+ *
+ * The factorization is split into two phases:
+ * -# symbolic phase (constructor): computation of the elimination tree, the
+ *    column counts of \f$L\f$ and the (relaxed) supernodes together with
+ *    their row structures
+ * -# numeric phase (factorize()): multifrontal factorization - the frontal
+ *    matrix of every supernode is assembled from the entries of \f$A\f$ and
+ *    the update matrices of its children, the columns of the supernode are
+ *    eliminated with blocked dense kernels and the Schur complement is passed
+ *    to the parent. Supernodes on the same level of the supernodal elimination
+ *    tree belong to independent subtrees and are processed in parallel.
+ *
+ * Since the symbolic information depends only on the sparsity pattern, a
+ * matrix with the same pattern but different entries can be factorized again
+ * using refactorize() without repeating the symbolic phase.
+ *
+ * No pivoting is performed, i.e. the factorization is stable for symmetric
+ * positive definite and (in most cases) for symmetric quasi definite matrices.
+ * Only the upper triangular part of each row of \f$A\f$ is accessed.
+ */
+class SupernodalLDLT : public MathLib::DirectLinearSolver
+{
+public:
+	/**
+	 * The constructor performs the symbolic and the numeric factorization.
+	 * @param A the symmetric matrix in compressed row storage format (the
+	 * complete pattern of the matrix has to be stored)
+	 * @param op_perm permutation: original_idx = op_perm[permuted_idx], if NULL
+	 * the identity is used
+	 * @param po_perm reverse permutation: permuted_idx = po_perm[original_idx]
+	 * (has to be given if and only if op_perm is given)
+	 */
+	SupernodalLDLT(CRSMatrix<double, unsigned> const& A,
+			unsigned const*const op_perm = NULL, unsigned const*const po_perm = NULL);
+	virtual ~SupernodalLDLT();
+
+	/**
+	 * Computes the numeric factorization of a matrix that has the same
+	 * sparsity pattern as the matrix given to the constructor.
+	 * @param A the matrix
+	 * @return true if the factorization was successful, false if the pattern
+	 * (row pointers and column indices) differs or a zero pivot occurred
+	 */
+	bool refactorize(CRSMatrix<double, unsigned> const& A);
+
+	/**
+	 * Solves the linear system \f$A x = b\f$ using the computed factorization.
+	 * The permuted vector is kept in a work array of the object, hence
+	 * execute() must not be called concurrently for the same object.
+	 * @param b at the beginning the right hand side, at the end the solution
+	 */
+	void execute(double* b) const;
+
+	/**
+	 * @return true if the last (re)factorization was successful
+	 */
+	bool isFactorized() const { return _factorized; }
+
+	/** @return the number of supernodes */
+	unsigned getNSupernodes() const { return _n_snodes; }
+
+	/** @return the number of stored entries of the factor (including explicit zeros) */
+	std::size_t getNNZFactor() const { return _panel_ptr[_n_snodes]; }
+
+	/** @return the height of the supernodal elimination tree */
+	unsigned getTreeHeight() const { return _n_levels; }
+
+private:
+	/**
+	 * computes the permuted lower triangular part of the matrix (in compressed
+	 * column storage, only positions are stored), the elimination tree
+	 * and the column counts of the factor
+	 * @param A the matrix
+	 * @param parent array of size _n for the elimination tree
+	 * @param col_cnt array of size _n for the column counts
+	 */
+	void analyzePattern(CRSMatrix<double, unsigned> const& A, unsigned* parent,
+			unsigned* col_cnt);
+
+	/**
+	 * finds the (relaxed) supernodes, the row structures of the supernodes
+	 * and the levels of the supernodal elimination tree
+	 */
+	void createSupernodes(unsigned const*const parent, unsigned const*const col_cnt);
+
+	/**
+	 * numeric multifrontal factorization
+	 * @param a_data the entries of the matrix A
+	 * @return true in case of success, false if a zero pivot occurred
+	 */
+	bool factorize(double const*const a_data);
+
+	/**
+	 * assembles the frontal matrix, eliminates the columns of the supernode
+	 * and creates the update matrix
+	 * @param s the supernode
+	 * @param a_data the entries of the matrix A
+	 * @param map work array of size _n
+	 * @param update the update matrices of all supernodes
+	 * @param parallel_kernel use the (OpenMP) parallel dense kernels
+	 * @return true in case of success
+	 */
+	bool factorizeSupernode(unsigned s, double const*const a_data, unsigned* map,
+			double** update, bool parallel_kernel);
+
+	/** number of rows / columns */
+	unsigned _n;
+	/** number of non-zero entries of the matrix the pattern was computed for */
+	unsigned _nnz_a;
+	/** copy of the pattern of the matrix, refactorize() checks it */
+	unsigned* _pattern_row_ptr;
+	unsigned* _pattern_col_idx;
+	/** original_idx = _op_perm[permuted_idx] */
+	unsigned* _op_perm;
+	/** permuted_idx = _po_perm[original_idx] */
+	unsigned* _po_perm;
+
+	/** lower triangular part of the permuted matrix in compressed column storage */
+	unsigned* _a_col_ptr;
+	unsigned* _a_row_idx;
+	/** position of the entry within the data array of the original matrix */
+	unsigned* _a_src;
+
+	/** number of supernodes */
+	unsigned _n_snodes;
+	/** supernode s consists of the columns _snode_ptr[s], ..., _snode_ptr[s+1]-1 */
+	unsigned* _snode_ptr;
+	/** the (sorted) row indices of supernode s are _row_idx[_row_ptr[s]], ... */
+	std::size_t* _row_ptr;
+	unsigned* _row_idx;
+	/** children of supernode s in the supernodal elimination tree */
+	unsigned* _child_ptr;
+	unsigned* _child_idx;
+	/** supernodes of level l are _level_snodes[_level_ptr[l]], ... */
+	unsigned _n_levels;
+	unsigned* _level_ptr;
+	unsigned* _level_snodes;
+
+	/**
+	 * dense panels of the factor: the panel of supernode s is stored column
+	 * wise starting at _values[_panel_ptr[s]], the diagonal contains D, the
+	 * strictly lower part the entries of L
+	 */
+	std::size_t* _panel_ptr;
+	double* _values;
+	/** work array of execute() */
+	double* _work;
+
+	bool _factorized;
+};
+
+} // end namespace MathLib
+
+#endif /* SUPERNODALLDLT_H_ */
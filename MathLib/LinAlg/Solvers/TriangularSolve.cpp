@@ -16,13 +16,15 @@ namespace MathLib {
 
 void forwardSolve (const Matrix <double> &L, double* b)
 {
-	size_t m (L.getNRows());
+	size_t m (L.getNRows()), n (L.getNCols());
+	double const* const l (L.getEntryArray());
 	double t;
 
 	for (size_t r=0; r<m; r++) {
+		double const* const row (l + r*n);
 		t = 0.0;
 		for (size_t c=0; c<r; c++) {
-			t += L(r,c)*b[c];
+			t += row[c]*b[c];
 		}
 		b[r] = b[r]-t;
 	}
@@ -32,25 +34,29 @@ void backwardSolve (const Matrix <double> &mat, double* b)
 {
 	double t;
 	size_t m (mat.getNRows()), n(mat.getNCols());
+	double const* const u (mat.getEntryArray());
 	for (int r=m-1; r>=0; r--) {
+		double const* const row (u + r*n);
 		t = 0.0;
 		for (size_t c=r+1; c<n; c++) {
-			t += mat(r,c)*b[c];
+			t += row[c]*b[c];
 		}
-		b[r] = (b[r]-t) / mat(r,r);
+		b[r] = (b[r]-t) / row[r];
 	}
 }
 
 void backwardSolve ( Matrix<double> const& mat, double* x, double* b)
 {
 	size_t n_cols (mat.getNCols());
+	double const* const u (mat.getEntryArray());
 	for (int r = (n_cols - 1); r >= 0; r--) {
+		double const* const row (u + r*n_cols);
 		double t = 0.0;
 
 		for (size_t c = r+1; c < n_cols; c++) {
-			t += mat(r,c) * b[c];
+			t += row[c] * b[c];
 		}
-		x[r] = (b[r] - t) / mat(r, r);
+		x[r] = (b[r] - t) / row[r];
 	}
 }
 
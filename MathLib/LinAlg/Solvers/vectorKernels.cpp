@@ -0,0 +1,422 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file vectorKernels.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include "vectorKernels.h"
+
+namespace MathLib {
+
+namespace VectorKernels {
+
+namespace {
+
+/**
+ * Sums op(i) for i in [beg, end) using four partial sums.
+ */
+template <class Op>
+inline double reduceBlock(Op const& op, unsigned beg, unsigned end)
+{
+	double s0(0.0), s1(0.0), s2(0.0), s3(0.0);
+	unsigned i(beg);
+	for (; i + 4 <= end; i += 4) {
+		s0 += op(i);
+		s1 += op(i + 1);
+		s2 += op(i + 2);
+		s3 += op(i + 3);
+	}
+	for (; i < end; i++)
+		s0 += op(i);
+	return (s0 + s1) + (s2 + s3);
+}
+
+/**
+ * Variant of reduceBlock() for operations with two results, op(i, a, b) adds
+ * its contributions to a and b.
+ */
+template <class Op>
+inline void reduceBlock2(Op const& op, unsigned beg, unsigned end, double &res0, double &res1)
+{
+	double a0(0.0), a1(0.0), b0(0.0), b1(0.0);
+	unsigned i(beg);
+	for (; i + 2 <= end; i += 2) {
+		op(i, a0, b0);
+		op(i + 1, a1, b1);
+	}
+	for (; i < end; i++)
+		op(i, a0, b0);
+	res0 = a0 + a1;
+	res1 = b0 + b1;
+}
+
+/**
+ * Computes the sum of op(i), i = 0, ..., n-1 block wise in parallel. The
+ * block sums are added pairwise.
+ */
+template <class Op>
+double reduce(unsigned n, Op const& op)
+{
+	const unsigned n_blocks((n + REDUCTION_BLOCK_SIZE - 1) / REDUCTION_BLOCK_SIZE);
+	if (n_blocks <= 1)
+		return reduceBlock(op, 0, n);
+
+	double* const block_sums(new double[n_blocks]);
+	const OPENMP_LOOP_TYPE nb(n_blocks);
+	OPENMP_LOOP_TYPE b;
+	#pragma omp parallel for schedule(static)
+	for (b = 0; b < nb; b++) {
+		const unsigned beg(b * REDUCTION_BLOCK_SIZE);
+		block_sums[b] = reduceBlock(op, beg, std::min(n, beg + REDUCTION_BLOCK_SIZE));
+	}
+
+	const double res(pairwiseSum(n_blocks, block_sums));
+	delete [] block_sums;
+	return res;
+}
+
+/** variant of reduce() for operations with two results */
+template <class Op>
+void reduce2(unsigned n, Op const& op, double &res0, double &res1)
+{
+	const unsigned n_blocks((n + REDUCTION_BLOCK_SIZE - 1) / REDUCTION_BLOCK_SIZE);
+	if (n_blocks <= 1) {
+		reduceBlock2(op, 0, n, res0, res1);
+		return;
+	}
+
+	double* const block_sums0(new double[2 * n_blocks]);
+	double* const block_sums1(block_sums0 + n_blocks);
+	const OPENMP_LOOP_TYPE nb(n_blocks);
+	OPENMP_LOOP_TYPE b;
+	#pragma omp parallel for schedule(static)
+	for (b = 0; b < nb; b++) {
+		const unsigned beg(b * REDUCTION_BLOCK_SIZE);
+		reduceBlock2(op, beg, std::min(n, beg + REDUCTION_BLOCK_SIZE),
+				block_sums0[b], block_sums1[b]);
+	}
+
+	res0 = pairwiseSum(n_blocks, block_sums0);
+	res1 = pairwiseSum(n_blocks, block_sums1);
+	delete [] block_sums0;
+}
+
+struct AxpyDotOp {
+	AxpyDotOp(double a, double const*const x, double* y, double const*const z) :
+		_a(a), _x(x), _y(y), _z(z) {}
+	double operator()(unsigned i) const
+	{
+		_y[i] += _a * _x[i];
+		return _y[i] * _z[i];
+	}
+	const double _a;
+	double const*const _x;
+	double* const _y;
+	double const*const _z;
+};
+
+struct WaxpyDotOp {
+	WaxpyDotOp(double a, double const*const x, double const*const y, double* w) :
+		_a(a), _x(x), _y(y), _w(w) {}
+	double operator()(unsigned i) const
+	{
+		const double w(_y[i] + _a * _x[i]);
+		_w[i] = w;
+		return w * w;
+	}
+	const double _a;
+	double const*const _x;
+	double const*const _y;
+	double* const _w;
+};
+
+struct Dot2Op {
+	Dot2Op(double const*const x, double const*const y, double const*const z) :
+		_x(x), _y(y), _z(z) {}
+	void operator()(unsigned i, double &xy, double &xz) const
+	{
+		xy += _x[i] * _y[i];
+		xz += _x[i] * _z[i];
+	}
+	double const*const _x;
+	double const*const _y;
+	double const*const _z;
+};
+
+struct UpdateCGOp {
+	UpdateCGOp(double alpha, double const*const p, double const*const q, double* x, double* r) :
+		_alpha(alpha), _p(p), _q(q), _x(x), _r(r) {}
+	double operator()(unsigned i) const
+	{
+		_x[i] += _alpha * _p[i];
+		const double r(_r[i] - _alpha * _q[i]);
+		_r[i] = r;
+		return r * r;
+	}
+	const double _alpha;
+	double const*const _p;
+	double const*const _q;
+	double* const _x;
+	double* const _r;
+};
+
+struct UpdateBiCGStabOp {
+	UpdateBiCGStabOp(double alpha, double const*const phat, double omega,
+			double const*const shat, double const*const s, double const*const t,
+			double const*const r0, double* x, double* r) :
+		_alpha(alpha), _phat(phat), _omega(omega), _shat(shat), _s(s), _t(t),
+		_r0(r0), _x(x), _r(r) {}
+	void operator()(unsigned i, double &rr, double &r0r) const
+	{
+		_x[i] += _alpha * _phat[i] + _omega * _shat[i];
+		const double r(_s[i] - _omega * _t[i]);
+		_r[i] = r;
+		rr += r * r;
+		r0r += _r0[i] * r;
+	}
+	const double _alpha;
+	double const*const _phat;
+	const double _omega;
+	double const*const _shat;
+	double const*const _s;
+	double const*const _t;
+	double const*const _r0;
+	double* const _x;
+	double* const _r;
+};
+
+/** upper bound for the number of vectors of the kernels with multiple vectors */
+const unsigned MAX_VECTORS(16);
+
+/**
+ * Computes the k sums of op(i, sums), i = 0, ..., n-1, block wise in
+ * parallel, the block sums are added pairwise.
+ */
+template <class Op>
+void reduceN(unsigned n, unsigned k, Op const& op, double* res)
+{
+	const unsigned n_blocks(std::max((n + REDUCTION_BLOCK_SIZE - 1) / REDUCTION_BLOCK_SIZE, 1u));
+	double* const block_sums(new double[k * n_blocks]);
+	const OPENMP_LOOP_TYPE nb(n_blocks);
+	OPENMP_LOOP_TYPE b;
+	#pragma omp parallel for schedule(static)
+	for (b = 0; b < nb; b++) {
+		const unsigned beg(b * REDUCTION_BLOCK_SIZE);
+		const unsigned end(std::min(n, beg + REDUCTION_BLOCK_SIZE));
+		double* const sums(block_sums + b * k);
+		for (unsigned j(0); j < k; j++)
+			sums[j] = 0.0;
+		for (unsigned i(beg); i < end; i++)
+			op(i, sums);
+	}
+
+	// block_sums is stored block wise, pairwiseSum() needs the sums of one
+	// result contiguously
+	double* const tmp(new double[n_blocks]);
+	for (unsigned j(0); j < k; j++) {
+		for (unsigned b(0); b < n_blocks; b++)
+			tmp[b] = block_sums[b * k + j];
+		res[j] = pairwiseSum(n_blocks, tmp);
+	}
+	delete [] tmp;
+	delete [] block_sums;
+}
+
+struct MDotOp {
+	MDotOp(unsigned k, double const*const x, double const*const*const X) :
+		_k(k), _x(x), _X(X) {}
+	void operator()(unsigned i, double* sums) const
+	{
+		const double x(_x[i]);
+		for (unsigned j(0); j < _k; j++)
+			sums[j] += x * _X[j][i];
+	}
+	const unsigned _k;
+	double const*const _x;
+	double const*const*const _X;
+};
+
+struct GramOp {
+	GramOp(unsigned k, double const*const*const X) :
+		_k(k), _X(X) {}
+	void operator()(unsigned i, double* sums) const
+	{
+		double x[MAX_VECTORS];
+		for (unsigned j(0); j < _k; j++)
+			x[j] = _X[j][i];
+		// upper triangle only
+		for (unsigned r(0); r < _k; r++)
+			for (unsigned c(r); c < _k; c++)
+				sums[r * _k + c] += x[r] * x[c];
+	}
+	const unsigned _k;
+	double const*const*const _X;
+};
+
+} // end anonymous namespace
+
+void copy(unsigned n, double const*const x, double* y)
+{
+	const OPENMP_LOOP_TYPE m(n);
+	OPENMP_LOOP_TYPE k;
+	#pragma omp parallel for schedule(static)
+	for (k = 0; k < m; k++)
+		y[k] = x[k];
+}
+
+void setZero(unsigned n, double* x)
+{
+	const OPENMP_LOOP_TYPE m(n);
+	OPENMP_LOOP_TYPE k;
+	#pragma omp parallel for schedule(static)
+	for (k = 0; k < m; k++)
+		x[k] = 0.0;
+}
+
+void scal(unsigned n, double a, double* x)
+{
+	const OPENMP_LOOP_TYPE m(n);
+	OPENMP_LOOP_TYPE k;
+	#pragma omp parallel for schedule(static)
+	for (k = 0; k < m; k++)
+		x[k] *= a;
+}
+
+void axpy(unsigned n, double a, double const*const x, double* y)
+{
+	const OPENMP_LOOP_TYPE m(n);
+	OPENMP_LOOP_TYPE k;
+	#pragma omp parallel for schedule(static)
+	for (k = 0; k < m; k++)
+		y[k] += a * x[k];
+}
+
+void xpay(unsigned n, double const*const x, double a, double* y)
+{
+	const OPENMP_LOOP_TYPE m(n);
+	OPENMP_LOOP_TYPE k;
+	#pragma omp parallel for schedule(static)
+	for (k = 0; k < m; k++)
+		y[k] = x[k] + a * y[k];
+}
+
+double dot(unsigned n, double const*const x, double const*const y)
+{
+	return reproducibleDot(n, x, y);
+}
+
+double nrm2(unsigned n, double const*const x)
+{
+	return sqrt(reproducibleDot(n, x, x));
+}
+
+double axpyDot(unsigned n, double a, double const*const x, double* y, double const*const z)
+{
+	return reduce(n, AxpyDotOp(a, x, y, z));
+}
+
+double waxpyDot(unsigned n, double a, double const*const x, double const*const y, double* w)
+{
+	return reduce(n, WaxpyDotOp(a, x, y, w));
+}
+
+void dot2(unsigned n, double const*const x, double const*const y, double const*const z,
+		double &xy, double &xz)
+{
+	reduce2(n, Dot2Op(x, y, z), xy, xz);
+}
+
+double updateCG(unsigned n, double alpha, double const*const p, double const*const q,
+		double* x, double* r)
+{
+	return reduce(n, UpdateCGOp(alpha, p, q, x, r));
+}
+
+void updateBiCGStabDirection(unsigned n, double beta, double omega, double const*const v,
+		double const*const r, double* p)
+{
+	const OPENMP_LOOP_TYPE m(n);
+	OPENMP_LOOP_TYPE k;
+	#pragma omp parallel for schedule(static)
+	for (k = 0; k < m; k++)
+		p[k] = (p[k] - omega * v[k]) * beta + r[k];
+}
+
+void updateBiCGStab(unsigned n, double alpha, double const*const phat, double omega,
+		double const*const shat, double const*const s, double const*const t,
+		double const*const r0, double* x, double* r, double &rr, double &r0r)
+{
+	reduce2(n, UpdateBiCGStabOp(alpha, phat, omega, shat, s, t, r0, x, r), rr, r0r);
+}
+
+void mdot(unsigned n, unsigned k, double const*const x, double const*const*const X, double* xX)
+{
+	reduceN(n, k, MDotOp(k, x, X), xX);
+}
+
+void maxpy(unsigned n, unsigned k, double const*const a, double const*const*const X, double* y)
+{
+	const OPENMP_LOOP_TYPE m(n);
+	OPENMP_LOOP_TYPE i;
+	#pragma omp parallel for schedule(static)
+	for (i = 0; i < m; i++) {
+		double t(y[i]);
+		for (unsigned j(0); j < k; j++)
+			t += a[j] * X[j][i];
+		y[i] = t;
+	}
+}
+
+void gram(unsigned n, unsigned k, double const*const*const X, double* G)
+{
+	assert(k <= MAX_VECTORS);
+	reduceN(n, k * k, GramOp(k, X), G);
+	for (unsigned r(1); r < k; r++)
+		for (unsigned c(0); c < r; c++)
+			G[r * k + c] = G[c * k + r];
+}
+
+double updateBiCGStabL(unsigned n, unsigned l, double const*const gamma,
+		double* const*const R, double* const*const U, double* x)
+{
+	const unsigned n_blocks((n + REDUCTION_BLOCK_SIZE - 1) / REDUCTION_BLOCK_SIZE);
+	double* const block_sums(new double[std::max(n_blocks, 1u)]);
+	const OPENMP_LOOP_TYPE nb(n_blocks);
+	OPENMP_LOOP_TYPE b;
+	#pragma omp parallel for schedule(static)
+	for (b = 0; b < nb; b++) {
+		const unsigned beg(b * REDUCTION_BLOCK_SIZE);
+		const unsigned end(std::min(n, beg + REDUCTION_BLOCK_SIZE));
+		double s(0.0);
+		for (unsigned i(beg); i < end; i++) {
+			double xi(x[i]), r(R[0][i]), u(U[0][i]);
+			for (unsigned j(1); j <= l; j++) {
+				xi += gamma[j] * R[j - 1][i];
+				r -= gamma[j] * R[j][i];
+				u -= gamma[j] * U[j][i];
+			}
+			x[i] = xi;
+			R[0][i] = r;
+			U[0][i] = u;
+			s += r * r;
+		}
+		block_sums[b] = s;
+	}
+	const double rr(n_blocks > 0 ? pairwiseSum(n_blocks, block_sums) : 0.0);
+	delete [] block_sums;
+	return rr;
+}
+
+} // end namespace VectorKernels
+
+} // end namespace MathLib
@@ -0,0 +1,134 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file vectorKernels.h
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#ifndef VECTORKERNELS_H_
+#define VECTORKERNELS_H_
+
+#include "../reproducibleReduction.h"
+
+namespace MathLib {
+
+/**
+ * Parallel (OpenMP) vector operations for the iterative solvers. Besides the
+ * usual level one operations there are fused operations that combine vector
+ * updates with the scalar products of the following step of the solver. Every
+ * fused operation needs only one pass over the involved vectors instead of
+ * one pass per elementary operation.
+ *
+ * All loops are distributed with schedule(static) over the entries, i.e. in
+ * the same way as the rows in amuxCRSParallelOpenMP() (see also
+ * newFirstTouch()).
+ *
+ * Reductions are computed in blocks of REDUCTION_BLOCK_SIZE consecutive
+ * entries. Within a block four partial sums are accumulated (to allow the
+ * compiler to vectorize the loop), the block sums are added by pairwiseSum().
+ * Hence the result depends neither on the number of threads nor on the
+ * scheduling (see reproducibleReduction.h).
+ */
+namespace VectorKernels {
+
+/** y = x */
+void copy(unsigned n, double const*const x, double* y);
+
+/** x = 0 */
+void setZero(unsigned n, double* x);
+
+/** x = a x */
+void scal(unsigned n, double a, double* x);
+
+/** y = y + a x */
+void axpy(unsigned n, double a, double const*const x, double* y);
+
+/** y = x + a y */
+void xpay(unsigned n, double const*const x, double a, double* y);
+
+/** @return x * y */
+double dot(unsigned n, double const*const x, double const*const y);
+
+/** @return the euclidean norm of x */
+double nrm2(unsigned n, double const*const x);
+
+/**
+ * Fused operation: y = y + a x, z may be identical to y.
+ * @return y * z (after the update)
+ */
+double axpyDot(unsigned n, double a, double const*const x, double* y, double const*const z);
+
+/**
+ * Fused operation: w = y + a x, w may be identical to x or y.
+ * @return w * w
+ */
+double waxpyDot(unsigned n, double a, double const*const x, double const*const y, double* w);
+
+/**
+ * Fused operation: computes two scalar products with the common vector x.
+ * @param xy x * y
+ * @param xz x * z
+ */
+void dot2(unsigned n, double const*const x, double const*const y, double const*const z,
+		double &xy, double &xz);
+
+/**
+ * Fused update of the conjugate gradient method: x = x + alpha p and
+ * r = r - alpha q.
+ * @return r * r (after the update)
+ */
+double updateCG(unsigned n, double alpha, double const*const p, double const*const q,
+		double* x, double* r);
+
+/**
+ * Update of the search direction of BiCGStab: p = (p - omega v) beta + r.
+ */
+void updateBiCGStabDirection(unsigned n, double beta, double omega, double const*const v,
+		double const*const r, double* p);
+
+/**
+ * Fused update at the end of a BiCGStab step: x = x + alpha phat + omega shat
+ * and r = s - omega t.
+ * @param rr r * r (after the update)
+ * @param r0r r0 * r (after the update), the scalar product needed at the
+ * beginning of the next step
+ */
+void updateBiCGStab(unsigned n, double alpha, double const*const phat, double omega,
+		double const*const shat, double const*const s, double const*const t,
+		double const*const r0, double* x, double* r, double &rr, double &r0r);
+
+/**
+ * Computes k scalar products with the common vector x in one pass.
+ * @param X the k vectors
+ * @param xX (output) xX[j] = x * X[j]
+ */
+void mdot(unsigned n, unsigned k, double const*const x, double const*const*const X, double* xX);
+
+/** y = y + sum_j a[j] X[j], j = 0, ..., k-1, in one pass */
+void maxpy(unsigned n, unsigned k, double const*const a, double const*const*const X, double* y);
+
+/**
+ * Computes the Gram matrix of k vectors in one pass.
+ * @param G (output) the k x k matrix G[i*k+j] = X[i] * X[j]
+ */
+void gram(unsigned n, unsigned k, double const*const*const X, double* G);
+
+/**
+ * Fused minimal residual update at the end of a BiCGStab(l) cycle:
+ * x = x + sum_j gamma[j] R[j-1], r = r - sum_j gamma[j] R[j] and
+ * u = u - sum_j gamma[j] U[j], j = 1, ..., l, where r = R[0] and u = U[0].
+ * @return r * r (after the update)
+ */
+double updateBiCGStabL(unsigned n, unsigned l, double const*const gamma,
+		double* const*const R, double* const*const U, double* x);
+
+} // end namespace VectorKernels
+
+} // end namespace MathLib
+
+#endif /* VECTORKERNELS_H_ */
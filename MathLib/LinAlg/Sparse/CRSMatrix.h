@@ -17,12 +17,14 @@
 #include <fstream>
 #include <iostream>
 #include <cassert>
+#include <algorithm>
 
 // Base
 #include "swap.h"
 
 // MathLib
 #include "SparseMatrixBase.h"
+#include "SparsityPattern.h"
 #include "sparse.h"
 #include "amuxCRS.h"
 #include "../Preconditioner/generateDiagPrecond.h"
@@ -35,7 +37,7 @@ class CRSMatrix: public SparseMatrixBase<FP_TYPE, IDX_TYPE>
 public:
 	CRSMatrix(std::string const &fname) :
 		SparseMatrixBase<FP_TYPE, IDX_TYPE>(),
-		_row_ptr(NULL), _col_idx(NULL), _data(NULL)
+		_row_ptr(NULL), _col_idx(NULL), _data(NULL), _pattern(NULL)
 	{
 		std::ifstream in(fname.c_str(), std::ios::in | std::ios::binary);
 		if (in) {
@@ -49,18 +51,39 @@ public:
 
 	CRSMatrix(IDX_TYPE n, IDX_TYPE *iA, IDX_TYPE *jA, FP_TYPE* A) :
 		SparseMatrixBase<FP_TYPE, IDX_TYPE>(n,n),
-		_row_ptr(iA), _col_idx(jA), _data(A)
+		_row_ptr(iA), _col_idx(jA), _data(A), _pattern(NULL)
 	{}
 
+	/**
+	 * Constructs a matrix with a shared sparsity pattern, for instance the
+	 * system matrix of the next time step. The matrix adds a reference to the
+	 * pattern and takes the ownership of the entries. (IDX_TYPE has to be
+	 * unsigned.)
+	 * @param pattern the sparsity pattern
+	 * @param A the entries of the matrix (getNNZ() values)
+	 */
+	CRSMatrix(SparsityPattern const* pattern, FP_TYPE* A) :
+		SparseMatrixBase<FP_TYPE, IDX_TYPE>(pattern->getNRows(), pattern->getNRows()),
+		_row_ptr(const_cast<unsigned*>(pattern->getRowPtrArray())),
+		_col_idx(const_cast<unsigned*>(pattern->getColIdxArray())),
+		_data(A), _pattern(pattern)
+	{
+		_pattern->addReference();
+	}
+
 	CRSMatrix(IDX_TYPE n1) :
 		SparseMatrixBase<FP_TYPE, IDX_TYPE>(n1, n1),
-		_row_ptr(NULL), _col_idx(NULL), _data(NULL)
+		_row_ptr(NULL), _col_idx(NULL), _data(NULL), _pattern(NULL)
 	{}
 
 	virtual ~CRSMatrix()
 	{
-		delete [] _row_ptr;
-		delete [] _col_idx;
+		if (_pattern) {
+			_pattern->release();
+		} else {
+			delete [] _row_ptr;
+			delete [] _col_idx;
+		}
 		delete [] _data;
 	}
 
@@ -69,9 +92,6 @@ public:
 		amuxCRS<FP_TYPE, IDX_TYPE>(d, this->getNRows(), _row_ptr, _col_idx, _data, x, y);
 	}
 
-    virtual void precondApply(FP_TYPE* /*x*/) const
-    {}
-
     /**
      * get the number of non-zero entries
      * @return number of non-zero entries
@@ -197,6 +217,22 @@ public:
 	 */
 	FP_TYPE const* getEntryArray() const { return _data; }
 
+	/**
+	 * Returns the sparsity pattern of the matrix in order to share it with
+	 * other matrices. If the matrix does not use a shared pattern up to now,
+	 * the pattern object is created from the row pointer and column index
+	 * arrays of the matrix. The pattern lives as long as the matrix, use
+	 * SparsityPattern::addReference() to keep it longer. (IDX_TYPE has to be
+	 * unsigned.)
+	 * @return the sparsity pattern
+	 */
+	SparsityPattern const* getSparsityPattern()
+	{
+		if (_pattern == NULL)
+			_pattern = new SparsityPattern(MatrixBase::_n_rows, _row_ptr, _col_idx);
+		return _pattern;
+	}
+
 	/**
 	 * erase rows and columns from sparse matrix
 	 * @param n_rows_cols number of rows / columns to remove
@@ -237,6 +273,16 @@ public:
 
 	CRSMatrix<FP_TYPE, IDX_TYPE>* getTranspose() const
 	{
+		if (_pattern) {
+			// the transposed pattern is computed once, only the entries are gathered
+			unsigned const* data_perm(NULL);
+			SparsityPattern const*const transposed(_pattern->getTranspose(data_perm));
+			const IDX_TYPE nnz(getNNZ());
+			FP_TYPE* data(new FP_TYPE[nnz]);
+			for (IDX_TYPE k(0); k < nnz; k++)
+				data[k] = _data[data_perm[k]];
+			return new CRSMatrix<FP_TYPE, IDX_TYPE>(transposed, data);
+		}
 		CRSMatrix<FP_TYPE, IDX_TYPE>* transposed_mat(new CRSMatrix<FP_TYPE, IDX_TYPE>(*this));
 		transposed_mat->transpose();
 		return transposed_mat;
@@ -246,7 +292,7 @@ protected:
 	CRSMatrix(CRSMatrix const& rhs) :
 		SparseMatrixBase<FP_TYPE, IDX_TYPE> (rhs.getNRows(), rhs.getNCols()),
 		_row_ptr(new IDX_TYPE[rhs.getNRows() + 1]), _col_idx(new IDX_TYPE[rhs.getNNZ()]),
-		_data(new FP_TYPE[rhs.getNNZ()])
+		_data(new FP_TYPE[rhs.getNNZ()]), _pattern(NULL)
 	{
 		// copy the data
 		IDX_TYPE const* row_ptr(rhs.getRowPtrArray());
@@ -266,8 +312,29 @@ protected:
 		}
 	}
 
+	/**
+	 * The matrix gets its own copy of the row pointer and column index
+	 * arrays, the shared pattern is released. Has to be called before the
+	 * pattern of the matrix is changed.
+	 */
+	void detachPattern()
+	{
+		if (_pattern == NULL)
+			return;
+		const IDX_TYPE nnz(getNNZ());
+		IDX_TYPE* row_ptr(new IDX_TYPE[MatrixBase::_n_rows + 1]);
+		std::copy(_row_ptr, _row_ptr + MatrixBase::_n_rows + 1, row_ptr);
+		IDX_TYPE* col_idx(new IDX_TYPE[nnz]);
+		std::copy(_col_idx, _col_idx + nnz, col_idx);
+		_row_ptr = row_ptr;
+		_col_idx = col_idx;
+		_pattern->release();
+		_pattern = NULL;
+	}
+
 	void removeRows (IDX_TYPE n_rows_cols, IDX_TYPE const*const rows)
 	{
+		detachPattern();
 		//*** determine the number of new rows and the number of entries without the rows
 		const IDX_TYPE n_new_rows(MatrixBase::_n_rows - n_rows_cols);
 		IDX_TYPE *row_ptr_new(new IDX_TYPE[n_new_rows+1]);
@@ -345,6 +412,7 @@ protected:
 
 	void transpose ()
 	{
+		detachPattern();
 		// create a helper array row_ptr_nnz
 		IDX_TYPE *row_ptr_nnz(new IDX_TYPE[MatrixBase::_n_cols+1]);
 		for (IDX_TYPE k(0); k <= MatrixBase::_n_cols; k++) {
@@ -413,6 +481,8 @@ protected:
 	IDX_TYPE *_row_ptr;
 	IDX_TYPE *_col_idx;
 	FP_TYPE* _data;
+	/** shared sparsity pattern, NULL if the matrix owns _row_ptr and _col_idx */
+	SparsityPattern const* _pattern;
 };
 
 } // end namespace MathLib
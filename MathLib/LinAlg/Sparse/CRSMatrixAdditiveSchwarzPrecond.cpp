@@ -0,0 +1,285 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file CRSMatrixAdditiveSchwarzPrecond.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <algorithm>
+#include <iostream>
+
+// BaseLib
+#include "quicksort.h"
+
+#include "CRSMatrixAdditiveSchwarzPrecond.h"
+#include "../Solvers/GaussAlgorithm.h"
+#include "../Solvers/SupernodalLDLT.h"
+
+namespace MathLib {
+
+CRSMatrixAdditiveSchwarzPrecond::CRSMatrixAdditiveSchwarzPrecond(std::string const &fname) :
+	CRSMatrix<double, unsigned>(fname), _n_subdomains(0), _sub_ptr(NULL), _sub_idx(NULL),
+	_n_owned(NULL), _solver_type(DENSE_LU), _local_mats(NULL), _dense_solvers(NULL),
+	_sparse_solvers(NULL), _work(NULL), _local_work(NULL)
+{}
+
+CRSMatrixAdditiveSchwarzPrecond::CRSMatrixAdditiveSchwarzPrecond(unsigned n, unsigned *iA,
+		unsigned *jA, double* A) :
+	CRSMatrix<double, unsigned>(n, iA, jA, A), _n_subdomains(0), _sub_ptr(NULL), _sub_idx(NULL),
+	_n_owned(NULL), _solver_type(DENSE_LU), _local_mats(NULL), _dense_solvers(NULL),
+	_sparse_solvers(NULL), _work(NULL), _local_work(NULL)
+{}
+
+CRSMatrixAdditiveSchwarzPrecond::~CRSMatrixAdditiveSchwarzPrecond()
+{
+	clear();
+}
+
+void CRSMatrixAdditiveSchwarzPrecond::clear()
+{
+	for (unsigned k(0); k < _n_subdomains; k++) {
+		if (_dense_solvers)
+			delete _dense_solvers[k];
+		if (_local_mats)
+			delete _local_mats[k];
+		if (_sparse_solvers)
+			delete _sparse_solvers[k];
+	}
+	delete [] _dense_solvers;
+	delete [] _local_mats;
+	delete [] _sparse_solvers;
+	delete [] _sub_ptr;
+	delete [] _sub_idx;
+	delete [] _n_owned;
+	delete [] _work;
+	delete [] _local_work;
+
+	_n_subdomains = 0;
+	_dense_solvers = NULL;
+	_local_mats = NULL;
+	_sparse_solvers = NULL;
+	_sub_ptr = NULL;
+	_sub_idx = NULL;
+	_n_owned = NULL;
+	_work = NULL;
+	_local_work = NULL;
+}
+
+void CRSMatrixAdditiveSchwarzPrecond::calcPrecond(unsigned n_intervals,
+		unsigned const*const interval_ptr, unsigned const*const op_perm,
+		unsigned max_block_size, unsigned overlap, LocalSolverType solver_type)
+{
+	clear();
+	_solver_type = solver_type;
+	if (max_block_size == 0)
+		max_block_size = 1;
+
+	// *** split the intervals into subdomains
+	std::vector<unsigned> sub_beg;
+	for (unsigned k(0); k < n_intervals; k++) {
+		const unsigned size(interval_ptr[k + 1] - interval_ptr[k]);
+		if (size == 0)
+			continue;
+		const unsigned n_parts((size + max_block_size - 1) / max_block_size);
+		for (unsigned j(0); j < n_parts; j++)
+			sub_beg.push_back(interval_ptr[k] + (j * size) / n_parts);
+	}
+	_n_subdomains = sub_beg.size();
+	sub_beg.push_back(interval_ptr[n_intervals]);
+
+	// *** compute the (enlarged) index sets of the subdomains
+	std::vector<std::vector<unsigned> > sub_idx(_n_subdomains);
+	_n_owned = new unsigned[_n_subdomains];
+	const OPENMP_LOOP_TYPE n_subdomains(_n_subdomains);
+	#pragma omp parallel
+	{
+		unsigned* marker(overlap > 0 ? new unsigned[_n_rows] : NULL);
+		if (marker)
+			std::fill(marker, marker + _n_rows, _n_subdomains);
+
+		OPENMP_LOOP_TYPE k;
+		#pragma omp for schedule(dynamic)
+		for (k = 0; k < n_subdomains; k++) {
+			std::vector<unsigned> &idx(sub_idx[k]);
+			for (unsigned i(sub_beg[k]); i < sub_beg[k + 1]; i++)
+				idx.push_back(op_perm ? op_perm[i] : i);
+			_n_owned[k] = idx.size();
+			if (marker)
+				addOverlap(k, overlap, marker, idx);
+		}
+		delete [] marker;
+	}
+
+	// *** store the index sets consecutively
+	_sub_ptr = new unsigned[_n_subdomains + 1];
+	_sub_ptr[0] = 0;
+	for (unsigned k(0); k < _n_subdomains; k++)
+		_sub_ptr[k + 1] = _sub_ptr[k] + sub_idx[k].size();
+	_sub_idx = new unsigned[_sub_ptr[_n_subdomains]];
+	for (unsigned k(0); k < _n_subdomains; k++)
+		std::copy(sub_idx[k].begin(), sub_idx[k].end(), _sub_idx + _sub_ptr[k]);
+
+	_work = new double[_n_rows];
+	_local_work = new double[_sub_ptr[_n_subdomains]];
+
+	// *** factorize the subdomain matrices in parallel
+	// (the dense solvers are also the fall back for failed sparse factorizations)
+	_local_mats = new Matrix<double>*[_n_subdomains];
+	_dense_solvers = new GaussAlgorithm*[_n_subdomains];
+	std::fill(_local_mats, _local_mats + _n_subdomains, static_cast<Matrix<double>*>(NULL));
+	std::fill(_dense_solvers, _dense_solvers + _n_subdomains, static_cast<GaussAlgorithm*>(NULL));
+	if (_solver_type == SPARSE_LDLT) {
+		_sparse_solvers = new SupernodalLDLT*[_n_subdomains];
+		std::fill(_sparse_solvers, _sparse_solvers + _n_subdomains, static_cast<SupernodalLDLT*>(NULL));
+	}
+
+	#pragma omp parallel
+	{
+		unsigned* g2l(new unsigned[_n_rows]);
+		std::fill(g2l, g2l + _n_rows, _n_rows);
+
+		OPENMP_LOOP_TYPE k;
+		#pragma omp for schedule(dynamic)
+		for (k = 0; k < n_subdomains; k++)
+			factorizeSubdomain(k, g2l);
+		delete [] g2l;
+	}
+}
+
+void CRSMatrixAdditiveSchwarzPrecond::addOverlap(unsigned k, unsigned overlap,
+		unsigned* marker, std::vector<unsigned> &idx) const
+{
+	for (std::size_t i(0); i < idx.size(); i++)
+		marker[idx[i]] = k;
+
+	std::size_t layer_beg(0);
+	for (unsigned l(0); l < overlap; l++) {
+		const std::size_t layer_end(idx.size());
+		for (std::size_t i(layer_beg); i < layer_end; i++) {
+			const unsigned row(idx[i]);
+			for (unsigned j(_row_ptr[row]); j < _row_ptr[row + 1]; j++) {
+				const unsigned col(_col_idx[j]);
+				if (marker[col] != k) {
+					marker[col] = k;
+					idx.push_back(col);
+				}
+			}
+		}
+		layer_beg = layer_end;
+	}
+}
+
+void CRSMatrixAdditiveSchwarzPrecond::factorizeSubdomain(unsigned k, unsigned* g2l)
+{
+	unsigned const*const idx(_sub_idx + _sub_ptr[k]);
+	const unsigned m(_sub_ptr[k + 1] - _sub_ptr[k]);
+	for (unsigned i(0); i < m; i++)
+		g2l[idx[i]] = i;
+
+	if (_solver_type == SPARSE_LDLT) {
+		// count the entries of the local matrix
+		unsigned* row_ptr(new unsigned[m + 1]);
+		row_ptr[0] = 0;
+		for (unsigned i(0); i < m; i++) {
+			const unsigned row(idx[i]);
+			unsigned cnt(0);
+			for (unsigned j(_row_ptr[row]); j < _row_ptr[row + 1]; j++)
+				if (g2l[_col_idx[j]] < m)
+					cnt++;
+			row_ptr[i + 1] = row_ptr[i] + cnt;
+		}
+		unsigned* col_idx(new unsigned[row_ptr[m]]);
+		double* data(new double[row_ptr[m]]);
+		for (unsigned i(0); i < m; i++) {
+			const unsigned row(idx[i]);
+			unsigned pos(row_ptr[i]);
+			for (unsigned j(_row_ptr[row]); j < _row_ptr[row + 1]; j++) {
+				const unsigned col(g2l[_col_idx[j]]);
+				if (col < m) {
+					col_idx[pos] = col;
+					data[pos] = _data[j];
+					pos++;
+				}
+			}
+			// the local column indices have to be sorted
+			BaseLib::quicksort(col_idx, row_ptr[i], row_ptr[i + 1], data);
+		}
+		// the local matrix takes the ownership of the arrays
+		CRSMatrix<double, unsigned> local_mat(m, row_ptr, col_idx, data);
+		_sparse_solvers[k] = new SupernodalLDLT(local_mat);
+		if (!_sparse_solvers[k]->isFactorized()) {
+			// zero pivot: the subdomain matrix is singular or the pivoting free
+			// LDL^T is unstable for it, the subdomain is solved by Gauss instead
+			delete _sparse_solvers[k];
+			_sparse_solvers[k] = NULL;
+			#pragma omp critical
+			std::cerr << "Warning in CRSMatrixAdditiveSchwarzPrecond::calcPrecond(): "
+				<< "LDL^T factorization of subdomain " << k << " failed, using Gauss" << std::endl;
+		}
+	}
+
+	if (_solver_type == DENSE_LU || _sparse_solvers[k] == NULL) {
+		Matrix<double>* mat(new Matrix<double>(m, m, 0.0));
+		for (unsigned i(0); i < m; i++) {
+			const unsigned row(idx[i]);
+			for (unsigned j(_row_ptr[row]); j < _row_ptr[row + 1]; j++) {
+				const unsigned col(g2l[_col_idx[j]]);
+				if (col < m)
+					(*mat)(i, col) = _data[j];
+			}
+		}
+		_local_mats[k] = mat;
+		_dense_solvers[k] = new GaussAlgorithm(*mat);
+	}
+
+	for (unsigned i(0); i < m; i++)
+		g2l[idx[i]] = _n_rows;
+}
+
+unsigned CRSMatrixAdditiveSchwarzPrecond::getMaxSubdomainSize() const
+{
+	unsigned max_size(0);
+	for (unsigned k(0); k < _n_subdomains; k++)
+		max_size = std::max(max_size, _sub_ptr[k + 1] - _sub_ptr[k]);
+	return max_size;
+}
+
+void CRSMatrixAdditiveSchwarzPrecond::precondApply(double* x) const
+{
+	const OPENMP_LOOP_TYPE n(_n_rows);
+	const OPENMP_LOOP_TYPE n_subdomains(_n_subdomains);
+	OPENMP_LOOP_TYPE k;
+
+	#pragma omp parallel
+	{
+		#pragma omp for
+		for (k = 0; k < n; k++)
+			_work[k] = x[k];
+
+		#pragma omp for schedule(dynamic)
+		for (k = 0; k < n_subdomains; k++) {
+			unsigned const*const idx(_sub_idx + _sub_ptr[k]);
+			double* const y(_local_work + _sub_ptr[k]);
+			const unsigned m(_sub_ptr[k + 1] - _sub_ptr[k]);
+
+			for (unsigned i(0); i < m; i++)
+				y[i] = _work[idx[i]];
+
+			if (_dense_solvers[k])
+				_dense_solvers[k]->execute(y);
+			else
+				_sparse_solvers[k]->execute(y);
+
+			// restriction: only the owned entries are written back
+			for (unsigned i(0); i < _n_owned[k]; i++)
+				x[idx[i]] = y[i];
+		}
+	}
+}
+
+} // end namespace MathLib
@@ -0,0 +1,148 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file CRSMatrixAdditiveSchwarzPrecond.h
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#ifndef CRSMATRIXADDITIVESCHWARZPRECOND_H_
+#define CRSMATRIXADDITIVESCHWARZPRECOND_H_
+
+#include <vector>
+
+#include "CRSMatrix.h"
+#include "../Dense/Matrix.h"
+
+namespace MathLib {
+
+// forward declarations
+class GaussAlgorithm;
+class SupernodalLDLT;
+
+/**
+ * Class CRSMatrixAdditiveSchwarzPrecond represents a matrix in compressed row
+ * storage format associated with a (restricted) additive Schwarz
+ * preconditioner. The index set is decomposed into subdomains, usually the
+ * leaves of the nested dissection cluster tree (see
+ * ClusterBase::getLeafIntervals()), which are contiguous in the permuted
+ * numbering. Every subdomain can be enlarged by some layers of neighbours in
+ * the matrix graph (overlap). The diagonal blocks of the matrix belonging to
+ * the (enlarged) subdomains are factorized in parallel, either with the dense
+ * GaussAlgorithm or with the sparse SupernodalLDLT (symmetric matrices).
+ * SupernodalLDLT does not pivot, if it meets a zero pivot the subdomain is
+ * solved by GaussAlgorithm instead and a warning is printed.
+ *
+ * precondApply() solves the local systems concurrently. The local solutions
+ * are written back only to the indices owned by the subdomain (restricted
+ * additive Schwarz), hence every entry is written exactly once and no
+ * synchronisation is necessary. Without overlap the preconditioner is the
+ * block Jacobi method. The preconditioner is not symmetric in general and is
+ * intended for BiCGStab() and GMRes().
+ */
+class CRSMatrixAdditiveSchwarzPrecond : public CRSMatrix<double, unsigned>
+{
+public:
+	/** the type of the solvers for the subdomain problems */
+	enum LocalSolverType {
+		DENSE_LU, //!< GaussAlgorithm
+		SPARSE_LDLT //!< SupernodalLDLT, requires symmetric subdomain matrices, GaussAlgorithm if the factorization fails
+	};
+
+	/**
+	 * Constructor takes a file name. The file is read in binary format
+	 * by the constructor of the base class (template) CRSMatrix.
+	 *
+	 * The user have to calculate the preconditioner explicit via calcPrecond() method!
+	 * @param fname the name of the file that contains the matrix in
+	 * binary compressed row storage format
+	 */
+	CRSMatrixAdditiveSchwarzPrecond(std::string const &fname);
+
+	/**
+	 * Constructs a matrix object from given data.
+	 *
+	 * The user have to calculate the preconditioner explicit via calcPrecond() method!
+	 * @param n number of rows / columns of the matrix
+	 * @param iA row pointer of matrix in compressed row storage format
+	 * @param jA column index of matrix in compressed row storage format
+	 * @param A data entries of matrix in compressed row storage format
+	 */
+	CRSMatrixAdditiveSchwarzPrecond(unsigned n, unsigned *iA, unsigned *jA, double* A);
+
+	virtual ~CRSMatrixAdditiveSchwarzPrecond();
+
+	/**
+	 * Sets up the subdomains and factorizes the subdomain matrices.
+	 * @param n_intervals number of index intervals (for instance the leaves of
+	 * the cluster tree)
+	 * @param interval_ptr interval k consists of the permuted indices
+	 * [interval_ptr[k], interval_ptr[k+1]), the intervals have to cover all indices
+	 * @param op_perm permutation: original_idx = op_perm[permuted_idx], if NULL
+	 * the identity is used
+	 * @param max_block_size intervals with more indices are split into
+	 * consecutive parts of equal size
+	 * @param overlap number of layers of neighbours added to every subdomain
+	 * @param solver_type the solver for the subdomain problems
+	 */
+	void calcPrecond(unsigned n_intervals, unsigned const*const interval_ptr,
+			unsigned const*const op_perm, unsigned max_block_size,
+			unsigned overlap = 0, LocalSolverType solver_type = DENSE_LU);
+
+	/** @return the number of subdomains */
+	unsigned getNSubdomains() const { return _n_subdomains; }
+
+	/** @return the number of indices of the largest (enlarged) subdomain */
+	unsigned getMaxSubdomainSize() const;
+
+	/**
+	 * Applies the preconditioner: the local systems are solved in parallel.
+	 * @param x at the beginning the vector, at the end the preconditioned vector
+	 */
+	void precondApply(double* x) const;
+
+private:
+	/** frees the data of the subdomains */
+	void clear();
+
+	/**
+	 * enlarges the index set idx of subdomain k by overlap layers of neighbours
+	 * @param marker work array of size n, entries equal to k mark members of idx
+	 */
+	void addOverlap(unsigned k, unsigned overlap, unsigned* marker, std::vector<unsigned> &idx) const;
+
+	/**
+	 * extracts and factorizes the matrix of subdomain k
+	 * @param g2l work array of size n, all entries have to be _n_rows
+	 */
+	void factorizeSubdomain(unsigned k, unsigned* g2l);
+
+	/** number of subdomains */
+	unsigned _n_subdomains;
+	/** indices of subdomain k: _sub_idx[_sub_ptr[k]], ..., _sub_idx[_sub_ptr[k+1]-1] */
+	unsigned* _sub_ptr;
+	/** the owned indices of a subdomain are stored before the overlap indices */
+	unsigned* _sub_idx;
+	/** number of indices owned by subdomain k */
+	unsigned* _n_owned;
+	/** the type of the local solvers */
+	LocalSolverType _solver_type;
+	/** matrices of the subdomains solved by Gauss (NULL for the others), overwritten by the factors */
+	Matrix<double>** _local_mats;
+	/** dense local solvers (NULL if the subdomain is solved by SupernodalLDLT) */
+	GaussAlgorithm** _dense_solvers;
+	/** sparse local solvers (SPARSE_LDLT, NULL if the factorization failed) */
+	SupernodalLDLT** _sparse_solvers;
+	/** copy of the input vector of precondApply() */
+	double* _work;
+	/** local vectors of the subdomains, same layout as _sub_idx */
+	double* _local_work;
+};
+
+} // end namespace MathLib
+
+#endif /* CRSMATRIXADDITIVESCHWARZPRECOND_H_ */
@@ -0,0 +1,296 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file CRSMatrixAutotuned.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifdef HAVE_PTHREADS
+#include <unistd.h>
+#endif
+
+// BaseLib
+#include "RunTime.h"
+
+#include "CRSMatrixAutotuned.h"
+#include "amuxCRS.h"
+
+namespace MathLib {
+
+/** number of timed repetitions per candidate, the fastest one counts */
+static const unsigned N_BENCHMARK_RUNS(3);
+/** number of matrix vector multiplications per timed repetition */
+static const unsigned N_MULTS_PER_RUN(10);
+
+CRSMatrixAutotuned::CRSMatrixAutotuned(std::string const &fname, std::string const& cache_fname) :
+	CRSMatrix<double, unsigned>(fname), _cache_fname(cache_fname),
+	_kernel(SEQUENTIAL), _n_threads(1), _workload(NULL)
+{
+	tune();
+}
+
+CRSMatrixAutotuned::CRSMatrixAutotuned(unsigned n, unsigned *iA, unsigned *jA, double* A,
+		std::string const& cache_fname) :
+	CRSMatrix<double, unsigned>(n, iA, jA, A), _cache_fname(cache_fname),
+	_kernel(SEQUENTIAL), _n_threads(1), _workload(NULL)
+{
+	tune();
+}
+
+CRSMatrixAutotuned::~CRSMatrixAutotuned()
+{
+	delete [] _workload;
+}
+
+void CRSMatrixAutotuned::amux(double d, double const * const __restrict__ x,
+		double * __restrict__ y) const
+{
+	runKernel(_kernel, _n_threads, _workload, d, x, y);
+}
+
+std::string CRSMatrixAutotuned::getKernelName(KernelType kernel)
+{
+	switch (kernel) {
+	case SEQUENTIAL:
+		return "sequential";
+	case OPENMP:
+		return "openmp";
+	case PTHREADS:
+		return "pthreads";
+	default:
+		return "unknown";
+	}
+}
+
+std::string CRSMatrixAutotuned::getFingerprint() const
+{
+	// two FNV-1a hashes with different offset bases over the sparsity pattern
+	unsigned h0(2166136261u), h1(84696351u);
+	const unsigned prime(16777619u);
+	for (unsigned k(0); k <= _n_rows; k++) {
+		h0 = (h0 ^ _row_ptr[k]) * prime;
+		h1 = (h1 ^ (_row_ptr[k] + k)) * prime;
+	}
+	const unsigned nnz(getNNZ());
+	for (unsigned k(0); k < nnz; k++) {
+		h0 = (h0 ^ _col_idx[k]) * prime;
+		h1 = (h1 ^ (_col_idx[k] + k)) * prime;
+	}
+
+	std::ostringstream os;
+	os << _n_rows << "-" << nnz << "-" << std::hex << h0 << "-" << h1;
+	return os.str();
+}
+
+unsigned CRSMatrixAutotuned::getMaxThreads()
+{
+#ifdef _OPENMP
+	return omp_get_max_threads();
+#else
+	return 1;
+#endif
+}
+
+unsigned CRSMatrixAutotuned::getNProcessors()
+{
+#ifdef HAVE_PTHREADS
+	const long n_procs(sysconf(_SC_NPROCESSORS_ONLN));
+	if (n_procs > 0)
+		return static_cast<unsigned>(n_procs);
+#endif
+	return 1;
+}
+
+std::string CRSMatrixAutotuned::getCacheKey(std::string const& fingerprint)
+{
+	std::ostringstream os;
+	os << fingerprint << " " << getMaxThreads() << " " << getNProcessors();
+	return os.str();
+}
+
+void CRSMatrixAutotuned::calcWorkload(unsigned n_threads, unsigned* workload) const
+{
+	// equal number of non-zero entries per thread
+	const unsigned nnz(getNNZ());
+	workload[0] = 0;
+	for (unsigned k(1); k < n_threads; k++) {
+		const unsigned bound(static_cast<unsigned>((static_cast<double>(nnz) * k) / n_threads));
+		workload[k] = std::lower_bound(_row_ptr + workload[k - 1], _row_ptr + _n_rows, bound) - _row_ptr;
+	}
+	workload[n_threads] = _n_rows;
+}
+
+void CRSMatrixAutotuned::runKernel(KernelType kernel, unsigned n_threads,
+		unsigned const*const workload, double d, double const * const x, double * y) const
+{
+	switch (kernel) {
+#ifdef _OPENMP
+	case OPENMP:
+		amuxCRSParallelOpenMP(d, _n_rows, _row_ptr, _col_idx, _data, x, y,
+				static_cast<int>(n_threads));
+		break;
+#endif
+#ifdef HAVE_PTHREADS
+	case PTHREADS:
+		amuxCRSParallelPThreads(d, _n_rows, _row_ptr, _col_idx, _data, x, y, n_threads, workload);
+		break;
+#endif
+	default:
+		(void) n_threads;
+		(void) workload;
+		amuxCRS<double, unsigned>(d, _n_rows, _row_ptr, _col_idx, _data, x, y);
+	}
+}
+
+double CRSMatrixAutotuned::benchmark(KernelType kernel, unsigned n_threads,
+		double const*const x, double* y) const
+{
+	unsigned* workload(NULL);
+	if (kernel == PTHREADS) {
+		workload = new unsigned[n_threads + 1];
+		calcWorkload(n_threads, workload);
+	}
+
+	// warm up
+	runKernel(kernel, n_threads, workload, 1.0, x, y);
+
+	BaseLib::RunTime timer;
+	double min_time(std::numeric_limits<double>::max());
+	for (unsigned r(0); r < N_BENCHMARK_RUNS; r++) {
+		timer.start();
+		for (unsigned k(0); k < N_MULTS_PER_RUN; k++)
+			runKernel(kernel, n_threads, workload, 1.0, x, y);
+		timer.stop();
+		min_time = std::min(min_time, timer.elapsed() / N_MULTS_PER_RUN);
+	}
+
+	delete [] workload;
+	return min_time;
+}
+
+void CRSMatrixAutotuned::tune(bool force)
+{
+	const std::string fingerprint(getFingerprint());
+
+	if (force || !readCache(fingerprint)) {
+		double* x(new double[_n_rows]);
+		double* y(new double[_n_rows]);
+		for (unsigned k(0); k < _n_rows; k++)
+			x[k] = 1.0;
+
+		_kernel = SEQUENTIAL;
+		_n_threads = 1;
+		double best_time(benchmark(SEQUENTIAL, 1, x, y));
+
+		for (unsigned kernel(SEQUENTIAL + 1); kernel < N_KERNEL_TYPES; kernel++) {
+#ifndef _OPENMP
+			if (kernel == OPENMP)
+				continue;
+#endif
+#ifndef HAVE_PTHREADS
+			if (kernel == PTHREADS)
+				continue;
+#endif
+			const unsigned max_threads(kernel == PTHREADS ? getNProcessors() : getMaxThreads());
+			unsigned n_threads(1);
+			while (n_threads <= max_threads) {
+				const double time(benchmark(static_cast<KernelType>(kernel), n_threads, x, y));
+				if (time < best_time) {
+					best_time = time;
+					_kernel = static_cast<KernelType>(kernel);
+					_n_threads = n_threads;
+				}
+				// test the maximal number of threads even if it is not a power of two
+				if (n_threads < max_threads && 2 * n_threads > max_threads)
+					n_threads = max_threads;
+				else
+					n_threads *= 2;
+			}
+		}
+
+		delete [] x;
+		delete [] y;
+
+		writeCache(fingerprint, best_time);
+	}
+
+	delete [] _workload;
+	_workload = NULL;
+	if (_kernel == PTHREADS) {
+		_workload = new unsigned[_n_threads + 1];
+		calcWorkload(_n_threads, _workload);
+	}
+}
+
+bool CRSMatrixAutotuned::readCache(std::string const& fingerprint)
+{
+	if (_cache_fname.empty())
+		return false;
+	std::ifstream in(_cache_fname.c_str());
+	if (!in)
+		return false;
+
+	// format of a line: fingerprint max_threads n_processors kernel n_threads time
+	const std::string key(getCacheKey(fingerprint));
+	std::string line;
+	while (std::getline(in, line)) {
+		if (line.compare(0, key.size() + 1, key + " ") != 0)
+			continue;
+		std::istringstream is(line.substr(key.size()));
+		std::string kernel_name;
+		unsigned n_threads;
+		if (!(is >> kernel_name >> n_threads))
+			continue;
+		for (unsigned k(0); k < N_KERNEL_TYPES; k++) {
+			if (getKernelName(static_cast<KernelType>(k)) == kernel_name) {
+				_kernel = static_cast<KernelType>(k);
+				_n_threads = n_threads;
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+void CRSMatrixAutotuned::writeCache(std::string const& fingerprint, double time) const
+{
+	if (_cache_fname.empty())
+		return;
+
+	// keep the entries of the other matrices, the file contains at most one line per key
+	const std::string key(getCacheKey(fingerprint));
+	std::vector<std::string> lines;
+	std::ifstream in(_cache_fname.c_str());
+	std::string line;
+	while (std::getline(in, line))
+		if (!line.empty() && line.compare(0, key.size() + 1, key + " ") != 0)
+			lines.push_back(line);
+	in.close();
+
+	std::ofstream out(_cache_fname.c_str(), std::ios::trunc);
+	if (!out) {
+		std::cout << "CRSMatrixAutotuned: could not write " << _cache_fname << std::endl;
+		return;
+	}
+	for (std::size_t k(0); k < lines.size(); k++)
+		out << lines[k] << std::endl;
+	out << key << " " << getKernelName(_kernel) << " " << _n_threads << " " << time << std::endl;
+}
+
+} // end namespace MathLib
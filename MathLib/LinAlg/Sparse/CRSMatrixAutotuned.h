@@ -0,0 +1,135 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file CRSMatrixAutotuned.h
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#ifndef CRSMATRIXAUTOTUNED_H_
+#define CRSMATRIXAUTOTUNED_H_
+
+#include <string>
+
+#include "CRSMatrix.h"
+
+namespace MathLib {
+
+/**
+ * Class CRSMatrixAutotuned is a matrix in compressed row storage format that
+ * selects the fastest available matrix vector multiplication kernel
+ * automatically. The constructor (or an explicit call of tune()) runs every
+ * candidate kernel
+ * - sequential amuxCRS(),
+ * - amuxCRSParallelOpenMP() with 1, 2, 4, ... up to the maximal number of OpenMP threads,
+ * - amuxCRSParallelPThreads() with 1, 2, 4, ... up to the number of processors,
+ * a few times and the fastest one is used by amux(). The number of OpenMP
+ * threads is passed to the parallel region of the kernel, the OpenMP settings
+ * of the process are not changed. Since amux() does not modify the object it
+ * can be called from several threads at the same time.
+ *
+ * Optionally the result is stored in a cache file under a fingerprint of the
+ * sparsity pattern (size, number of non-zeros and a hash of the row pointer
+ * and column index arrays), the number of OpenMP threads and the number of
+ * processors. A matrix with the same fingerprint reuses the cached kernel
+ * without benchmarking.
+ *
+ * Reordered formats (CRSMatrixReordered) are not candidates since they
+ * change the numbering of the vectors seen by the caller.
+ */
+class CRSMatrixAutotuned : public CRSMatrix<double, unsigned>
+{
+public:
+	/** the available kernels */
+	enum KernelType {
+		SEQUENTIAL = 0,
+		OPENMP,
+		PTHREADS,
+		N_KERNEL_TYPES
+	};
+
+	/**
+	 * @param fname the name of the file that contains the matrix in
+	 * binary compressed row storage format
+	 * @param cache_fname the name of the file the tuning results are stored
+	 * in, if empty (default) the results are not cached
+	 */
+	CRSMatrixAutotuned(std::string const &fname,
+			std::string const& cache_fname = "");
+
+	/**
+	 * Constructs a matrix object from given data.
+	 * @param n number of rows / columns of the matrix
+	 * @param iA row pointer of matrix in compressed row storage format
+	 * @param jA column index of matrix in compressed row storage format
+	 * @param A data entries of matrix in compressed row storage format
+	 * @param cache_fname the name of the file the tuning results are stored
+	 * in, if empty (default) the results are not cached
+	 */
+	CRSMatrixAutotuned(unsigned n, unsigned *iA, unsigned *jA, double* A,
+			std::string const& cache_fname = "");
+
+	virtual ~CRSMatrixAutotuned();
+
+	/**
+	 * Matrix vector multiplication \f$y = d A x\f$ with the selected kernel.
+	 */
+	virtual void amux(double d, double const * const __restrict__ x, double * __restrict__ y) const;
+
+	/**
+	 * Selects the kernel: either the cached result for the fingerprint of the
+	 * matrix is used or all candidates are benchmarked. The constructors call
+	 * tune(), calling it again must not overlap with calls of amux().
+	 * @param force if true the candidates are benchmarked even if a cached
+	 * result exists
+	 */
+	void tune(bool force = false);
+
+	/** @return the selected kernel */
+	KernelType getKernelType() const { return _kernel; }
+	/** @return the number of threads used by the selected kernel */
+	unsigned getNThreads() const { return _n_threads; }
+	/** @return a readable name of the kernel */
+	static std::string getKernelName(KernelType kernel);
+
+	/** @return the fingerprint of the matrix used as key in the cache file */
+	std::string getFingerprint() const;
+
+private:
+	/** runs the kernel with the given number of threads */
+	void runKernel(KernelType kernel, unsigned n_threads, unsigned const*const workload,
+			double d, double const * const x, double * y) const;
+
+	/** measures the time for one matrix vector multiplication */
+	double benchmark(KernelType kernel, unsigned n_threads, double const*const x, double* y) const;
+
+	/** looks for the fingerprint in the cache file */
+	bool readCache(std::string const& fingerprint);
+	/** stores the selected kernel in the cache file, replacing an older entry for the fingerprint */
+	void writeCache(std::string const& fingerprint, double time) const;
+
+	/** computes balanced row intervals for the pthreads kernel */
+	void calcWorkload(unsigned n_threads, unsigned* workload) const;
+
+	/** @return the maximal number of OpenMP threads */
+	static unsigned getMaxThreads();
+	/** @return the number of processors, the maximal number of threads of the pthreads kernel */
+	static unsigned getNProcessors();
+	/** @return the part of a cache file line that has to match: fingerprint, OpenMP threads, processors */
+	static std::string getCacheKey(std::string const& fingerprint);
+
+	/** name of the cache file */
+	const std::string _cache_fname;
+	KernelType _kernel;
+	unsigned _n_threads;
+	/** row intervals for the pthreads kernel */
+	unsigned* _workload;
+};
+
+} // end namespace MathLib
+
+#endif /* CRSMATRIXAUTOTUNED_H_ */
@@ -0,0 +1,263 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file CRSMatrixChebyshevPrecond.h
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#ifndef CRSMATRIXCHEBYSHEVPRECOND_H_
+#define CRSMATRIXCHEBYSHEVPRECOND_H_
+
+#include <cmath>
+#include <iostream>
+
+#include "CRSMatrix.h"
+#include "../Solvers/blas.h"
+#include "../Preconditioner/generateDiagPrecond.h"
+#include "../Preconditioner/tridiagonalEigenvalues.h"
+
+namespace MathLib {
+
+/**
+ * Class CRSMatrixChebyshevPrecond represents a matrix in compressed row
+ * storage format associated with a (Jacobi scaled) Chebyshev polynomial
+ * preconditioner \f$P = p_k(D^{-1} A) D^{-1}\f$. The polynomial \f$p_k\f$ of
+ * degree k is the Chebyshev approximation of \f$1/\lambda\f$ on the interval
+ * \f$[\lambda_{min}, \lambda_{max}]\f$ that contains the spectrum of
+ * \f$D^{-1} A\f$. The application of the preconditioner consists of k-1 matrix
+ * vector products and vector updates only, no scalar products (global
+ * reductions) are required.
+ *
+ * The extreme eigenvalues are estimated in calcPrecond() by a few steps of the
+ * Lanczos method applied to \f$D^{-1/2} A D^{-1/2}\f$. For a symmetric positive
+ * definite matrix the preconditioner is symmetric positive definite as long as
+ * \f$\lambda_{max}\f$ is not underestimated, hence the Lanczos estimate is
+ * enlarged by a safety factor. The preconditioner can be used within CG().
+ *
+ * The same polynomial restricted to the upper part of the spectrum can be
+ * used as smoother, see smooth().
+ */
+class CRSMatrixChebyshevPrecond : public CRSMatrix<double, unsigned>
+{
+public:
+	/**
+	 * Constructor takes a file name. The file is read in binary format
+	 * by the constructor of the base class (template) CRSMatrix.
+	 *
+	 * The user have to calculate the preconditioner explicit via calcPrecond() method!
+	 * @param fname the name of the file that contains the matrix in
+	 * binary compressed row storage format
+	 */
+	CRSMatrixChebyshevPrecond(std::string const &fname) :
+		CRSMatrix<double, unsigned> (fname), _degree(0), _lambda_min(0.0), _lambda_max(0.0),
+		_inv_diag(NULL), _work(NULL)
+	{}
+
+	/**
+	 * Constructs a matrix object from given data.
+	 *
+	 * The user have to calculate the preconditioner explicit via calcPrecond() method!
+	 * @param n number of rows / columns of the matrix
+	 * @param iA row pointer of matrix in compressed row storage format
+	 * @param jA column index of matrix in compressed row storage format
+	 * @param A data entries of matrix in compressed row storage format
+	 */
+	CRSMatrixChebyshevPrecond(unsigned n, unsigned *iA, unsigned *jA, double* A) :
+		CRSMatrix<double, unsigned> (n, iA, jA, A), _degree(0), _lambda_min(0.0), _lambda_max(0.0),
+		_inv_diag(NULL), _work(NULL)
+	{}
+
+	~CRSMatrixChebyshevPrecond()
+	{
+		delete [] _inv_diag;
+		delete [] _work;
+	}
+
+	/**
+	 * Computes the inverse diagonal and estimates the extreme eigenvalues of
+	 * \f$D^{-1} A\f$.
+	 * @param degree the degree of the Chebyshev residual polynomial (the
+	 * number of matrix vector products per application is degree-1)
+	 * @param n_lanczos_steps number of Lanczos steps for the eigenvalue estimation
+	 */
+	void calcPrecond(unsigned degree = 4, unsigned n_lanczos_steps = 20)
+	{
+		_degree = degree;
+		delete [] _inv_diag;
+		_inv_diag = new double[_n_rows];
+		delete [] _work;
+		_work = new double[4 * _n_rows];
+
+		if (!generateDiagPrecond(_n_rows, _row_ptr, _col_idx, _data, _inv_diag)) {
+			std::cout << "Could not create diagonal scaling for Chebyshev preconditioner" << std::endl;
+		}
+
+		estimateEigenvalues(n_lanczos_steps);
+	}
+
+	/**
+	 * Sets the bounds of the spectrum of \f$D^{-1} A\f$ explicitly, for
+	 * instance if they are known analytically. Has to be called after calcPrecond().
+	 */
+	void setEigenvalueBounds(double lambda_min, double lambda_max)
+	{
+		_lambda_min = lambda_min;
+		_lambda_max = lambda_max;
+	}
+
+	double getLambdaMin() const { return _lambda_min; }
+	double getLambdaMax() const { return _lambda_max; }
+	unsigned getDegree() const { return _degree; }
+
+	/**
+	 * Applies the preconditioner, i.e. x is overwritten by
+	 * \f$p_k(D^{-1} A) D^{-1} x\f$.
+	 */
+	void precondApply(double* x) const
+	{
+		applyPolynomial(_lambda_min, _lambda_max, x, x);
+	}
+
+	/**
+	 * Chebyshev smoothing step \f$x = x + p_k(D^{-1} A) D^{-1} (b - A x)\f$,
+	 * where the polynomial damps the eigenvectors belonging to the interval
+	 * \f$[\lambda_{max} / ratio, \lambda_{max}]\f$ (the oscillatory components).
+	 * @param b right hand side
+	 * @param x current approximation, overwritten by the smoothed approximation
+	 * @param ratio the ratio between the upper and the lower bound of the
+	 * smoothing interval
+	 */
+	void smooth(double const*const b, double* x, double ratio = 30.0) const
+	{
+		double* const r(_work + 3 * _n_rows);
+		amux(D_ONE, x, r);
+		OPENMP_LOOP_TYPE k;
+		const OPENMP_LOOP_TYPE n(_n_rows);
+		#pragma omp parallel for
+		for (k = 0; k < n; k++)
+			r[k] = b[k] - r[k];
+		applyPolynomial(_lambda_max / ratio, _lambda_max, r, r);
+		#pragma omp parallel for
+		for (k = 0; k < n; k++)
+			x[k] += r[k];
+	}
+
+private:
+	/**
+	 * Computes \f$z = p_k(D^{-1} A) D^{-1} r\f$ by k steps of the Chebyshev
+	 * iteration for \f$A z = r\f$ with \f$z_0 = 0\f$ (see Saad, Iterative
+	 * methods for sparse linear systems, algorithm 12.1). The vectors r and z
+	 * may be identical.
+	 */
+	void applyPolynomial(double lambda_min, double lambda_max, double const*const r, double* z) const
+	{
+		const OPENMP_LOOP_TYPE n(_n_rows);
+		double* const res(_work);
+		double* const d(_work + _n_rows);
+		double* const q(_work + 2 * _n_rows);
+
+		const double theta(0.5 * (lambda_max + lambda_min));
+		const double delta(0.5 * (lambda_max - lambda_min));
+		const double sigma(theta / delta);
+		double rho(1.0 / sigma);
+
+		OPENMP_LOOP_TYPE k;
+		#pragma omp parallel for
+		for (k = 0; k < n; k++) {
+			res[k] = _inv_diag[k] * r[k];
+			d[k] = res[k] / theta;
+			z[k] = d[k];
+		}
+
+		for (unsigned j(1); j < _degree; j++) {
+			// res = res - D^{-1} A d
+			amux(D_ONE, d, q);
+			const double rho_new(1.0 / (2.0 * sigma - rho));
+			const double c0(rho_new * rho), c1(2.0 * rho_new / delta);
+			#pragma omp parallel for
+			for (k = 0; k < n; k++) {
+				res[k] -= _inv_diag[k] * q[k];
+				d[k] = c0 * d[k] + c1 * res[k];
+				z[k] += d[k];
+			}
+			rho = rho_new;
+		}
+	}
+
+	/**
+	 * Estimates the extreme eigenvalues of \f$D^{-1/2} A D^{-1/2}\f$ (having the
+	 * same spectrum as \f$D^{-1} A\f$) by the Lanczos method.
+	 */
+	void estimateEigenvalues(unsigned n_steps)
+	{
+		const unsigned n(_n_rows);
+		if (n == 0 || n_steps == 0)
+			return;
+
+		double* const v_old(_work);
+		double* const v(_work + n);
+		double* const w(_work + 2 * n);
+		double* const t(_work + 3 * n);
+		double* const alpha(new double[n_steps]);
+		double* const beta(new double[n_steps]);
+
+		// deterministic start vector
+		for (unsigned k(0); k < n; k++) {
+			v_old[k] = 0.0;
+			v[k] = 1.0 + static_cast<double>(k % 7) / 7.0;
+		}
+		blas::scal(n, 1.0 / blas::nrm2(n, v), v);
+
+		unsigned m(0);
+		double beta_old(0.0);
+		for (unsigned j(0); j < n_steps; j++) {
+			// w = D^{-1/2} A D^{-1/2} v
+			for (unsigned k(0); k < n; k++)
+				t[k] = sqrt(_inv_diag[k]) * v[k];
+			amux(D_ONE, t, w);
+			for (unsigned k(0); k < n; k++)
+				w[k] *= sqrt(_inv_diag[k]);
+
+			alpha[j] = blas::scpr(n, w, v);
+			blas::axpy(n, -alpha[j], v, w);
+			blas::axpy(n, -beta_old, v_old, w);
+			beta[j] = blas::nrm2(n, w);
+			m = j + 1;
+			if (beta[j] <= 1e-12 * fabs(alpha[j]))
+				break;
+
+			blas::copy(n, v, v_old);
+			blas::copy(n, w, v);
+			blas::scal(n, 1.0 / beta[j], v);
+			beta_old = beta[j];
+		}
+
+		double ritz_min, ritz_max;
+		tridiagonalExtremeEigenvalues(m, alpha, beta, ritz_min, ritz_max);
+		// the Ritz values lie inside the spectrum - enlarge the interval
+		_lambda_max = 1.1 * ritz_max;
+		_lambda_min = (m < n) ? 0.5 * ritz_min : ritz_min;
+
+		delete [] beta;
+		delete [] alpha;
+	}
+
+	/** degree of the polynomial */
+	unsigned _degree;
+	/** estimated bounds of the spectrum of \f$D^{-1} A\f$ */
+	double _lambda_min;
+	double _lambda_max;
+	/** inverse entries of the diagonal */
+	double *_inv_diag;
+	/** work vectors for the application of the polynomial and for smooth() */
+	double *_work;
+};
+
+} // end namespace MathLib
+
+#endif /* CRSMATRIXCHEBYSHEVPRECOND_H_ */
@@ -51,12 +51,31 @@ public:
 		CRSMatrix<double, unsigned> (n, iA, jA, A), _inv_diag(NULL)
 	{}
 
+	/**
+	 * Constructs a matrix object with a shared sparsity pattern. The
+	 * positions of the diagonal entries are cached in the pattern, i.e.
+	 * calcPrecond() does not search the rows.
+	 *
+	 * The user have to calculate the preconditioner explicit via calcPrecond() method!
+	 * @param pattern the sparsity pattern
+	 * @param A data entries of matrix in compressed row storage format
+	 */
+	CRSMatrixDiagPrecond(SparsityPattern const* pattern, double* A) :
+		CRSMatrix<double, unsigned> (pattern, A), _inv_diag(NULL)
+	{}
+
 	void calcPrecond()
 	{
 		if (_inv_diag != NULL)
 			delete [] _inv_diag;
 		_inv_diag = new double[_n_rows];
 
+		if (_pattern) {
+			if (!generateDiagPrecondFromPositions(_n_rows, getNNZ(), _pattern->getDiagonalPositions(), _data, _inv_diag)) {
+				std::cout << "Could not create diagonal preconditioner" << std::endl;
+			}
+			return;
+		}
 		if (!generateDiagPrecond(_n_rows, _row_ptr, _col_idx, _data, _inv_diag)) {
 			std::cout << "Could not create diagonal preconditioner" << std::endl;
 		}
@@ -39,6 +39,17 @@ public:
 		calcWorkload();
 	}
 
+	/**
+	 * Constructs a matrix with a shared sparsity pattern, the workload
+	 * intervals are computed only once for the pattern.
+	 */
+	CRSMatrixPThreads(SparsityPattern const* pattern, T* A, unsigned num_of_threads) :
+		CRSMatrix<T,unsigned>(pattern, A), _n_threads (num_of_threads),
+		_workload_intervals(new unsigned[num_of_threads+1])
+	{
+		calcWorkload();
+	}
+
 	CRSMatrixPThreads(unsigned n1) :
 		CRSMatrix<T,unsigned>(n1), _n_threads (1),
 		_workload_intervals(new unsigned[_n_threads+1])
@@ -61,6 +72,13 @@ public:
 protected:
 	void calcWorkload()
 	{
+		if (this->_pattern) {
+			unsigned const*const workload(this->_pattern->getWorkload(_n_threads));
+			for (unsigned k(0); k<=_n_threads; k++)
+				_workload_intervals[k] = workload[k];
+			return;
+		}
+
 		_workload_intervals[0] = 0;
 		_workload_intervals[_n_threads] = SparseMatrixBase<T, unsigned>::_n_rows;
 
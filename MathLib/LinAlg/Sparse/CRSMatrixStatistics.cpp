@@ -0,0 +1,211 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file CRSMatrixStatistics.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "CRSMatrixStatistics.h"
+
+namespace MathLib {
+
+namespace {
+
+/** @return the position of the entry (i,j) in jA or not_found if it is not in the pattern */
+unsigned findEntry(unsigned i, unsigned j, unsigned const*const iA, unsigned const*const jA,
+		bool sorted, unsigned not_found)
+{
+	unsigned const*const beg(jA + iA[i]);
+	unsigned const*const end(jA + iA[i + 1]);
+	unsigned const* pos;
+	if (sorted) {
+		pos = std::lower_bound(beg, end, j);
+		if (pos != end && *pos != j)
+			pos = end;
+	} else
+		pos = std::find(beg, end, j);
+	return pos == end ? not_found : static_cast<unsigned>(pos - jA);
+}
+
+/** number of aligned b x b blocks containing at least one non-zero entry */
+double countBlocks(unsigned n, unsigned const*const iA, unsigned const*const jA, unsigned b)
+{
+	const unsigned n_block_rows((n + b - 1) / b);
+	std::vector<unsigned> last_block_row(n_block_rows, std::numeric_limits<unsigned>::max());
+	double n_blocks(0.0);
+	for (unsigned I(0); I < n_block_rows; I++) {
+		const unsigned row_end(std::min((I + 1) * b, n));
+		for (unsigned i(I * b); i < row_end; i++) {
+			for (unsigned k(iA[i]); k < iA[i + 1]; k++) {
+				const unsigned J(jA[k] / b);
+				if (last_block_row[J] != I) {
+					last_block_row[J] = I;
+					n_blocks += 1.0;
+				}
+			}
+		}
+	}
+	return n_blocks;
+}
+
+} // end anonymous namespace
+
+void computeCRSMatrixStatistics(unsigned n, unsigned const*const iA, unsigned const*const jA,
+		double const*const A, CRSMatrixStatistics &stats, unsigned max_block_size,
+		double block_fill_tol)
+{
+	stats.n_rows = n;
+	stats.nnz = iA[n];
+
+	// distribution of the non-zeros per row, distance to the diagonal
+	stats.min_row_nnz = std::numeric_limits<unsigned>::max();
+	stats.max_row_nnz = 0;
+	stats.n_empty_rows = 0;
+	stats.row_nnz_histogram.clear();
+	stats.bandwidth = 0;
+	stats.sorted_columns = true;
+	double sum_sqr(0.0), sum_distance(0.0);
+	stats.profile = 0.0;
+	for (unsigned i(0); i < n; i++) {
+		const unsigned row_nnz(iA[i + 1] - iA[i]);
+		stats.min_row_nnz = std::min(stats.min_row_nnz, row_nnz);
+		stats.max_row_nnz = std::max(stats.max_row_nnz, row_nnz);
+		sum_sqr += static_cast<double>(row_nnz) * row_nnz;
+		if (row_nnz == 0)
+			stats.n_empty_rows++;
+		unsigned bucket(0);
+		while ((1u << bucket) < row_nnz)
+			bucket++;
+		if (stats.row_nnz_histogram.size() <= bucket)
+			stats.row_nnz_histogram.resize(bucket + 1, 0);
+		stats.row_nnz_histogram[bucket]++;
+
+		unsigned min_col(i);
+		for (unsigned k(iA[i]); k < iA[i + 1]; k++) {
+			const unsigned j(jA[k]);
+			const unsigned dist(j > i ? j - i : i - j);
+			stats.bandwidth = std::max(stats.bandwidth, dist);
+			sum_distance += dist;
+			min_col = std::min(min_col, j);
+			if (k > iA[i] && jA[k - 1] >= j)
+				stats.sorted_columns = false;
+		}
+		stats.profile += i - min_col;
+	}
+	if (n == 0)
+		stats.min_row_nnz = 0;
+	stats.mean_row_nnz = n > 0 ? static_cast<double>(stats.nnz) / n : 0.0;
+	stats.stddev_row_nnz = n > 0 ?
+		sqrt(std::max(sum_sqr / n - stats.mean_row_nnz * stats.mean_row_nnz, 0.0)) : 0.0;
+	stats.mean_distance = stats.nnz > 0 ? sum_distance / stats.nnz : 0.0;
+
+	// symmetry and diagonal dominance
+	stats.structurally_symmetric = true;
+	stats.numerically_symmetric = true;
+	stats.n_missing_diagonal = 0;
+	stats.n_weakly_dominant_rows = 0;
+	stats.n_strictly_dominant_rows = 0;
+	stats.min_dominance_ratio = std::numeric_limits<double>::max();
+	for (unsigned i(0); i < n; i++) {
+		double diag(0.0), off_diag(0.0);
+		bool has_diag(false);
+		for (unsigned k(iA[i]); k < iA[i + 1]; k++) {
+			const unsigned j(jA[k]);
+			if (j == i) {
+				diag += fabs(A[k]);
+				has_diag = true;
+			} else
+				off_diag += fabs(A[k]);
+			if (j > i && stats.structurally_symmetric) {
+				const unsigned k_t(findEntry(j, i, iA, jA, stats.sorted_columns, stats.nnz));
+				if (k_t == stats.nnz)
+					stats.structurally_symmetric = stats.numerically_symmetric = false;
+				else if (A[k_t] != A[k])
+					stats.numerically_symmetric = false;
+			} else if (j < i && stats.structurally_symmetric) {
+				// the entries below the diagonal have to be in the pattern of the upper triangle
+				if (findEntry(j, i, iA, jA, stats.sorted_columns, stats.nnz) == stats.nnz)
+					stats.structurally_symmetric = stats.numerically_symmetric = false;
+			}
+		}
+		if (!has_diag)
+			stats.n_missing_diagonal++;
+		if (diag >= off_diag)
+			stats.n_weakly_dominant_rows++;
+		if (diag > off_diag)
+			stats.n_strictly_dominant_rows++;
+		if (off_diag > 0.0)
+			stats.min_dominance_ratio = std::min(stats.min_dominance_ratio, diag / off_diag);
+	}
+
+	// block structure
+	stats.block_fill.assign(max_block_size, 0.0);
+	stats.block_size = 1;
+	for (unsigned b(1); b <= max_block_size; b++) {
+		if (stats.nnz == 0)
+			break;
+		stats.block_fill[b - 1] = countBlocks(n, iA, jA, b) * b * b / stats.nnz;
+		if (n % b == 0 && stats.block_fill[b - 1] <= block_fill_tol)
+			stats.block_size = b;
+	}
+}
+
+double amuxBCRSDataVolume(CRSMatrixStatistics const& stats, unsigned b)
+{
+	const double n_blocks(stats.block_fill[b - 1] * stats.nnz / (b * b));
+	const double n_block_rows((stats.n_rows + b - 1) / b);
+	return n_blocks * (b * b * sizeof(double) + sizeof(unsigned))
+		+ (n_block_rows + 1.0) * sizeof(unsigned)
+		+ 2.0 * stats.n_rows * sizeof(double);
+}
+
+void writeJSON(std::ostream &os, CRSMatrixStatistics const& stats, std::string const& indent)
+{
+	const std::string in(indent + "\t");
+	os << "{\n";
+	os << in << "\"n_rows\": " << stats.n_rows << ",\n";
+	os << in << "\"nnz\": " << stats.nnz << ",\n";
+	os << in << "\"row_nnz\": {\"min\": " << stats.min_row_nnz << ", \"max\": " << stats.max_row_nnz
+		<< ", \"mean\": " << stats.mean_row_nnz << ", \"stddev\": " << stats.stddev_row_nnz
+		<< ", \"empty_rows\": " << stats.n_empty_rows << ", \"histogram\": [";
+	for (std::size_t k(0); k < stats.row_nnz_histogram.size(); k++) {
+		if (k > 0)
+			os << ", ";
+		os << "{\"max_nnz\": " << (1u << k) << ", \"rows\": " << stats.row_nnz_histogram[k] << "}";
+	}
+	os << "]},\n";
+	os << in << "\"bandwidth\": " << stats.bandwidth << ",\n";
+	os << in << "\"mean_distance_to_diagonal\": " << stats.mean_distance << ",\n";
+	os << in << "\"profile\": " << stats.profile << ",\n";
+	os << in << "\"sorted_columns\": " << (stats.sorted_columns ? "true" : "false") << ",\n";
+	os << in << "\"structurally_symmetric\": " << (stats.structurally_symmetric ? "true" : "false") << ",\n";
+	os << in << "\"numerically_symmetric\": " << (stats.numerically_symmetric ? "true" : "false") << ",\n";
+	os << in << "\"diagonal\": {\"missing\": " << stats.n_missing_diagonal
+		<< ", \"weakly_dominant_rows\": " << stats.n_weakly_dominant_rows
+		<< ", \"strictly_dominant_rows\": " << stats.n_strictly_dominant_rows
+		<< ", \"min_dominance_ratio\": ";
+	if (stats.min_dominance_ratio == std::numeric_limits<double>::max())
+		os << "null";
+	else
+		os << stats.min_dominance_ratio;
+	os << "},\n";
+	os << in << "\"blocks\": {\"detected_block_size\": " << stats.block_size << ", \"fill\": [";
+	for (std::size_t b(0); b < stats.block_fill.size(); b++) {
+		if (b > 0)
+			os << ", ";
+		os << "{\"block_size\": " << b + 1 << ", \"fill\": " << stats.block_fill[b] << "}";
+	}
+	os << "]}\n";
+	os << indent << "}";
+}
+
+} // end namespace MathLib
@@ -0,0 +1,109 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file CRSMatrixStatistics.h
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#ifndef CRSMATRIXSTATISTICS_H_
+#define CRSMATRIXSTATISTICS_H_
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace MathLib {
+
+/**
+ * Structural and numerical properties of a square matrix in compressed row
+ * storage format that determine the performance of the matrix vector
+ * multiplication and the choice of the storage format.
+ */
+struct CRSMatrixStatistics
+{
+	unsigned n_rows;
+	unsigned nnz;
+
+	/** distribution of the number of non-zeros per row */
+	unsigned min_row_nnz;
+	unsigned max_row_nnz;
+	double mean_row_nnz;
+	double stddev_row_nnz;
+	unsigned n_empty_rows;
+	/** row_nnz_histogram[k] is the number of rows with 2^(k-1) < nnz <= 2^k (k = 0: nnz <= 1) */
+	std::vector<unsigned> row_nnz_histogram;
+
+	/** maximal distance |i-j| of a non-zero entry a_ij to the diagonal */
+	unsigned bandwidth;
+	/** mean distance |i-j| of the non-zero entries to the diagonal */
+	double mean_distance;
+	/** profile (envelope) \f$ \sum_i (i - \min \{ j : a_{ij} \neq 0 \}) \f$ of the lower triangle */
+	double profile;
+
+	/** true if the column indices of every row are sorted increasingly */
+	bool sorted_columns;
+	/** true if a_ji is in the pattern for every non-zero a_ij */
+	bool structurally_symmetric;
+	/** true if a_ij == a_ji for all i, j */
+	bool numerically_symmetric;
+
+	/** number of rows without diagonal entry */
+	unsigned n_missing_diagonal;
+	/** number of rows with \f$ |a_{ii}| \ge \sum_{j \neq i} |a_{ij}| \f$ */
+	unsigned n_weakly_dominant_rows;
+	/** number of rows with \f$ |a_{ii}| > \sum_{j \neq i} |a_{ij}| \f$ */
+	unsigned n_strictly_dominant_rows;
+	/** minimum over all rows of \f$ |a_{ii}| / \sum_{j \neq i} |a_{ij}| \f$ */
+	double min_dominance_ratio;
+
+	/**
+	 * block_fill[b-1] for b = 1, ..., max block size: number of entries of
+	 * the aligned b x b blocks containing at least one non-zero divided by
+	 * nnz. A fill of 1 means the pattern consists of dense b x b blocks
+	 * (for instance b degrees of freedom per mesh node).
+	 */
+	std::vector<double> block_fill;
+	/** the largest block size whose fill does not exceed the tolerance */
+	unsigned block_size;
+};
+
+/**
+ * Computes the statistics of the matrix. The cost is O(nnz log(max_row_nnz))
+ * for the symmetry check (binary search if the columns are sorted) plus
+ * O(nnz) per block size.
+ * @param n number of rows (and columns)
+ * @param iA row pointer array
+ * @param jA column index array
+ * @param A entries
+ * @param stats (output) the statistics
+ * @param max_block_size the block sizes 1, ..., max_block_size are checked
+ * @param block_fill_tol a block size b is accepted if its fill is at most block_fill_tol
+ */
+void computeCRSMatrixStatistics(unsigned n, unsigned const*const iA, unsigned const*const jA,
+		double const*const A, CRSMatrixStatistics &stats, unsigned max_block_size = 6,
+		double block_fill_tol = 1.05);
+
+/**
+ * Estimated memory traffic in bytes of one matrix vector multiplication
+ * with blocked compressed row storage (BCRS) of block size b: one column
+ * index per block, the row pointer per block row, the dense blocks and the
+ * vectors x and y.
+ */
+double amuxBCRSDataVolume(CRSMatrixStatistics const& stats, unsigned b);
+
+/**
+ * Writes the statistics as JSON object (without trailing newline).
+ * @param os the output stream
+ * @param stats the statistics
+ * @param indent the indentation of the object, the members are indented by an additional tab
+ */
+void writeJSON(std::ostream &os, CRSMatrixStatistics const& stats, std::string const& indent = "");
+
+} // end namespace MathLib
+
+#endif /* CRSMATRIXSTATISTICS_H_ */
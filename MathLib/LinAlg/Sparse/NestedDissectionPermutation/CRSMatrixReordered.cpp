@@ -14,6 +14,8 @@
 #include "quicksort.h"
 
 #include "LinAlg/Sparse/NestedDissectionPermutation/CRSMatrixReordered.h"
+#include "LinAlg/Sparse/NestedDissectionPermutation/Cluster.h"
+#include "LinAlg/firstTouch.h"
 
 namespace MathLib {
 
@@ -25,9 +27,36 @@ CRSMatrixReordered::CRSMatrixReordered(unsigned n, unsigned *iA, unsigned *jA, d
 	CRSMatrix<double, unsigned> (n, iA, jA, A)
 {}
 
+CRSMatrixReordered::CRSMatrixReordered(SparsityPattern const* pattern, double* A) :
+	CRSMatrix<double, unsigned> (pattern, A)
+{}
+
 CRSMatrixReordered::~CRSMatrixReordered()
 {}
 
+void CRSMatrixReordered::calcNestedDissection(unsigned bmin, unsigned* op_perm, unsigned* po_perm)
+{
+	const unsigned size(getNRows());
+	SparsityPattern const*const pattern(getSparsityPattern());
+	unsigned const* nd_op_perm(NULL);
+	unsigned const* nd_po_perm(NULL);
+	if (!pattern->getNestedDissection(bmin, nd_op_perm, nd_po_perm)) {
+		unsigned* new_op_perm(new unsigned[size]);
+		unsigned* new_po_perm(new unsigned[size]);
+		for (unsigned k(0); k < size; k++)
+			new_op_perm[k] = new_po_perm[k] = k;
+		Cluster cluster_tree(size, _row_ptr, _col_idx);
+		cluster_tree.createClusterTree(new_op_perm, new_po_perm, bmin);
+		pattern->setNestedDissection(bmin, new_op_perm, new_po_perm);
+		nd_op_perm = new_op_perm;
+		nd_po_perm = new_po_perm;
+	}
+	for (unsigned k(0); k < size; k++) {
+		op_perm[k] = nd_op_perm[k];
+		po_perm[k] = nd_po_perm[k];
+	}
+}
+
 void CRSMatrixReordered::reorderMatrix(unsigned const*const op_perm, unsigned const*const po_perm)
 {
 	unsigned i; // row and col idx in permuted matrix
@@ -35,6 +64,31 @@ void CRSMatrixReordered::reorderMatrix(unsigned const*const op_perm, unsigned co
 
 	const unsigned size(getNRows());
 
+	if (_pattern) {
+		// pattern and positions of the entries are computed once per pattern
+		unsigned const* data_perm(NULL);
+		SparsityPattern const*const reordered(_pattern->getReordered(op_perm, po_perm, data_perm));
+		unsigned const*const iAn(reordered->getRowPtrArray());
+		double *An(new double[getNNZ()]);
+		// gather the entries row wise, the thread computing row r of the
+		// matrix vector product touches the entries of row r first
+		const OPENMP_LOOP_TYPE m(size);
+		OPENMP_LOOP_TYPE r;
+		#pragma omp parallel for schedule(static) private(j)
+		for (r = 0; r < m; r++) {
+			for (j = iAn[r]; j < iAn[r + 1]; j++)
+				An[j] = _data[data_perm[j]];
+		}
+		reordered->addReference();
+		_pattern->release();
+		_pattern = reordered;
+		_row_ptr = const_cast<unsigned*>(reordered->getRowPtrArray());
+		_col_idx = const_cast<unsigned*>(reordered->getColIdxArray());
+		BaseLib::swap(An, _data);
+		delete [] An;
+		return;
+	}
+
 	unsigned *pos(new unsigned[size + 1]);
 	for (i = 0; i < size; i++) {
 		const unsigned original_row(op_perm[i]);
@@ -42,7 +96,7 @@ void CRSMatrixReordered::reorderMatrix(unsigned const*const op_perm, unsigned co
 	}
 	pos[size] = 0;
 
-	unsigned *iAn(new unsigned[size + 1]);
+	unsigned *iAn(newFirstTouch<unsigned>(size + 1));
 	iAn[0] = 0;
 	for (i = 0; i < size; i++)
 		iAn[i + 1] = iAn[i] + pos[i];
@@ -51,6 +105,8 @@ void CRSMatrixReordered::reorderMatrix(unsigned const*const op_perm, unsigned co
 
 	unsigned *jAn(new unsigned[iAn[size]]);
 	double *An(new double[iAn[size]]);
+	// place the rows of the reordered matrix on the NUMA nodes of the threads
+	firstTouchCRS(size, iAn, jAn, An);
 	for (i = 0; i < size; i++) {
 		const unsigned original_row(op_perm[i]);
 		idx = _row_ptr[original_row+1];
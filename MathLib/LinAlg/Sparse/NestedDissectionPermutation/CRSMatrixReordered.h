@@ -22,7 +22,33 @@ class CRSMatrixReordered: public MathLib::CRSMatrix<double,unsigned>
 public:
 	CRSMatrixReordered(std::string const &fname);
 	CRSMatrixReordered(unsigned n, unsigned *iA, unsigned *jA, double* A);
+	/**
+	 * Constructs a matrix with a shared sparsity pattern. The nested
+	 * dissection permutation and the pattern of the reordered matrix are
+	 * computed once for the pattern, i.e. for every time step only the
+	 * entries have to be reordered.
+	 */
+	CRSMatrixReordered(SparsityPattern const* pattern, double* A);
 	virtual ~CRSMatrixReordered();
+
+	/**
+	 * Computes the nested dissection permutation of the matrix graph. The
+	 * permutation is stored in the sparsity pattern of the matrix, further
+	 * calls for matrices sharing the pattern only copy it.
+	 * @param bmin threshold value for stopping further refinement
+	 * @param op_perm (output) permutation: original_idx = op_perm[permuted_idx]
+	 * @param po_perm (output) reverse permutation: permuted_idx = po_perm[original_idx]
+	 */
+	void calcNestedDissection(unsigned bmin, unsigned* op_perm, unsigned* po_perm);
+
+	/**
+	 * Reorders the rows and columns of the matrix. If the matrix has a
+	 * shared sparsity pattern, the reordered pattern is taken from (and
+	 * cached in) the pattern and the matrix afterwards shares the reordered
+	 * pattern.
+	 * @param op_perm permutation: original_idx = op_perm[permuted_idx]
+	 * @param po_perm reverse permutation: permuted_idx = po_perm[original_idx]
+	 */
 	void reorderMatrix(unsigned const*const op_perm, unsigned const*const po_perm);
 };
 
@@ -60,6 +60,23 @@ ClusterBase::ClusterBase(ClusterBase *father, unsigned beg, unsigned end,
 {
 }
 
+void ClusterBase::getLeafIntervals(std::vector<unsigned> &leaf_ptr) const
+{
+	leaf_ptr.clear();
+	addLeafBegins(leaf_ptr);
+	leaf_ptr.push_back(_end);
+}
+
+void ClusterBase::addLeafBegins(std::vector<unsigned> &leaf_ptr) const
+{
+	if (_n_sons == 0) {
+		leaf_ptr.push_back(_beg);
+		return;
+	}
+	for (unsigned k(0); k < _n_sons; k++)
+		_sons[k]->addLeafBegins(leaf_ptr);
+}
+
 ClusterBase::~ClusterBase()
 {
 	if (_parent == NULL)
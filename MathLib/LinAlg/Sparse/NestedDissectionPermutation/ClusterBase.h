@@ -13,6 +13,8 @@
 #ifndef CLUSTERBASE_H_
 #define CLUSTERBASE_H_
 
+#include <vector>
+
 namespace MathLib {
 
 class AdjMat;
@@ -51,11 +53,23 @@ public:
 
 	virtual bool isSeparator() const = 0;
 
+	/**
+	 * Collects the index ranges of the leaves of the cluster tree. Since the
+	 * leaves are stored consecutively in the permuted numbering, leaf k
+	 * consists of the permuted indices [leaf_ptr[k], leaf_ptr[k+1]).
+	 * @param leaf_ptr at the end the beginning indices of all leaves in the
+	 * subtree of this cluster followed by the end index of the last leaf
+	 */
+	void getLeafIntervals(std::vector<unsigned> &leaf_ptr) const;
+
 #ifndef NDEBUG
 	AdjMat const* getGlobalAdjMat() const { return _g_adj_mat; }
 #endif
 
 protected:
+	/** appends the beginning indices of the leaves of the subtree */
+	void addLeafBegins(std::vector<unsigned> &leaf_ptr) const;
+
 	/** \brief Method returns the pointer to the parent cluster.
 	 \returns parent cluster */
 	ClusterBase* getParent() const
@@ -0,0 +1,202 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file SparsityPattern.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <algorithm>
+#include <cassert>
+
+// BaseLib
+#include "quicksort.h"
+
+#include "SparsityPattern.h"
+
+namespace MathLib {
+
+SparsityPattern::SparsityPattern(unsigned n, unsigned* row_ptr, unsigned* col_idx) :
+	_n(n), _row_ptr(row_ptr), _col_idx(col_idx), _n_references(1),
+	_diag_pos(NULL), _transposed(NULL), _transposed_data_perm(NULL),
+	_reordered(NULL), _reordered_data_perm(NULL), _reordered_op_perm(NULL),
+	_reordered_po_perm(NULL), _nd_bmin(0), _nd_op_perm(NULL), _nd_po_perm(NULL)
+{}
+
+SparsityPattern::~SparsityPattern()
+{
+	delete [] _row_ptr;
+	delete [] _col_idx;
+	delete [] _diag_pos;
+	if (_transposed)
+		_transposed->release();
+	delete [] _transposed_data_perm;
+	if (_reordered)
+		_reordered->release();
+	delete [] _reordered_data_perm;
+	delete [] _reordered_op_perm;
+	delete [] _reordered_po_perm;
+	delete [] _nd_op_perm;
+	delete [] _nd_po_perm;
+}
+
+void SparsityPattern::release() const
+{
+	assert(_n_references > 0);
+	if (--_n_references == 0)
+		delete this;
+}
+
+bool SparsityPattern::isEqual(unsigned n, unsigned const*const row_ptr,
+		unsigned const*const col_idx) const
+{
+	if (n != _n)
+		return false;
+	if (row_ptr == _row_ptr && col_idx == _col_idx)
+		return true;
+	if (!std::equal(_row_ptr, _row_ptr + _n + 1, row_ptr))
+		return false;
+	return std::equal(_col_idx, _col_idx + getNNZ(), col_idx);
+}
+
+unsigned const* SparsityPattern::getDiagonalPositions() const
+{
+	if (_diag_pos)
+		return _diag_pos;
+
+	_diag_pos = new unsigned[_n];
+	for (unsigned k(0); k < _n; k++) {
+		unsigned const*const beg(_col_idx + _row_ptr[k]);
+		unsigned const*const end(_col_idx + _row_ptr[k + 1]);
+		unsigned const*const it(std::lower_bound(beg, end, k));
+		_diag_pos[k] = (it != end && *it == k) ? static_cast<unsigned>(it - _col_idx) : getNNZ();
+	}
+	return _diag_pos;
+}
+
+unsigned const* SparsityPattern::getWorkload(unsigned n_threads) const
+{
+	assert(n_threads > 0);
+	std::vector<unsigned>& workload(_workload[n_threads]);
+	if (!workload.empty())
+		return &workload[0];
+
+	// equal number of non-zero entries per thread
+	const unsigned nnz(getNNZ());
+	workload.resize(n_threads + 1);
+	workload[0] = 0;
+	for (unsigned k(1); k < n_threads; k++) {
+		const unsigned bound(static_cast<unsigned>((static_cast<double>(nnz) * k) / n_threads));
+		workload[k] = std::lower_bound(_row_ptr + workload[k - 1], _row_ptr + _n, bound) - _row_ptr;
+	}
+	workload[n_threads] = _n;
+	return &workload[0];
+}
+
+SparsityPattern const* SparsityPattern::getTranspose(unsigned const*& data_perm) const
+{
+	if (!_transposed) {
+		const unsigned nnz(getNNZ());
+		// count entries per row in the transposed matrix
+		unsigned* row_ptr(new unsigned[_n + 1]);
+		std::fill(row_ptr, row_ptr + _n + 1, 0u);
+		for (unsigned k(0); k < nnz; k++)
+			row_ptr[_col_idx[k] + 1]++;
+		for (unsigned k(0); k < _n; k++)
+			row_ptr[k + 1] += row_ptr[k];
+
+		// the rows of the original matrix are traversed in ascending order,
+		// so the columns of the transposed matrix are sorted
+		unsigned* pos(new unsigned[_n]);
+		std::copy(row_ptr, row_ptr + _n, pos);
+		unsigned* col_idx(new unsigned[nnz]);
+		_transposed_data_perm = new unsigned[nnz];
+		for (unsigned i(0); i < _n; i++) {
+			const unsigned row_end(_row_ptr[i + 1]);
+			for (unsigned j(_row_ptr[i]); j < row_end; j++) {
+				const unsigned p(pos[_col_idx[j]]++);
+				col_idx[p] = i;
+				_transposed_data_perm[p] = j;
+			}
+		}
+		delete [] pos;
+		_transposed = new SparsityPattern(_n, row_ptr, col_idx);
+	}
+	data_perm = _transposed_data_perm;
+	return _transposed;
+}
+
+SparsityPattern const* SparsityPattern::getReordered(unsigned const*const op_perm,
+		unsigned const*const po_perm, unsigned const*& data_perm) const
+{
+	if (_reordered == NULL
+		|| !std::equal(op_perm, op_perm + _n, _reordered_op_perm)
+		|| !std::equal(po_perm, po_perm + _n, _reordered_po_perm)) {
+		if (_reordered)
+			_reordered->release();
+		delete [] _reordered_data_perm;
+		if (_reordered_op_perm == NULL) {
+			_reordered_op_perm = new unsigned[_n];
+			_reordered_po_perm = new unsigned[_n];
+		}
+		std::copy(op_perm, op_perm + _n, _reordered_op_perm);
+		std::copy(po_perm, po_perm + _n, _reordered_po_perm);
+		_reordered_data_perm = new unsigned[getNNZ()];
+		_reordered = createPermuted(op_perm, po_perm, _reordered_data_perm);
+	}
+	data_perm = _reordered_data_perm;
+	return _reordered;
+}
+
+SparsityPattern* SparsityPattern::createPermuted(unsigned const*const op_perm,
+		unsigned const*const po_perm, unsigned* data_perm) const
+{
+	unsigned* row_ptr(new unsigned[_n + 1]);
+	row_ptr[0] = 0;
+	for (unsigned i(0); i < _n; i++) {
+		const unsigned original_row(op_perm[i]);
+		row_ptr[i + 1] = row_ptr[i] + _row_ptr[original_row + 1] - _row_ptr[original_row];
+	}
+
+	unsigned* col_idx(new unsigned[getNNZ()]);
+	for (unsigned i(0); i < _n; i++) {
+		const unsigned original_row(op_perm[i]);
+		unsigned pos(row_ptr[i]);
+		const unsigned end(_row_ptr[original_row + 1]);
+		for (unsigned j(_row_ptr[original_row]); j < end; j++, pos++) {
+			col_idx[pos] = po_perm[_col_idx[j]];
+			data_perm[pos] = j;
+		}
+		BaseLib::quicksort(col_idx, static_cast<size_t>(row_ptr[i]),
+				static_cast<size_t>(row_ptr[i + 1]), data_perm);
+	}
+	return new SparsityPattern(_n, row_ptr, col_idx);
+}
+
+void SparsityPattern::setNestedDissection(unsigned bmin, unsigned* op_perm, unsigned* po_perm) const
+{
+	delete [] _nd_op_perm;
+	delete [] _nd_po_perm;
+	_nd_bmin = bmin;
+	_nd_op_perm = op_perm;
+	_nd_po_perm = po_perm;
+}
+
+bool SparsityPattern::getNestedDissection(unsigned bmin, unsigned const*& op_perm,
+		unsigned const*& po_perm) const
+{
+	if (_nd_op_perm == NULL || _nd_bmin != bmin) {
+		op_perm = NULL;
+		po_perm = NULL;
+		return false;
+	}
+	op_perm = _nd_op_perm;
+	po_perm = _nd_po_perm;
+	return true;
+}
+
+} // end namespace MathLib
@@ -0,0 +1,170 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file SparsityPattern.h
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#ifndef SPARSITYPATTERN_H_
+#define SPARSITYPATTERN_H_
+
+#include <map>
+#include <vector>
+
+namespace MathLib {
+
+/**
+ * Class SparsityPattern stores the structure (row pointer and column index
+ * arrays) of a matrix in compressed row storage format. In transient
+ * simulations the pattern of the system matrix does not change, only the
+ * entries do. An object of this class is shared between successive
+ * CRSMatrix objects and caches all data that depends only on the pattern:
+ * - the positions of the diagonal entries (diagonal preconditioner)
+ * - the workload intervals for a given number of threads
+ * - the pattern of the transposed matrix and the positions of the entries
+ * - the pattern of a reordered matrix and the positions of the entries
+ * - the nested dissection permutation
+ * Each of these is computed on first request, afterwards only the entries
+ * have to be gathered (an O(nnz) copy) instead of sorting or partitioning.
+ *
+ * The object is reference counted: the creator holds the first reference,
+ * every CRSMatrix constructed from the pattern adds a reference. release()
+ * drops a reference and destroys the object when the last one is gone.
+ * The lazily computed data is not protected against concurrent requests,
+ * i.e. the getter methods should not be called in parallel regions.
+ */
+class SparsityPattern
+{
+public:
+	/**
+	 * Constructs the pattern; the object takes the ownership of the arrays.
+	 * @param n number of rows / columns
+	 * @param row_ptr row pointer array (n+1 entries)
+	 * @param col_idx column index array (sorted within each row)
+	 */
+	SparsityPattern(unsigned n, unsigned* row_ptr, unsigned* col_idx);
+
+	/** adds a reference to the pattern */
+	void addReference() const { _n_references++; }
+
+	/**
+	 * removes a reference, the last reference destroys the pattern
+	 */
+	void release() const;
+
+	/** @return the current number of references */
+	unsigned getNReferences() const { return _n_references; }
+
+	unsigned getNRows() const { return _n; }
+	unsigned getNNZ() const { return _row_ptr[_n]; }
+	unsigned const* getRowPtrArray() const { return _row_ptr; }
+	unsigned const* getColIdxArray() const { return _col_idx; }
+
+	/**
+	 * Checks whether the pattern equals the given one.
+	 * @return true if the arrays coincide
+	 */
+	bool isEqual(unsigned n, unsigned const*const row_ptr, unsigned const*const col_idx) const;
+
+	/**
+	 * @return array of n positions: the diagonal entry of row k is stored at
+	 * position getDiagonalPositions()[k] of the entry array, getNNZ() if the
+	 * diagonal entry is not in the pattern
+	 */
+	unsigned const* getDiagonalPositions() const;
+
+	/**
+	 * Splits the rows into n_threads intervals with (nearly) the same
+	 * number of non-zero entries. The intervals are computed once for every
+	 * number of threads.
+	 * @param n_threads number of threads
+	 * @return the interval boundaries (n_threads+1 entries)
+	 */
+	unsigned const* getWorkload(unsigned n_threads) const;
+
+	/**
+	 * Returns the pattern of the transposed matrix. The entries of the
+	 * transposed matrix are trans_data[k] = data[data_perm[k]].
+	 * @param data_perm (output) the positions of the entries
+	 * @return the transposed pattern, owned by this object (use
+	 * addReference() to keep it longer than this object)
+	 */
+	SparsityPattern const* getTranspose(unsigned const*& data_perm) const;
+
+	/**
+	 * Returns the pattern of the matrix \f$P A Q\f$, where row i of the
+	 * reordered matrix is row op_perm[i] of the original matrix and column j
+	 * of the original matrix becomes column po_perm[j]. The entries of the
+	 * reordered matrix are reordered_data[k] = data[data_perm[k]]. The last
+	 * reordering is cached, other permutations replace it.
+	 * @param op_perm permutation: original_idx = op_perm[permuted_idx]
+	 * @param po_perm reverse permutation: permuted_idx = po_perm[original_idx]
+	 * @param data_perm (output) the positions of the entries
+	 * @return the reordered pattern, owned by this object (use
+	 * addReference() to keep it longer than this object)
+	 */
+	SparsityPattern const* getReordered(unsigned const*const op_perm,
+			unsigned const*const po_perm, unsigned const*& data_perm) const;
+
+	/**
+	 * Stores the nested dissection permutation computed for this pattern,
+	 * the object takes the ownership of the arrays.
+	 * @param bmin the threshold the cluster tree was computed with
+	 * @param op_perm permutation: original_idx = op_perm[permuted_idx]
+	 * @param po_perm reverse permutation: permuted_idx = po_perm[original_idx]
+	 */
+	void setNestedDissection(unsigned bmin, unsigned* op_perm, unsigned* po_perm) const;
+
+	/**
+	 * Looks up the stored nested dissection permutation.
+	 * @param bmin the threshold of the cluster tree
+	 * @param op_perm (output) permutation, NULL if not available
+	 * @param po_perm (output) reverse permutation, NULL if not available
+	 * @return true if a permutation for bmin is stored
+	 */
+	bool getNestedDissection(unsigned bmin, unsigned const*& op_perm,
+			unsigned const*& po_perm) const;
+
+private:
+	/** the object is destroyed by release() only */
+	~SparsityPattern();
+	/** the pattern is not copyable */
+	SparsityPattern(SparsityPattern const&);
+	SparsityPattern& operator=(SparsityPattern const&);
+
+	/**
+	 * creates the pattern of the permuted matrix, columns within the rows
+	 * are sorted
+	 */
+	SparsityPattern* createPermuted(unsigned const*const op_perm,
+			unsigned const*const po_perm, unsigned* data_perm) const;
+
+	const unsigned _n;
+	unsigned* const _row_ptr;
+	unsigned* const _col_idx;
+	mutable unsigned _n_references;
+
+	mutable unsigned* _diag_pos;
+	mutable std::map<unsigned, std::vector<unsigned> > _workload;
+
+	mutable SparsityPattern* _transposed;
+	mutable unsigned* _transposed_data_perm;
+
+	mutable SparsityPattern* _reordered;
+	mutable unsigned* _reordered_data_perm;
+	mutable unsigned* _reordered_op_perm;
+	mutable unsigned* _reordered_po_perm;
+
+	mutable unsigned _nd_bmin;
+	mutable unsigned* _nd_op_perm;
+	mutable unsigned* _nd_po_perm;
+};
+
+} // end namespace MathLib
+
+#endif /* SPARSITYPATTERN_H_ */
@@ -13,6 +13,10 @@
 #ifndef AMUXCRS_H
 #define AMUXCRS_H
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace MathLib {
 
 template<typename FP_TYPE, typename IDX_TYPE>
@@ -29,6 +33,22 @@ void amuxCRS(FP_TYPE a, IDX_TYPE n, IDX_TYPE const * const iA, IDX_TYPE const *
 	}
 }
 
+/**
+ * Lower bound for the memory traffic of one matrix vector multiplication in
+ * bytes: the matrix arrays and the vectors x and y are transferred exactly
+ * once (perfect reuse of x in the cache). Dividing by the measured time gives
+ * the achieved memory bandwidth.
+ * @param n number of rows (and columns) of the matrix
+ * @param nnz number of non-zero entries of the matrix
+ */
+template<typename FP_TYPE, typename IDX_TYPE>
+double amuxCRSDataVolume(IDX_TYPE n, IDX_TYPE nnz)
+{
+	return static_cast<double>(nnz) * (sizeof(FP_TYPE) + sizeof(IDX_TYPE))
+		+ (static_cast<double>(n) + 1.0) * sizeof(IDX_TYPE)
+		+ 2.0 * static_cast<double>(n) * sizeof(FP_TYPE);
+}
+
 void amuxCRSParallelPThreads (double a,
 	unsigned n, unsigned const * const iA, unsigned const * const jA,
 	double const * const A, double const * const x, double* y,
@@ -40,17 +60,22 @@ void amuxCRSParallelPThreads (double a,
 	unsigned num_of_pthreads, unsigned const*const workload_intervals);
 
 #ifdef _OPENMP
+/**
+ * OpenMP parallel matrix vector multiplication with a team of num_threads
+ * threads. The number of threads is given to the parallel region only, the
+ * OpenMP settings of the process are not changed.
+ */
 template<typename FP_TYPE, typename IDX_TYPE>
 void amuxCRSParallelOpenMP (FP_TYPE a, unsigned n,
     IDX_TYPE const * const __restrict__ iA,
     IDX_TYPE const * const __restrict__ jA, FP_TYPE const * const A,
-    FP_TYPE const * const __restrict__ x, FP_TYPE* __restrict__ y)
+    FP_TYPE const * const __restrict__ x, FP_TYPE* __restrict__ y, int num_threads)
 {
 	OPENMP_LOOP_TYPE i;
     IDX_TYPE j;
     FP_TYPE t;
 	{
-#pragma omp parallel for private(i, j, t)
+#pragma omp parallel for private(i, j, t) schedule(static) num_threads(num_threads)
 		for (i = 0; i < n; i++) {
 			const IDX_TYPE end(iA[i + 1]);
 			t = A[iA[i]] * x[jA[iA[i]]];
@@ -61,6 +86,15 @@ void amuxCRSParallelOpenMP (FP_TYPE a, unsigned n,
 		}
 	}
 }
+
+template<typename FP_TYPE, typename IDX_TYPE>
+void amuxCRSParallelOpenMP (FP_TYPE a, unsigned n,
+    IDX_TYPE const * const __restrict__ iA,
+    IDX_TYPE const * const __restrict__ jA, FP_TYPE const * const A,
+    FP_TYPE const * const __restrict__ x, FP_TYPE* __restrict__ y)
+{
+	amuxCRSParallelOpenMP(a, n, iA, jA, A, x, y, omp_get_max_threads());
+}
 #endif
 
 void amuxCRSSym (double a,
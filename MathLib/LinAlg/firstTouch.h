@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file firstTouch.h
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#ifndef FIRSTTOUCH_H_
+#define FIRSTTOUCH_H_
+
+#include <cstddef>
+
+namespace MathLib {
+
+/**
+ * On NUMA systems a memory page is placed on the memory node of the thread
+ * that writes it first ("first touch" policy of Linux). The functions in this
+ * file initialize arrays within an OpenMP loop with schedule(static) over the
+ * rows, i.e. with the same distribution of the rows to the threads as
+ * amuxCRSParallelOpenMP() and the vector loops of the parallel solvers. Hence
+ * every thread finds the data it works on in its local memory.
+ *
+ * The number of threads has to be set (omp_set_num_threads()) before the
+ * arrays are initialized. Without OpenMP the functions are plain sequential
+ * initializations.
+ */
+
+/**
+ * Allocates an array of length n and sets all entries to val in parallel.
+ * The array has to be released with delete [].
+ */
+template <typename T>
+T* newFirstTouch(std::size_t n, T val = T(0))
+{
+	T* v(new T[n]);
+	const OPENMP_LOOP_TYPE m(n);
+	OPENMP_LOOP_TYPE k;
+	#pragma omp parallel for schedule(static)
+	for (k = 0; k < m; k++)
+		v[k] = val;
+	return v;
+}
+
+/**
+ * Touches the column index and the entry array of a matrix in compressed row
+ * storage format: the entries of row i are written by the thread that
+ * computes row i of the matrix vector product.
+ * @param n number of rows
+ * @param iA row pointer (already initialized)
+ * @param jA column index array of length iA[n], entries are set to zero
+ * @param A entry array of length iA[n], entries are set to zero
+ */
+template <typename FP_TYPE, typename IDX_TYPE>
+void firstTouchCRS(IDX_TYPE n, IDX_TYPE const*const iA, IDX_TYPE* jA, FP_TYPE* A)
+{
+	const OPENMP_LOOP_TYPE m(n);
+	OPENMP_LOOP_TYPE i;
+	#pragma omp parallel for schedule(static)
+	for (i = 0; i < m; i++) {
+		for (IDX_TYPE j(iA[i]); j < iA[i + 1]; j++) {
+			jA[j] = 0;
+			A[j] = 0;
+		}
+	}
+}
+
+} // end namespace MathLib
+
+#endif /* FIRSTTOUCH_H_ */
@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file reproducibleReduction.h
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#ifndef REPRODUCIBLEREDUCTION_H_
+#define REPRODUCIBLEREDUCTION_H_
+
+#include <algorithm>
+
+namespace MathLib {
+
+/**
+ * Parallel reductions (scalar products, norms) are computed in blocks of
+ * REDUCTION_BLOCK_SIZE consecutive entries. The partition into blocks depends
+ * only on the length of the vectors. Every block sum is computed by one
+ * thread in a fixed order and the block sums are added by pairwiseSum().
+ * Hence the result is bitwise identical for every number of threads and
+ * every scheduling, in contrast to reduction(+:...) clauses of OpenMP.
+ */
+const unsigned REDUCTION_BLOCK_SIZE(2048);
+
+/**
+ * Sums the entries of v by recursive pairwise summation. The order of the
+ * additions is determined by n only. The rounding error grows with
+ * \f$\log_2 n\f$ instead of n as for the sequential summation.
+ */
+template <typename T>
+T pairwiseSum(unsigned n, T const*const v)
+{
+	if (n <= 8) {
+		T res(0);
+		for (unsigned k(0); k < n; k++)
+			res += v[k];
+		return res;
+	}
+	const unsigned h(n / 2);
+	return pairwiseSum(h, v) + pairwiseSum(n - h, v + h);
+}
+
+/**
+ * Scalar product of the entries [beg, end) of x and y, four partial sums are
+ * accumulated to allow the compiler to vectorize the loop.
+ */
+template <typename T>
+inline T blockDot(unsigned beg, unsigned end, T const*const x, T const*const y)
+{
+	T s0(0), s1(0), s2(0), s3(0);
+	unsigned i(beg);
+	for (; i + 4 <= end; i += 4) {
+		s0 += x[i] * y[i];
+		s1 += x[i + 1] * y[i + 1];
+		s2 += x[i + 2] * y[i + 2];
+		s3 += x[i + 3] * y[i + 3];
+	}
+	for (; i < end; i++)
+		s0 += x[i] * y[i];
+	return (s0 + s1) + (s2 + s3);
+}
+
+/**
+ * Scalar product of the vectors x and y of length n computed block wise (see
+ * blockDot()), the block sums are added by pairwiseSum(). The result does not
+ * depend on the number of threads.
+ */
+template <typename T>
+T reproducibleDot(unsigned n, T const*const x, T const*const y)
+{
+	const unsigned n_blocks((n + REDUCTION_BLOCK_SIZE - 1) / REDUCTION_BLOCK_SIZE);
+	if (n_blocks <= 1)
+		return blockDot(0, n, x, y);
+
+	T* const block_sums(new T[n_blocks]);
+	const OPENMP_LOOP_TYPE nb(n_blocks);
+	OPENMP_LOOP_TYPE b;
+	#pragma omp parallel for schedule(static)
+	for (b = 0; b < nb; b++) {
+		const unsigned beg(b * REDUCTION_BLOCK_SIZE);
+		block_sums[b] = blockDot(beg, std::min(n, beg + REDUCTION_BLOCK_SIZE), x, y);
+	}
+
+	const T res(pairwiseSum(n_blocks, block_sums));
+	delete [] block_sums;
+	return res;
+}
+
+} // end namespace MathLib
+
+#endif /* REPRODUCIBLEREDUCTION_H_ */
@@ -22,6 +22,7 @@
 #endif
 
 #include "Point.h"
+#include "LinAlg/reproducibleReduction.h"
 
 namespace MathLib {
 
@@ -33,19 +34,7 @@ namespace MathLib {
 template<typename T, int N> inline
 T scpr(T const * const v0, T const * const v1)
 {
-	T res (v0[0]*v1[0]);
-#ifdef _OPENMP
-	OPENMP_LOOP_TYPE k;
-
-	#pragma omp parallel for reduction (+:res)
-	for (k = 1; k<N; k++) {
-		res += v0[k] * v1[k];
-	}
-#else
-	for (size_t k(1); k < N; k++)
-		res += v0[k] * v1[k];
-#endif
-	return res;
+	return reproducibleDot(N, v0, v1);
 }
 
 template <> inline
@@ -57,22 +46,14 @@ double scpr<double,3>(double const * const v0, double const * const v1)
 	return res;
 }
 
+/**
+ * standard inner product in R^n, the result does not depend on the number of
+ * OpenMP threads (see reproducibleDot())
+ */
 template<typename T> inline
 T scpr(T const * const v0, T const * const v1, unsigned n)
 {
-	T res (v0[0]*v1[0]);
-#ifdef _OPENMP
-	OPENMP_LOOP_TYPE k;
-
-	#pragma omp parallel for reduction (+:res)
-	for (k = 1; k<n; k++) {
-		res += v0[k] * v1[k];
-	}
-#else
-	for (size_t k(1); k < n; k++)
-		res += v0[k] * v1[k];
-#endif
-	return res;
+	return reproducibleDot(n, v0, v1);
 }
 
 
@@ -16,6 +16,8 @@
 #include <iostream>
 #include <cassert>
 
+#include "LinAlg/firstTouch.h"
+
 //extern void CS_write(char*, unsigned, unsigned const*, unsigned const*, double const*);
 //extern void CS_read(char*, unsigned&, unsigned*&, unsigned*&, double*&);
 
@@ -35,16 +37,19 @@ template<class T> void CS_read(std::istream &is, unsigned &n, unsigned* &iA, uns
 		delete[] jA;
 		delete[] A;
 	}
-	iA = new unsigned[n + 1];
+	// the arrays are touched in parallel before reading such that the pages
+	// are placed on the NUMA nodes of the threads computing the rows
+	iA = MathLib::newFirstTouch<unsigned>(n + 1);
 	assert(iA != NULL);
 	is.read((char*) iA, (n + 1) * sizeof(unsigned));
 
 	jA = new unsigned[iA[n]];
 	assert(jA != NULL);
-	is.read((char*) jA, iA[n] * sizeof(unsigned));
-
 	A = new T[iA[n]];
 	assert(A != NULL);
+	MathLib::firstTouchCRS(n, iA, jA, A);
+
+	is.read((char*) jA, iA[n] * sizeof(unsigned));
 	is.read((char*) A, iA[n] * sizeof(T));
 
 #ifndef NDEBUG
@@ -0,0 +1,104 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file EdgeView.h
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#ifndef EDGEVIEW_H_
+#define EDGEVIEW_H_
+
+#include "MeshTopology.h"
+
+namespace MeshLib {
+
+/**
+ * Class EdgeView is a lightweight reference to edge i of an element of a
+ * MeshTopology. The node indices of the edge are looked up in the static
+ * edge tables of the element types, i.e., in contrast to Element::getEdge()
+ * no Node array and no Edge object is created.
+ */
+class EdgeView
+{
+public:
+	EdgeView(MeshTopology const& topology, std::size_t elem_idx, unsigned edge_idx) :
+		_topology(&topology), _elem_idx(elem_idx), _edge_idx(edge_idx)
+	{}
+
+	/** @return the index of the element the edge belongs to */
+	std::size_t getElementIndex() const { return _elem_idx; }
+
+	/** @return the local index of the edge within the element */
+	unsigned getLocalIndex() const { return _edge_idx; }
+
+	/** @return the mesh index of node j (0 or 1) of the edge */
+	unsigned getNodeIndex(unsigned j) const
+	{
+		return _topology->getNodeIndices(_elem_idx)[MeshTopology::getEdgeNode(_topology->getType(_elem_idx), _edge_idx, j)];
+	}
+
+	/** @return true if the edge connects the nodes with the mesh indices a and b */
+	bool connects(unsigned a, unsigned b) const
+	{
+		const unsigned n0(getNodeIndex(0)), n1(getNodeIndex(1));
+		return (n0 == a && n1 == b) || (n0 == b && n1 == a);
+	}
+
+private:
+	MeshTopology const* _topology;
+	std::size_t _elem_idx;
+	unsigned _edge_idx;
+};
+
+/**
+ * Calls edge_functor(EdgeView const&) once for every edge of the mesh. An edge
+ * is visited from the element with the smallest index it is an edge of. The
+ * elements sharing the edge are found by intersecting the (ascending) element
+ * lists of its two nodes, no memory is allocated.
+ * @param topology a topology with node-element information (MeshTopology::computeNodeElements())
+ * @param edge_functor the functor, it is passed by reference in order to collect results
+ */
+template <typename EdgeFunctor>
+void forEachUniqueEdge(MeshTopology const& topology, EdgeFunctor &edge_functor)
+{
+	const std::size_t n_elements(topology.getNElements());
+	for (std::size_t k(0); k < n_elements; k++) {
+		const MshElemType::type type(topology.getType(k));
+		const unsigned n_edges(MeshTopology::getNEdges(type));
+		for (unsigned i(0); i < n_edges; i++) {
+			const EdgeView edge(topology, k, i);
+			const unsigned a(edge.getNodeIndex(0)), b(edge.getNodeIndex(1));
+			unsigned const* elems_a(topology.getNodeElementIndices(a));
+			unsigned const*const end_a(elems_a + topology.getNNodeElements(a));
+			unsigned const* elems_b(topology.getNodeElementIndices(b));
+			unsigned const*const end_b(elems_b + topology.getNNodeElements(b));
+			// walk through the common elements with an index smaller than k
+			bool is_first(true);
+			while (is_first && elems_a != end_a && elems_b != end_b && *elems_a < k) {
+				if (*elems_a < *elems_b) {
+					++elems_a;
+				} else if (*elems_b < *elems_a) {
+					++elems_b;
+				} else {
+					const std::size_t m(*elems_a);
+					const unsigned n_m_edges(MeshTopology::getNEdges(topology.getType(m)));
+					for (unsigned j(0); j < n_m_edges && is_first; j++)
+						is_first = !EdgeView(topology, m, j).connects(a, b);
+					++elems_a;
+					++elems_b;
+				}
+			}
+			if (is_first)
+				edge_functor(edge);
+		}
+	}
+}
+
+} // end namespace MeshLib
+
+#endif /* EDGEVIEW_H_ */
@@ -0,0 +1,449 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file ElementByElementLaplacian.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <cmath>
+#include <limits>
+
+// BaseLib/logog
+#include "logog.hpp"
+
+// MathLib
+#include "LinAlg/Dense/FixedMatrix.h"
+
+#include "ElementByElementLaplacian.h"
+#include "Mesh.h"
+#include "Node.h"
+#include "MshEnums.h"
+#include "Elements/Element.h"
+
+namespace MeshLib {
+
+namespace {
+
+/** the element matrices the operator can compute */
+enum ElementKind {
+	LINE2,
+	TRI3,
+	TET4,
+	TET10,
+	UNSUPPORTED
+};
+
+ElementKind getElementKind(Element const& elem)
+{
+	const unsigned n_nodes(elem.getNNodes());
+	switch (elem.getType()) {
+	case MshElemType::EDGE:
+		return n_nodes == 2 ? LINE2 : UNSUPPORTED;
+	case MshElemType::TRIANGLE:
+		return n_nodes == 3 ? TRI3 : UNSUPPORTED;
+	case MshElemType::TETRAHEDRON:
+		if (n_nodes == 4)
+			return TET4;
+		return n_nodes == 10 ? TET10 : UNSUPPORTED;
+	default:
+		return UNSUPPORTED;
+	}
+}
+
+/**
+ * Stiffness matrix of a line element, the gradients of the shape functions
+ * are \f$ \pm t / L^2 \f$ with the edge vector t and the length L.
+ */
+void line2Stiffness(double const*const*const p, MathLib::FixedMatrix<double, 2, 2> &K)
+{
+	MathLib::FixedMatrix<double, 3, 2> B;
+	double l2(0.0);
+	for (unsigned d(0); d < 3; d++)
+		l2 += (p[1][d] - p[0][d]) * (p[1][d] - p[0][d]);
+	for (unsigned d(0); d < 3; d++) {
+		B(d, 1) = (p[1][d] - p[0][d]) / l2;
+		B(d, 0) = -B(d, 1);
+	}
+	K.setZero();
+	B.addTransposedProduct(sqrt(l2), B, K);
+}
+
+/**
+ * Stiffness matrix of a (planar) triangle in three dimensional space. With
+ * the normal \f$ n = (p_1 - p_0) \times (p_2 - p_0) \f$ and the edge
+ * \f$ e_i \f$ opposite to vertex i the gradient of the shape function of
+ * vertex i is \f$ n \times e_i / |n|^2 \f$.
+ */
+void tri3Stiffness(double const*const*const p, MathLib::FixedMatrix<double, 3, 3> &K)
+{
+	double e[3][3];
+	for (unsigned i(0); i < 3; i++)
+		for (unsigned d(0); d < 3; d++)
+			e[i][d] = p[(i + 2) % 3][d] - p[(i + 1) % 3][d];
+	const double n[3] = {
+		e[1][1] * e[2][2] - e[1][2] * e[2][1],
+		e[1][2] * e[2][0] - e[1][0] * e[2][2],
+		e[1][0] * e[2][1] - e[1][1] * e[2][0]
+	};
+	const double nn(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+
+	MathLib::FixedMatrix<double, 3, 3> B;
+	for (unsigned i(0); i < 3; i++) {
+		B(0, i) = (n[1] * e[i][2] - n[2] * e[i][1]) / nn;
+		B(1, i) = (n[2] * e[i][0] - n[0] * e[i][2]) / nn;
+		B(2, i) = (n[0] * e[i][1] - n[1] * e[i][0]) / nn;
+	}
+	K.setZero();
+	B.addTransposedProduct(0.5 * sqrt(nn), B, K);
+}
+
+/**
+ * Computes the (constant) gradients of the barycentric coordinates of a
+ * tetrahedron. The rows of the Jacobian J are the edges \f$ p_k - p_0 \f$,
+ * the gradients of the barycentric coordinates 1, 2, 3 are the columns of
+ * \f$ J^{-1} \f$.
+ * @param p the coordinates of the vertices
+ * @param G column i is the gradient of barycentric coordinate i
+ * @return the volume of the tetrahedron (0 for degenerated tetrahedra)
+ */
+double tetGradients(double const*const*const p, MathLib::FixedMatrix<double, 3, 4> &G)
+{
+	MathLib::FixedMatrix<double, 3, 3> J, J_inv;
+	for (unsigned k(0); k < 3; k++)
+		for (unsigned d(0); d < 3; d++)
+			J(k, d) = p[k + 1][d] - p[0][d];
+	if (!MathLib::invert(J, J_inv)) {
+		G.setZero();
+		return 0.0;
+	}
+	for (unsigned d(0); d < 3; d++) {
+		G(d, 0) = -(J_inv(d, 0) + J_inv(d, 1) + J_inv(d, 2));
+		for (unsigned k(0); k < 3; k++)
+			G(d, k + 1) = J_inv(d, k);
+	}
+	return fabs(MathLib::determinant(J)) / 6.0;
+}
+
+void tet4Stiffness(double const*const*const p, MathLib::FixedMatrix<double, 4, 4> &K)
+{
+	MathLib::FixedMatrix<double, 3, 4> G;
+	const double volume(tetGradients(p, G));
+	K.setZero();
+	G.addTransposedProduct(volume, G, K);
+}
+
+/**
+ * Stiffness matrix of the quadratic tetrahedron (straight sided). The node
+ * 4 + k lies on edge k, the edges are numbered as in class Tet. The product
+ * of the gradients of the shape functions is quadratic, hence the four point
+ * Gauss rule is exact.
+ */
+void tet10Stiffness(double const*const*const p, MathLib::FixedMatrix<double, 10, 10> &K)
+{
+	static const unsigned edge_nodes[6][2] = {{0, 1}, {1, 2}, {0, 2}, {0, 3}, {1, 3}, {2, 3}};
+	static const double a(0.5854101966249685), b(0.1381966011250105);
+
+	MathLib::FixedMatrix<double, 3, 4> G;
+	const double volume(tetGradients(p, G));
+
+	K.setZero();
+	MathLib::FixedMatrix<double, 3, 10> B;
+	for (unsigned q(0); q < 4; q++) {
+		double lambda[4];
+		for (unsigned i(0); i < 4; i++)
+			lambda[i] = (i == q) ? a : b;
+		for (unsigned d(0); d < 3; d++) {
+			for (unsigned i(0); i < 4; i++)
+				B(d, i) = (4.0 * lambda[i] - 1.0) * G(d, i);
+			for (unsigned k(0); k < 6; k++) {
+				const unsigned i(edge_nodes[k][0]), j(edge_nodes[k][1]);
+				B(d, 4 + k) = 4.0 * (lambda[i] * G(d, j) + lambda[j] * G(d, i));
+			}
+		}
+		B.addTransposedProduct(0.25 * volume, B, K);
+	}
+}
+
+/**
+ * Adds the contribution of an element matrix to y = d K x. Dirichlet nodes
+ * are excluded.
+ */
+struct ApplyElementMatrix {
+	ApplyElementMatrix(unsigned const*const nodes, unsigned char const*const dirichlet,
+			double d, double const*const x, double* y) :
+		_nodes(nodes), _dirichlet(dirichlet), _d(d), _x(x), _y(y)
+	{}
+
+	template <std::size_t N>
+	void operator()(MathLib::FixedMatrix<double, N, N> const& K) const
+	{
+		double x_loc[N], y_loc[N];
+		for (std::size_t i(0); i < N; i++)
+			x_loc[i] = _dirichlet[_nodes[i]] ? 0.0 : _x[_nodes[i]];
+		K.amux(_d, x_loc, y_loc);
+		for (std::size_t i(0); i < N; i++)
+			if (!_dirichlet[_nodes[i]])
+				_y[_nodes[i]] += y_loc[i];
+	}
+
+	unsigned const*const _nodes;
+	unsigned char const*const _dirichlet;
+	const double _d;
+	double const*const _x;
+	double* const _y;
+};
+
+/** Adds the diagonal of an element matrix to the global diagonal. */
+struct AddElementDiagonal {
+	AddElementDiagonal(unsigned const*const nodes, double* diag) :
+		_nodes(nodes), _diag(diag)
+	{}
+
+	template <std::size_t N>
+	void operator()(MathLib::FixedMatrix<double, N, N> const& K) const
+	{
+		for (std::size_t i(0); i < N; i++)
+			_diag[_nodes[i]] += K(i, i);
+	}
+
+	unsigned const*const _nodes;
+	double* const _diag;
+};
+
+/**
+ * Computes the element matrix of the given kind and passes it to op.
+ * @param kind the kind of the element
+ * @param p the coordinates of the element nodes
+ * @param op the operation applied to the element matrix
+ */
+template <class Op>
+void processElementMatrix(unsigned char kind, double const*const*const p, Op const& op)
+{
+	switch (kind) {
+	case LINE2: {
+		MathLib::FixedMatrix<double, 2, 2> K;
+		line2Stiffness(p, K);
+		op(K);
+		break;
+	}
+	case TRI3: {
+		MathLib::FixedMatrix<double, 3, 3> K;
+		tri3Stiffness(p, K);
+		op(K);
+		break;
+	}
+	case TET4: {
+		MathLib::FixedMatrix<double, 4, 4> K;
+		tet4Stiffness(p, K);
+		op(K);
+		break;
+	}
+	case TET10: {
+		MathLib::FixedMatrix<double, 10, 10> K;
+		tet10Stiffness(p, K);
+		op(K);
+		break;
+	}
+	default:
+		break;
+	}
+}
+
+} // end anonymous namespace
+
+ElementByElementLaplacian::ElementByElementLaplacian(Mesh const& mesh) :
+	MathLib::LinearOperator<double>(mesh.getNNodes(), mesh.getNNodes()),
+	_mesh(mesh), _n_elements(mesh.getNElements()), _kinds(new unsigned char[_n_elements]),
+	_elem_node_ptr(new unsigned[_n_elements + 1]), _elem_nodes(NULL),
+	_n_colors(0), _color_ptr(NULL), _color_elems(NULL),
+	_dirichlet(new unsigned char[_n_rows]), _inv_diag(new double[_n_rows])
+{
+	std::vector<Element*> const& elements(_mesh.getElements());
+	unsigned n_unsupported(0);
+	_elem_node_ptr[0] = 0;
+	for (unsigned e(0); e < _n_elements; e++) {
+		_kinds[e] = getElementKind(*elements[e]);
+		if (_kinds[e] == UNSUPPORTED) {
+			n_unsupported++;
+			_elem_node_ptr[e + 1] = _elem_node_ptr[e];
+		} else
+			_elem_node_ptr[e + 1] = _elem_node_ptr[e] + elements[e]->getNNodes();
+	}
+	if (n_unsupported > 0)
+		WARN("ElementByElementLaplacian: %d elements of unsupported type are ignored", n_unsupported);
+
+	_elem_nodes = new unsigned[_elem_node_ptr[_n_elements]];
+	for (unsigned e(0); e < _n_elements; e++) {
+		unsigned* const nodes(_elem_nodes + _elem_node_ptr[e]);
+		const unsigned n_nodes(_elem_node_ptr[e + 1] - _elem_node_ptr[e]);
+		for (unsigned i(0); i < n_nodes; i++)
+			nodes[i] = elements[e]->getNodeIndex(i);
+	}
+
+	colorElements();
+
+	for (unsigned i(0); i < _n_rows; i++)
+		_dirichlet[i] = 0;
+	computeDiagonal();
+}
+
+ElementByElementLaplacian::~ElementByElementLaplacian()
+{
+	delete [] _kinds;
+	delete [] _elem_node_ptr;
+	delete [] _elem_nodes;
+	delete [] _color_ptr;
+	delete [] _color_elems;
+	delete [] _dirichlet;
+	delete [] _inv_diag;
+}
+
+void ElementByElementLaplacian::setDirichletNodes(std::vector<std::size_t> const& node_ids)
+{
+	for (unsigned i(0); i < _n_rows; i++)
+		_dirichlet[i] = 0;
+	const std::size_t n_ids(node_ids.size());
+	for (std::size_t k(0); k < n_ids; k++)
+		_dirichlet[node_ids[k]] = 1;
+	computeDiagonal();
+}
+
+void ElementByElementLaplacian::amux(double d, double const * const __restrict__ x,
+		double * __restrict__ y) const
+{
+	const OPENMP_LOOP_TYPE n(_n_rows);
+	OPENMP_LOOP_TYPE i;
+	#pragma omp parallel for schedule(static)
+	for (i = 0; i < n; i++)
+		y[i] = 0.0;
+
+	// the elements of one color do not share nodes
+	for (unsigned c(0); c < _n_colors; c++) {
+		const OPENMP_LOOP_TYPE beg(_color_ptr[c]);
+		const OPENMP_LOOP_TYPE end(_color_ptr[c + 1]);
+		OPENMP_LOOP_TYPE k;
+		#pragma omp parallel for schedule(static)
+		for (k = beg; k < end; k++)
+			applyElement(_color_elems[k], d, x, y);
+	}
+
+	#pragma omp parallel for schedule(static)
+	for (i = 0; i < n; i++)
+		if (_dirichlet[i])
+			y[i] = d * x[i];
+}
+
+void ElementByElementLaplacian::precondApply(double* x) const
+{
+	const OPENMP_LOOP_TYPE n(_n_rows);
+	OPENMP_LOOP_TYPE i;
+	#pragma omp parallel for schedule(static)
+	for (i = 0; i < n; i++)
+		x[i] *= _inv_diag[i];
+}
+
+std::size_t ElementByElementLaplacian::getMemoryUsage() const
+{
+	return _n_elements * sizeof(unsigned char)
+		+ (_n_elements + 1 + _elem_node_ptr[_n_elements]) * sizeof(unsigned)
+		+ (_n_colors + 1 + _color_ptr[_n_colors]) * sizeof(unsigned)
+		+ _n_rows * (sizeof(unsigned char) + sizeof(double));
+}
+
+void ElementByElementLaplacian::colorElements()
+{
+	const unsigned n_nodes(_n_rows);
+	// elements adjacent to the nodes in CRS format
+	std::vector<unsigned> node_elem_ptr(n_nodes + 1, 0);
+	for (unsigned k(0); k < _elem_node_ptr[_n_elements]; k++)
+		node_elem_ptr[_elem_nodes[k] + 1]++;
+	for (unsigned i(0); i < n_nodes; i++)
+		node_elem_ptr[i + 1] += node_elem_ptr[i];
+	std::vector<unsigned> node_elems(node_elem_ptr[n_nodes]);
+	std::vector<unsigned> pos(node_elem_ptr.begin(), node_elem_ptr.end() - 1);
+	for (unsigned e(0); e < _n_elements; e++)
+		for (unsigned k(_elem_node_ptr[e]); k < _elem_node_ptr[e + 1]; k++)
+			node_elems[pos[_elem_nodes[k]]++] = e;
+
+	// greedy coloring: every element gets the smallest color that is not
+	// used by an already colored element sharing a node with it
+	const unsigned no_color(std::numeric_limits<unsigned>::max());
+	std::vector<unsigned> colors(_n_elements, no_color);
+	// used_by[c] == e iff color c is used by a neighbor of element e
+	std::vector<unsigned> used_by;
+	for (unsigned e(0); e < _n_elements; e++) {
+		if (_elem_node_ptr[e] == _elem_node_ptr[e + 1])
+			continue;
+		for (unsigned k(_elem_node_ptr[e]); k < _elem_node_ptr[e + 1]; k++) {
+			const unsigned node(_elem_nodes[k]);
+			for (unsigned j(node_elem_ptr[node]); j < node_elem_ptr[node + 1]; j++)
+				if (colors[node_elems[j]] != no_color)
+					used_by[colors[node_elems[j]]] = e;
+		}
+		unsigned c(0);
+		while (c < _n_colors && used_by[c] == e)
+			c++;
+		if (c == _n_colors) {
+			_n_colors++;
+			used_by.push_back(no_color);
+		}
+		colors[e] = c;
+	}
+
+	// sort the elements by color
+	_color_ptr = new unsigned[_n_colors + 1];
+	for (unsigned c(0); c <= _n_colors; c++)
+		_color_ptr[c] = 0;
+	for (unsigned e(0); e < _n_elements; e++)
+		if (colors[e] != no_color)
+			_color_ptr[colors[e] + 1]++;
+	for (unsigned c(0); c < _n_colors; c++)
+		_color_ptr[c + 1] += _color_ptr[c];
+	_color_elems = new unsigned[_color_ptr[_n_colors]];
+	std::vector<unsigned> color_pos(_color_ptr, _color_ptr + _n_colors);
+	for (unsigned e(0); e < _n_elements; e++)
+		if (colors[e] != no_color)
+			_color_elems[color_pos[colors[e]]++] = e;
+}
+
+void ElementByElementLaplacian::computeDiagonal()
+{
+	for (unsigned i(0); i < _n_rows; i++)
+		_inv_diag[i] = 0.0;
+	for (unsigned e(0); e < _n_elements; e++)
+		addElementDiagonal(e, _inv_diag);
+	for (unsigned i(0); i < _n_rows; i++) {
+		if (_dirichlet[i] || _inv_diag[i] == 0.0)
+			_inv_diag[i] = 1.0;
+		else
+			_inv_diag[i] = 1.0 / _inv_diag[i];
+	}
+}
+
+void ElementByElementLaplacian::applyElement(unsigned e, double d, double const*const x,
+		double* y) const
+{
+	unsigned const*const nodes(_elem_nodes + _elem_node_ptr[e]);
+	const unsigned n_nodes(_elem_node_ptr[e + 1] - _elem_node_ptr[e]);
+	double const* p[10];
+	for (unsigned i(0); i < n_nodes; i++)
+		p[i] = _mesh.getNode(nodes[i])->getCoords();
+	processElementMatrix(_kinds[e], p, ApplyElementMatrix(nodes, _dirichlet, d, x, y));
+}
+
+void ElementByElementLaplacian::addElementDiagonal(unsigned e, double* diag) const
+{
+	unsigned const*const nodes(_elem_nodes + _elem_node_ptr[e]);
+	const unsigned n_nodes(_elem_node_ptr[e + 1] - _elem_node_ptr[e]);
+	double const* p[10];
+	for (unsigned i(0); i < n_nodes; i++)
+		p[i] = _mesh.getNode(nodes[i])->getCoords();
+	processElementMatrix(_kinds[e], p, AddElementDiagonal(nodes, diag));
+}
+
+} // end namespace MeshLib
@@ -0,0 +1,118 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file ElementByElementLaplacian.h
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#ifndef ELEMENTBYELEMENTLAPLACIAN_H_
+#define ELEMENTBYELEMENTLAPLACIAN_H_
+
+#include <vector>
+#include <cstddef>
+
+// MathLib
+#include "LinAlg/LinearOperator.h"
+
+namespace MeshLib {
+
+// forward declaration
+class Mesh;
+
+/**
+ * ElementByElementLaplacian is the stiffness matrix of the Laplace operator
+ * \f$ K_{ij} = \int \nabla \phi_i \cdot \nabla \phi_j \f$ discretized with
+ * the finite elements of a mesh. The global matrix is never assembled: amux()
+ * computes the element matrices on the fly and adds their contributions to
+ * the result. Besides the mesh only the element connectivity (one index per
+ * element node) and a few arrays of the length of the number of nodes are
+ * stored. Hence the operator needs considerably less memory than the assembled
+ * CRS matrix, especially for quadratic elements.
+ *
+ * Supported elements are lines (2 nodes), triangles (3 nodes) and tetrahedra
+ * with 4 nodes (linear) or 10 nodes (quadratic, straight sided). Other
+ * elements are ignored.
+ *
+ * The elements are colored such that elements of the same color do not share
+ * nodes. amux() processes the colors one after another and the elements of
+ * one color in parallel (OpenMP) without write conflicts. The result does not
+ * depend on the number of threads.
+ *
+ * The mesh node ids have to coincide with the positions of the nodes in the
+ * node vector of the mesh (see Mesh::resetNodeIDs()), row i of the operator
+ * belongs to node i.
+ */
+class ElementByElementLaplacian : public MathLib::LinearOperator<double>
+{
+public:
+	/**
+	 * Sets up the connectivity and the coloring of the elements. The mesh
+	 * must not be changed during the lifetime of the operator.
+	 * @param mesh the mesh
+	 */
+	ElementByElementLaplacian(Mesh const& mesh);
+	virtual ~ElementByElementLaplacian();
+
+	/**
+	 * Replaces the rows and the columns of the given nodes by the rows and
+	 * columns of the identity matrix, i.e. homogeneous Dirichlet boundary
+	 * conditions. Then the operator is symmetric positive definite, as long
+	 * as every connected component of the mesh contains a Dirichlet node.
+	 * @param node_ids the ids of the Dirichlet nodes
+	 */
+	void setDirichletNodes(std::vector<std::size_t> const& node_ids);
+
+	/**
+	 * y = d * K * x
+	 * @param d scalar factor
+	 * @param x vector to multiply with
+	 * @param y result vector
+	 */
+	void amux(double d, double const * const __restrict__ x, double * __restrict__ y) const;
+
+	/**
+	 * Jacobi (diagonal) preconditioner, the diagonal is computed element by
+	 * element, too.
+	 */
+	void precondApply(double* x) const;
+
+	/** @return the number of colors of the element coloring */
+	unsigned getNColors() const { return _n_colors; }
+
+	/**
+	 * @return the number of bytes allocated by the operator (without the
+	 * mesh)
+	 */
+	std::size_t getMemoryUsage() const;
+
+private:
+	void colorElements();
+	void computeDiagonal();
+	void applyElement(unsigned e, double d, double const*const x, double* y) const;
+	void addElementDiagonal(unsigned e, double* diag) const;
+
+	Mesh const& _mesh;
+	const unsigned _n_elements;
+	/** kind of the element matrix (line, triangle, ...), one entry per element */
+	unsigned char* _kinds;
+	/** element connectivity in CRS format, row e holds the nodes of element e */
+	unsigned* _elem_node_ptr;
+	unsigned* _elem_nodes;
+	unsigned _n_colors;
+	/** the elements of color c are _color_elems[_color_ptr[c]], ..., _color_elems[_color_ptr[c+1]-1] */
+	unsigned* _color_ptr;
+	unsigned* _color_elems;
+	/** _dirichlet[i] != 0 iff node i is a Dirichlet node */
+	unsigned char* _dirichlet;
+	/** inverse of the diagonal of the operator */
+	double* _inv_diag;
+};
+
+} // end namespace MeshLib
+
+#endif /* ELEMENTBYELEMENTLAPLACIAN_H_ */
@@ -0,0 +1,100 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file ElementView.h
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#ifndef ELEMENTVIEW_H_
+#define ELEMENTVIEW_H_
+
+#include "MeshTopology.h"
+#include "FaceView.h"
+#include "EdgeView.h"
+
+namespace MeshLib {
+
+/**
+ * Class ElementView is a lightweight reference to an element of a
+ * MeshTopology (a pointer to the topology and the index of the element).
+ * Creating and copying views does not allocate memory. A view is valid as
+ * long as the topology exists and is not changed.
+ */
+class ElementView
+{
+public:
+	ElementView(MeshTopology const& topology, std::size_t idx) :
+		_topology(&topology), _idx(idx)
+	{}
+
+	/** @return the index of the element within the mesh */
+	std::size_t getIndex() const { return _idx; }
+
+	/** @return the type of the element */
+	MshElemType::type getType() const { return _topology->getType(_idx); }
+
+	/** @return the dimension of the element */
+	unsigned getDimension() const { return MeshTopology::getDimension(getType()); }
+
+	/** @return the value (material group) of the element */
+	unsigned getValue() const { return _topology->getValue(_idx); }
+
+	/** @return the number of nodes of the element */
+	unsigned getNNodes() const { return _topology->getNNodes(_idx); }
+
+	/** @return the mesh index of the local node i */
+	unsigned getNodeIndex(unsigned i) const { return _topology->getNodeIndices(_idx)[i]; }
+
+	/** @return the mesh indices of the nodes */
+	unsigned const* getNodeIndices() const { return _topology->getNodeIndices(_idx); }
+
+	/** @return the number of faces (3d elements) or edges (2d elements) */
+	unsigned getNFaces() const { return MeshTopology::getNFaces(getType()); }
+
+	/** @return the number of nodes of face (3d elements) or edge (2d elements) i */
+	unsigned getNFaceNodes(unsigned i) const { return MeshTopology::getNFaceNodes(getType(), i); }
+
+	/** @return the mesh index of node j of face (3d elements) or edge (2d elements) i */
+	unsigned getFaceNodeIndex(unsigned i, unsigned j) const
+	{
+		return getNodeIndex(MeshTopology::getFaceNode(getType(), i, j));
+	}
+
+	/** @return a view of face (3d elements) or edge (2d elements) i */
+	FaceView getFace(unsigned i) const { return FaceView(*_topology, _idx, i); }
+
+	/** @return the number of edges */
+	unsigned getNEdges() const { return MeshTopology::getNEdges(getType()); }
+
+	/** @return a view of edge i */
+	EdgeView getEdge(unsigned i) const { return EdgeView(*_topology, _idx, i); }
+
+	/** @return the number of neighbours */
+	unsigned getNNeighbors() const { return _topology->getNNeighbors(_idx); }
+
+	/**
+	 * @return the index of the neighbour across face (3d elements) or edge
+	 * (2d elements) i or MeshTopology::NO_NEIGHBOR
+	 */
+	unsigned getNeighborIndex(unsigned i) const { return _topology->getNeighborIndices(_idx)[i]; }
+
+	bool operator== (ElementView const& other) const
+	{
+		return _topology == other._topology && _idx == other._idx;
+	}
+
+	bool operator!= (ElementView const& other) const { return !(*this == other); }
+
+private:
+	MeshTopology const* _topology;
+	std::size_t _idx;
+};
+
+} // end namespace MeshLib
+
+#endif /* ELEMENTVIEW_H_ */
@@ -90,9 +90,6 @@ protected:
 	/// 1D elements have no edges.
 	Node const* getEdgeNode(unsigned edge_id, unsigned node_id) const { (void)edge_id; (void)node_id; return NULL; };
 
-	/// 1D elements have no faces.
-	Node* getFaceNode(unsigned face_id, unsigned node_id) const { (void)face_id; (void)node_id; return NULL; };
-
 	/// Returns the ID of a face given an array of nodes (but is not applicable for edges!).
 	unsigned identifyFace(Node* [3]/*nodes[3]*/) const { return std::numeric_limits<unsigned>::max(); };
 
@@ -10,9 +10,12 @@
  * Created on 2012-05-02 by Karsten Rink
  */
 
+#include <limits>
+
 #include "Element.h"
 #include "Node.h"
 #include "Edge.h"
+#include "MeshTopology.h"
 
 #include "MathTools.h"
 
@@ -63,7 +66,12 @@ bool Element::addNeighbor(Element* e)
 				// increment shared nodes counter and check if enough nodes are similar to be sure e is a neighbour of this
 				if ((++count)>=dim)
 				{
-					_neighbors[ this->identifyFace(face_nodes) ] = e;
+					// the shared nodes of quadratic elements (vertices and
+					// edge nodes) do not necessarily belong to one face
+					const unsigned face_id (this->identifyFace(face_nodes));
+					if (face_id >= nNeighbors)
+						return false;
+					_neighbors[face_id] = e;
 					return true;
 				}
 			}
@@ -84,6 +92,14 @@ const Element* Element::getEdge(unsigned i) const
 	return NULL;
 }
 
+Node const* Element::getFaceNode(unsigned face_id, unsigned node_id) const
+{
+	const unsigned idx (MeshTopology::getFaceNode(getType(), face_id, node_id));
+	if (idx == std::numeric_limits<unsigned>::max())
+		return NULL;
+	return _nodes[idx];
+}
+
 void Element::computeSqrEdgeLengthRange(double &min, double &max) const
 {
 	min = std::numeric_limits<double>::max();
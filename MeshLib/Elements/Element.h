@@ -69,12 +69,31 @@ public:
 	/// Get dimension of the mesh element.
 	virtual unsigned getDimension() const = 0;
 
-	/// Returns the i-th edge of the element.
+	/**
+	 * Returns the i-th edge of the element. The edge is created on the heap and
+	 * has to be deleted by the caller, use getEdgeNode() to access the nodes
+	 * without allocating memory.
+	 */
 	const Element* getEdge(unsigned i) const;
 
-	/// Returns the i-th face of the element.
+	/// Return node node_id (0 or 1) of edge edge_id without creating the edge.
+	virtual Node const* getEdgeNode(unsigned edge_id, unsigned node_id) const = 0;
+
+	/**
+	 * Returns the i-th face of the element. The face is created on the heap and
+	 * has to be deleted by the caller, use getFaceNode() to access the nodes
+	 * without allocating memory.
+	 */
 	virtual const Element* getFace(unsigned i) const = 0;
 
+	/**
+	 * Return node node_id of face (3d elements) or edge (2d elements) face_id
+	 * without creating the face. The nodes are in the same order as the nodes
+	 * of the element returned by getFace(). Returns NULL for elements without
+	 * faces, i.e. edges.
+	 */
+	Node const* getFaceNode(unsigned face_id, unsigned node_id) const;
+
 	/// Get the number of edges for this element.
 	virtual unsigned getNEdges() const = 0;
 
@@ -142,9 +161,6 @@ protected:
 	/// Constructor for a generic mesh element without an array of mesh nodes.
 	Element(unsigned value = 0);
 
-	/// Return a specific edge node.
-	virtual Node const* getEdgeNode(unsigned edge_id, unsigned node_id) const = 0;
-
 	/// Returns the ID of a face given an array of nodes.
 	virtual unsigned identifyFace(Node* nodes[3]) const = 0;
 
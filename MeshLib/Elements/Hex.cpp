@@ -47,11 +47,11 @@ const unsigned Hex::_edge_nodes[12][2] =
 };
 
 
-Hex::Hex(Node* nodes[8], unsigned value)
+Hex::Hex(Node* nodes[8], unsigned value, Element* neighbors[6])
 	: Cell(value)
 {
 	_nodes = nodes;
-	_neighbors = new Element*[6];
+	_neighbors = (neighbors != NULL) ? neighbors : new Element*[6];
 	for (unsigned i=0; i<6; i++)
 		_neighbors[i] = NULL;
 	this->_volume = this->computeVolume();
@@ -44,9 +44,15 @@ namespace MeshLib {
  */
 class Hex : public Cell
 {
+	/// MeshTopology reads the local face numbering
+	friend class MeshTopology;
+
 public:
-	/// Constructor with an array of mesh nodes.
-	Hex(Node* nodes[8], unsigned value = 0);
+	/**
+	 * Constructor with an array of mesh nodes and optionally an array for
+	 * the neighbours, the element takes ownership of the arrays.
+	 */
+	Hex(Node* nodes[8], unsigned value = 0, Element* neighbors[6] = NULL);
 
 	/// Constructor using single mesh nodes.
 	Hex(Node* n0, Node* n1, Node* n2, Node* n3, Node* n4, Node* n5, Node* n6, Node* n7, unsigned value);
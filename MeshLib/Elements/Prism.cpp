@@ -45,11 +45,11 @@ const unsigned Prism::_edge_nodes[9][2] =
 const unsigned Prism::_n_face_nodes[5] = { 3, 4, 4, 4, 3 };
 
 
-Prism::Prism(Node* nodes[6], unsigned value)
+Prism::Prism(Node* nodes[6], unsigned value, Element* neighbors[5])
 	: Cell(value)
 {
 	_nodes = nodes;
-	_neighbors = new Element*[5];
+	_neighbors = (neighbors != NULL) ? neighbors : new Element*[5];
 	for (unsigned i=0; i<5; i++)
 		_neighbors[i] = NULL;
 	this->_volume = this->computeVolume();
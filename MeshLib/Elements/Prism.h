@@ -42,9 +42,15 @@ namespace MeshLib {
  */
 class Prism : public Cell
 {
+	/// MeshTopology reads the local face numbering
+	friend class MeshTopology;
+
 public:
-	/// Constructor with an array of mesh nodes.
-	Prism(Node* nodes[6], unsigned value = 0);
+	/**
+	 * Constructor with an array of mesh nodes and optionally an array for
+	 * the neighbours, the element takes ownership of the arrays.
+	 */
+	Prism(Node* nodes[6], unsigned value = 0, Element* neighbors[5] = NULL);
 
 	/// Constructor using single mesh nodes.
 	Prism(Node* n0, Node* n1, Node* n2, Node* n3, Node* n4, Node* n5, unsigned value = 0);
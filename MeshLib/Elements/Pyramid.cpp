@@ -44,11 +44,11 @@ const unsigned Pyramid::_edge_nodes[8][2] =
 const unsigned Pyramid::_n_face_nodes[5] = { 3, 3, 3, 3, 4 };
 
 
-Pyramid::Pyramid(Node* nodes[5], unsigned value)
+Pyramid::Pyramid(Node* nodes[5], unsigned value, Element* neighbors[5])
 	: Cell(value)
 {
 	_nodes = nodes;
-	_neighbors = new Element*[5];
+	_neighbors = (neighbors != NULL) ? neighbors : new Element*[5];
 	for (unsigned i=0; i<5; i++)
 		_neighbors[i] = NULL;
 	this->_volume = this->computeVolume();
@@ -40,9 +40,15 @@ namespace MeshLib {
  */
 class Pyramid : public Cell
 {
+	/// MeshTopology reads the local face numbering
+	friend class MeshTopology;
+
 public:
-	/// Constructor with an array of mesh nodes.
-	Pyramid(Node* nodes[5], unsigned value = 0);
+	/**
+	 * Constructor with an array of mesh nodes and optionally an array for
+	 * the neighbours, the element takes ownership of the arrays.
+	 */
+	Pyramid(Node* nodes[5], unsigned value = 0, Element* neighbors[5] = NULL);
 
 	/// Constructor using single mesh nodes.
 	Pyramid(Node* n0, Node* n1, Node* n2, Node* n3, Node* n4, unsigned value = 0);
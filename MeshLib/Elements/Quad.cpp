@@ -28,11 +28,11 @@ const unsigned Quad::_edge_nodes[4][2] =
 };
 
 
-Quad::Quad(Node* nodes[4], unsigned value)
+Quad::Quad(Node* nodes[4], unsigned value, Element* neighbors[4])
 	: Face(value)
 {
 	_nodes = nodes;
-	_neighbors = new Element*[4];
+	_neighbors = (neighbors != NULL) ? neighbors : new Element*[4];
 	for (unsigned i=0; i<4; i++)
 		_neighbors[i] = NULL;
 	this->_area = this->computeVolume();
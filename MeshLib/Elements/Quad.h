@@ -34,9 +34,15 @@ namespace MeshLib {
  */
 class Quad : public Face
 {
+	/// MeshTopology reads the local face numbering
+	friend class MeshTopology;
+
 public:
-	/// Constructor with an array of mesh nodes.
-	Quad(Node* nodes[4], unsigned value = 0);
+	/**
+	 * Constructor with an array of mesh nodes and optionally an array for
+	 * the neighbours, the element takes ownership of the arrays.
+	 */
+	Quad(Node* nodes[4], unsigned value = 0, Element* neighbors[4] = NULL);
 
 	/// Constructor using single mesh nodes.
 	Quad(Node* n0, Node* n1, Node* n2, Node* n3, unsigned value = 0);
@@ -37,11 +37,11 @@ const unsigned Tet::_edge_nodes[6][2] =
 	{2, 3}  // Edge 5
 };
 
-Tet::Tet(Node* nodes[4], unsigned value)
+Tet::Tet(Node* nodes[4], unsigned value, Element* neighbors[4])
 	: Cell(value)
 {
 	_nodes = nodes;
-	_neighbors = new Element*[4];
+	_neighbors = (neighbors != NULL) ? neighbors : new Element*[4];
 	for (unsigned i=0; i<4; i++)
 		_neighbors[i] = NULL;
 	this->_volume = this->computeVolume();
@@ -61,10 +61,10 @@ Tet::Tet(Node* n0, Node* n1, Node* n2, Node* n3, unsigned value)
 	this->_volume = this->computeVolume();
 }
 
-Tet::Tet(unsigned value)
+Tet::Tet(unsigned value, Element* neighbors[4])
 	: Cell(value)
 {
-	_neighbors = new Element*[4];
+	_neighbors = (neighbors != NULL) ? neighbors : new Element*[4];
 	for (unsigned i=0; i<4; i++)
 		_neighbors[i] = NULL;
 }
@@ -39,9 +39,15 @@ namespace MeshLib {
  */
 class Tet : public Cell
 {
+	/// MeshTopology reads the local face numbering
+	friend class MeshTopology;
+
 public:
-	/// Constructor with an array of mesh nodes.
-	Tet(Node* nodes[4], unsigned value = 0);
+	/**
+	 * Constructor with an array of mesh nodes and optionally an array for
+	 * the neighbours, the element takes ownership of the arrays.
+	 */
+	Tet(Node* nodes[4], unsigned value = 0, Element* neighbors[4] = NULL);
 
 	/// Constructor using single mesh nodes.
 	Tet(Node* n0, Node* n1, Node* n2, Node* n3, unsigned value = 0);
@@ -93,7 +99,7 @@ public:
 
 protected:
 	/// Constructor without nodes (for use of derived classes)
-	Tet(unsigned value = 0);
+	Tet(unsigned value = 0, Element* neighbors[4] = NULL);
 
 	/// Calculates the volume of a tetrahedron via the determinant of the matrix given by its four points.
 	double computeVolume();
@@ -15,8 +15,8 @@
 
 namespace MeshLib {
 
-Tet10::Tet10(Node* nodes[10], unsigned value)
-	: Tet(value), FemElem()
+Tet10::Tet10(Node* nodes[10], unsigned value, Element* neighbors[4])
+	: Tet(value, neighbors), FemElem()
 {
 	_nodes = nodes;
 	this->_volume = this->computeVolume();
@@ -55,8 +55,13 @@ Tet10::~Tet10()
 
 void Tet10::calcCentroid()
 {
-	//TODO calculation!
-	_centroid = 0;
+	// the centroid of the (straight sided) tetrahedron is the mean of its vertices
+	for (unsigned d(0); d < 3; d++) {
+		_centroid[d] = 0.0;
+		for (unsigned i(0); i < 4; i++)
+			_centroid[d] += (*_nodes[i])[d];
+		_centroid[d] /= 4.0;
+	}
 }
 
 Element* Tet10::clone() const
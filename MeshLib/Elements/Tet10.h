@@ -46,8 +46,11 @@ namespace MeshLib {
 class Tet10 : public Tet, public FemElem
 {
 public:
-	/// Constructor with an array of mesh nodes.
-	Tet10(Node* nodes[10], unsigned value = 0);
+	/**
+	 * Constructor with an array of mesh nodes and optionally an array for
+	 * the neighbours, the element takes ownership of the arrays.
+	 */
+	Tet10(Node* nodes[10], unsigned value = 0, Element* neighbors[4] = NULL);
 
 	/// Constructor using a simple Tetrahedron
 	Tet10(const Tet &tet);
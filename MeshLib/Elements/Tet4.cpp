@@ -41,8 +41,13 @@ Tet4::~Tet4()
 
 void Tet4::calcCentroid()
 {
-	_centroid = 0;
-	//TODO calculation!
+	// the centroid of the (straight sided) tetrahedron is the mean of its vertices
+	for (unsigned d(0); d < 3; d++) {
+		_centroid[d] = 0.0;
+		for (unsigned i(0); i < 4; i++)
+			_centroid[d] += (*_nodes[i])[d];
+		_centroid[d] /= 4.0;
+	}
 }
 
 }
@@ -27,11 +27,11 @@ const unsigned Tri::_edge_nodes[3][2] =
 };
 
 
-Tri::Tri(Node* nodes[3], unsigned value)
+Tri::Tri(Node* nodes[3], unsigned value, Element* neighbors[3])
 	: Face(value)
 {
 	_nodes = nodes;
-	_neighbors = new Element*[3];
+	_neighbors = (neighbors != NULL) ? neighbors : new Element*[3];
 	for (unsigned i=0; i<3; i++)
 		_neighbors[i] = NULL;
 	this->_area = this->computeVolume();
@@ -36,9 +36,15 @@ namespace MeshLib {
  */
 class Tri : public Face
 {
+	/// MeshTopology reads the local face numbering
+	friend class MeshTopology;
+
 public:
-	/// Constructor with an array of mesh nodes.
-	Tri(Node* nodes[3], unsigned value = 0);
+	/**
+	 * Constructor with an array of mesh nodes and optionally an array for
+	 * the neighbours, the element takes ownership of the arrays.
+	 */
+	Tri(Node* nodes[3], unsigned value = 0, Element* neighbors[3] = NULL);
 
 	/// Constructor using single mesh nodes.
 	Tri(Node* n0, Node* n1, Node* n2, unsigned value = 0);
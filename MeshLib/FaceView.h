@@ -0,0 +1,109 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file FaceView.h
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#ifndef FACEVIEW_H_
+#define FACEVIEW_H_
+
+#include <algorithm>
+
+#include "MeshTopology.h"
+
+namespace MeshLib {
+
+/**
+ * Class FaceView is a lightweight reference to face i of an element of a
+ * MeshTopology, for 2d elements the faces are the edges. The node indices
+ * of the face are looked up in the static face tables of the element types,
+ * i.e., in contrast to Element::getFace() no Node array and no Element
+ * object is created.
+ */
+class FaceView
+{
+public:
+	FaceView(MeshTopology const& topology, std::size_t elem_idx, unsigned face_idx) :
+		_topology(&topology), _elem_idx(elem_idx), _face_idx(face_idx)
+	{}
+
+	/** @return the index of the element the face belongs to */
+	std::size_t getElementIndex() const { return _elem_idx; }
+
+	/** @return the local index of the face within the element */
+	unsigned getLocalIndex() const { return _face_idx; }
+
+	/** @return the number of nodes of the face */
+	unsigned getNNodes() const
+	{
+		return MeshTopology::getNFaceNodes(_topology->getType(_elem_idx), _face_idx);
+	}
+
+	/** @return the mesh index of node j of the face */
+	unsigned getNodeIndex(unsigned j) const
+	{
+		return _topology->getNodeIndices(_elem_idx)[MeshTopology::getFaceNode(_topology->getType(_elem_idx), _face_idx, j)];
+	}
+
+	/**
+	 * copies the mesh indices of the face nodes in ascending order into nodes
+	 * (at most 4 entries)
+	 * @return the number of face nodes
+	 */
+	unsigned getSortedNodeIndices(unsigned* nodes) const
+	{
+		const MshElemType::type type(_topology->getType(_elem_idx));
+		unsigned const*const elem_nodes(_topology->getNodeIndices(_elem_idx));
+		const unsigned n_face_nodes(MeshTopology::getNFaceNodes(type, _face_idx));
+		for (unsigned j(0); j < n_face_nodes; j++)
+			nodes[j] = elem_nodes[MeshTopology::getFaceNode(type, _face_idx, j)];
+		std::sort(nodes, nodes + n_face_nodes);
+		return n_face_nodes;
+	}
+
+	/**
+	 * @return the index of the element on the other side of the face or
+	 * MeshTopology::NO_NEIGHBOR, requires MeshTopology::computeNeighbors()
+	 */
+	unsigned getNeighborIndex() const { return _topology->getNeighborIndices(_elem_idx)[_face_idx]; }
+
+	/** @return true if the face is on the boundary, requires MeshTopology::computeNeighbors() */
+	bool isBoundary() const { return getNeighborIndex() == MeshTopology::NO_NEIGHBOR; }
+
+private:
+	MeshTopology const* _topology;
+	std::size_t _elem_idx;
+	unsigned _face_idx;
+};
+
+/**
+ * Calls face_functor(FaceView const&) once for every face of the mesh: a face
+ * shared by two elements is visited from the element with the smaller index,
+ * boundary faces are visited from their element. The faces are visited in the
+ * order of the elements, no memory is allocated.
+ * @param topology a topology with neighbour information (MeshTopology::computeNeighbors())
+ * @param face_functor the functor, it is passed by reference in order to collect results
+ */
+template <typename FaceFunctor>
+void forEachUniqueFace(MeshTopology const& topology, FaceFunctor &face_functor)
+{
+	const std::size_t n_elements(topology.getNElements());
+	for (std::size_t k(0); k < n_elements; k++) {
+		const unsigned n_faces(topology.getNNeighbors(k));
+		unsigned const*const neighbors(topology.getNeighborIndices(k));
+		for (unsigned i(0); i < n_faces; i++) {
+			if (neighbors[i] == MeshTopology::NO_NEIGHBOR || neighbors[i] > k)
+				face_functor(FaceView(topology, k, i));
+		}
+	}
+}
+
+} // end namespace MeshLib
+
+#endif /* FACEVIEW_H_ */
@@ -12,7 +12,19 @@
 
 #include "Mesh.h"
 
+#include <cmath>
+#include <iostream>
+
+// GeoLib
+#include "AxisAlignedBoundingBox.h"
+
+// MathLib
+#include "MathTools.h"
+
 #include "Node.h"
+#include "MeshArena.h"
+#include "MeshCoarsener.h"
+#include "ElementView.h"
 #include "Elements/Tri.h"
 #include "Elements/Quad.h"
 #include "Elements/Tet.h"
@@ -22,20 +34,37 @@
 
 namespace MeshLib {
 
-Mesh::Mesh(const std::string &name, const std::vector<Node*> &nodes, const std::vector<Element*> &elements)
-	: _mesh_dimension(0), _name(name), _nodes(nodes), _elements(elements)
+Mesh::Mesh(const std::string &name, const std::vector<Node*> &nodes, const std::vector<Element*> &elements,
+	MeshArena* arena)
+	: _mesh_dimension(0), _name(name), _nodes(nodes), _elements(elements), _arena(arena)
+{
+	this->resetNodeIDs(); // reset node ids so they match the node position in the vector
+	_edge_length[0] = 0;
+	_edge_length[1] = 0;
+	this->makeNodesUnique();
+	this->setDimension();
+	this->resetTopology();
+	this->setElementInformationForNodes();
+	this->setNeighborInformationForElements();
+}
+
+Mesh::Mesh(const std::string &name, const std::vector<Node*> &nodes, MeshTopology const& topology)
+	: _mesh_dimension(0), _name(name), _nodes(nodes), _arena(new MeshArena)
 {
 	this->resetNodeIDs(); // reset node ids so they match the node position in the vector
 	_edge_length[0] = 0;
 	_edge_length[1] = 0;
+	topology.createElements(_nodes, _elements, *_arena);
 	this->makeNodesUnique();
 	this->setDimension();
+	this->resetTopology();
 	this->setElementInformationForNodes();
 	this->setNeighborInformationForElements();
 }
 
 Mesh::Mesh(const Mesh &mesh)
-	: _mesh_dimension(mesh.getDimension()), _name(mesh.getName()), _nodes(mesh.getNodes()), _elements(mesh.getElements())
+	: _mesh_dimension(mesh.getDimension()), _name(mesh.getName()), _nodes(mesh.getNodes()), _elements(mesh.getElements()),
+	  _arena(NULL)
 {
 	const std::vector<Node*> nodes (mesh.getNodes());
 	const size_t nNodes (nodes.size());
@@ -53,52 +82,169 @@ Mesh::Mesh(const Mesh &mesh)
 	}
 
 	if (_mesh_dimension==0) this->setDimension();
+	this->resetTopology();
 	this->setElementInformationForNodes();
 	this->setNeighborInformationForElements();
 }
 
 Mesh::~Mesh()
 {
+	// objects in the arena are only destructed, the memory (including the
+	// node and neighbour arrays of the elements) is released with the arena
 	const size_t nElements (_elements.size());
 	for (size_t i=0; i<nElements; i++)
-		delete _elements[i];
+	{
+		if (_arena && _arena->contains(_elements[i]))
+		{
+			_elements[i]->_nodes = NULL;
+			_elements[i]->_neighbors = NULL;
+			_elements[i]->~Element();
+		}
+		else
+			delete _elements[i];
+	}
 
 	const size_t nNodes (_nodes.size());
 	for (size_t i=0; i<nNodes; i++)
-		delete _nodes[i];
+	{
+		if (_arena && _arena->contains(_nodes[i]))
+			_nodes[i]->~Node();
+		else
+			delete _nodes[i];
+	}
+
+	delete _arena;
 }
 
-void Mesh::makeNodesUnique()
+size_t Mesh::makeNodesUnique(double rel_eps)
 {
-	//check for unique mesh nodes
-	//PointVec::makePntsUnique
+	const size_t n_nodes (_nodes.size());
+	if (n_nodes < 2)
+		return 0;
+
+	// the tolerance is relative to the size of the mesh
+	GeoLib::AABB aabb;
+	for (size_t k(0); k < n_nodes; k++)
+		aabb.update(_nodes[k]->getCoords());
+	const double eps (rel_eps * sqrt(MathLib::sqrDist(aabb.getMinPoint().getCoords(), aabb.getMaxPoint().getCoords())));
+
+	// the node ids equal the positions in the node vector (see resetNodeIDs())
+	std::vector<unsigned> id_map;
+	const size_t n_unique_nodes (MeshCoarsener::mapCloseNodes(_nodes, eps, id_map));
+	if (n_unique_nodes == n_nodes)
+		return 0;
+
+	// the first node of every group of identical nodes is kept
+	std::vector<Node*> unique_nodes(n_unique_nodes, NULL);
+	for (size_t k(0); k < n_nodes; k++)
+		if (unique_nodes[id_map[k]] == NULL)
+			unique_nodes[id_map[k]] = _nodes[k];
 
 	//replace node pointers in elements
-	unsigned nElements (_elements.size());
-	for (unsigned i=0; i<nElements; i++)
+	const size_t nElements (_elements.size());
+	std::vector<char> degenerated(nElements, 0);
+#ifdef _OPENMP
+	OPENMP_LOOP_TYPE i;
+	#pragma omp parallel for
+#else
+	unsigned i(0);
+#endif
+	for (i = 0; i < nElements; i++)
 	{
-		unsigned nNodes (_elements[i]->getNNodes());
+		Element* elem (_elements[i]);
+		const unsigned nNodes (elem->getNNodes());
 		for (unsigned j=0; j<nNodes; j++)
-			_elements[i]->getNodeIndex(j);
+			elem->_nodes[j] = unique_nodes[id_map[elem->_nodes[j]->getID()]];
+		for (unsigned j=0; j+1<nNodes && !degenerated[i]; j++)
+			for (unsigned l=j+1; l<nNodes && !degenerated[i]; l++)
+				degenerated[i] = (elem->_nodes[j] == elem->_nodes[l]);
 	}
 
-	//set correct id for each node
+	// remove the elements that collapsed
+	size_t n_elements (0);
+	for (size_t k(0); k < nElements; k++)
+	{
+		if (!degenerated[k])
+			_elements[n_elements++] = _elements[k];
+		else if (_arena && _arena->contains(_elements[k]))
+		{
+			_elements[k]->_nodes = NULL;
+			_elements[k]->_neighbors = NULL;
+			_elements[k]->~Element();
+		}
+		else
+			delete _elements[k];
+	}
+	_elements.resize(n_elements);
 
+	// remove the duplicates
+	for (size_t k(0); k < n_nodes; k++)
+	{
+		if (unique_nodes[id_map[k]] != _nodes[k])
+		{
+			if (_arena && _arena->contains(_nodes[k]))
+				_nodes[k]->~Node();
+			else
+				delete _nodes[k];
+		}
+	}
+	_nodes.swap(unique_nodes);
+	this->resetNodeIDs();
+
+	return nElements - n_elements;
 }
 
 void Mesh::addNode(Node* node)
 {
+	// the node id has to match the position in the node vector
+	node->setID(static_cast<unsigned>(_nodes.size()));
 	_nodes.push_back(node);
 }
 
 void Mesh::addElement(Element* elem)
 {
-	_elements.push_back(elem);
+	this->addElements(std::vector<Element*>(1, elem));
+}
 
-	// add element information to nodes
-	unsigned nNodes (elem->getNNodes());
-	for (unsigned i=0; i<nNodes; i++)
-		elem->_nodes[i]->addElement(elem);
+void Mesh::addElements(std::vector<Element*> const& elements)
+{
+	const size_t nNewElements (elements.size());
+	if (nNewElements == 0)
+		return;
+	_elements.insert(_elements.end(), elements.begin(), elements.end());
+
+	unsigned node_indices[MeshTopology::MAX_ELEMENT_NODES];
+	for (size_t k=0; k<nNewElements; k++)
+	{
+		Element const*const elem (elements[k]);
+		const unsigned nNodes (elem->getNNodes());
+		for (unsigned i=0; i<nNodes; i++)
+			node_indices[i] = elem->getNodeIndex(i);
+		_topology.addElement(elem->getType(), nNodes, node_indices, elem->getValue());
+	}
+
+	// the element array may have been reallocated, rebuild the element information of the nodes
+	this->setElementInformationForNodes();
+}
+
+void Mesh::reorder(std::vector<unsigned> const& node_order, std::vector<unsigned> const& element_order)
+{
+	const size_t nNodes (_nodes.size());
+	std::vector<Node*> nodes (nNodes);
+	for (size_t k=0; k<nNodes; k++)
+		nodes[k] = _nodes[node_order[k]];
+	_nodes.swap(nodes);
+
+	const size_t nElements (_elements.size());
+	std::vector<Element*> elements (nElements);
+	for (size_t k=0; k<nElements; k++)
+		elements[k] = _elements[element_order[k]];
+	_elements.swap(elements);
+
+	this->resetNodeIDs();
+	this->resetTopology();
+	this->setElementInformationForNodes();
+	this->setNeighborInformationForElements();
 }
 
 void Mesh::resetNodeIDs()
@@ -116,18 +262,27 @@ void Mesh::setDimension()
 			_mesh_dimension = _elements[i]->getDimension();
 }
 
+void Mesh::resetTopology()
+{
+	_topology = MeshTopology(_elements);
+}
+
 void Mesh::setElementInformationForNodes()
 {
-	const size_t nElements (_elements.size());
-	for (unsigned i=0; i<nElements; i++)
-	{
-		const unsigned nNodes (_elements[i]->getNNodes());
-		for (unsigned j=0; j<nNodes; j++)
-			_elements[i]->_nodes[j]->addElement(_elements[i]);
-	}
+	_topology.computeNodeElements(_nodes.size());
+
+	Element* const*const elements (_elements.empty() ? NULL : &_elements[0]);
+	const size_t nNodes (_nodes.size());
+#ifdef _OPENMP
+	OPENMP_LOOP_TYPE k;
+	#pragma omp parallel for
+#else
+	unsigned k(0);
+#endif
+	for (k=0; k<nNodes; k++)
+		_nodes[k]->setElements(NodeElements(elements, _topology.getNodeElementIndices(k), _topology.getNNodeElements(k)));
 #ifdef NDEBUG
 	// search for nodes that are not part of any element
-	const size_t nNodes (_nodes.size());
 	for (unsigned i=0; i<nNodes; i++)
 		if (_nodes[i]->getNElements() == 0)
 			std::cout << "Warning: Node " << i << " is not part of any element." << std::endl;
@@ -147,6 +302,8 @@ void Mesh::setEdgeLengthRange(const double &min_length, const double &max_length
 
 void Mesh::setNeighborInformationForElements()
 {
+	_topology.computeNeighbors();
+
 	const size_t nElements = _elements.size();
 #ifdef _OPENMP
 	OPENMP_LOOP_TYPE m;
@@ -156,27 +313,13 @@ void Mesh::setNeighborInformationForElements()
 #endif
 	for (m=0; m<nElements; m++)
 	{
-		// create vector with all elements connected to current element (includes lots of doubles!)
-		std::vector<Element*> neighbors;
+		const ElementView elem_view (_topology.getElement(m));
 		Element *const element (_elements[m]);
-		if (element->getType() != MshElemType::EDGE)
+		const unsigned nNeighbors (elem_view.getNNeighbors());
+		for (unsigned i(0); i<nNeighbors; i++)
 		{
-			const size_t nNodes (element->getNNodes());
-			for (unsigned n(0); n<nNodes; n++)
-			{
-				std::vector<Element*> const& conn_elems ((element->getNode(n)->getElements()));
-				neighbors.insert(neighbors.end(), conn_elems.begin(), conn_elems.end());
-			}
-
-			const unsigned nNeighbors ( neighbors.size() );
-
-			for (unsigned i(0); i<nNeighbors; i++)
-			{
-				if (element->addNeighbor(neighbors[i]) && neighbors[i]->getType() != MshElemType::EDGE)
-				{
-					neighbors[i]->addNeighbor(element);
-				}
-			}
+			const unsigned neighbor (elem_view.getNeighborIndex(i));
+			element->_neighbors[i] = (neighbor == MeshTopology::NO_NEIGHBOR) ? NULL : _elements[neighbor];
 		}
 	}
 }
@@ -14,13 +14,17 @@
 #define MESH_H_
 
 #include <cstdlib>
+#include <limits>
 #include <string>
 #include <vector>
 
+#include "MeshTopology.h"
+
 namespace MeshLib
 {
 	class Node;
 	class Element;
+	class MeshArena;
 
 /**
  * A basic mesh.
@@ -29,8 +33,22 @@ class Mesh
 {
 
 public:
-	/// Constructor using a mesh name and an array of nodes and elements
-	Mesh(const std::string &name, const std::vector<Node*> &nodes, const std::vector<Element*> &elements);
+	/**
+	 * Constructor using a mesh name and an array of nodes and elements.
+	 * @param arena the arena the nodes and elements were created in (optional),
+	 * the mesh takes ownership of the arena. Objects not allocated in the
+	 * arena are deleted one by one.
+	 */
+	Mesh(const std::string &name, const std::vector<Node*> &nodes, const std::vector<Element*> &elements,
+		MeshArena* arena = NULL);
+
+	/**
+	 * Constructor using a mesh name, an array of nodes and the compact
+	 * connectivity of the elements. The Element objects are created from
+	 * the topology in an arena of the mesh, the node indices of the topology
+	 * refer to the array of nodes.
+	 */
+	Mesh(const std::string &name, const std::vector<Node*> &nodes, MeshTopology const& topology);
 
 	/// Copy constructor
 	Mesh(const Mesh &mesh);
@@ -38,12 +56,19 @@ public:
 	/// Destructor
 	virtual ~Mesh();
 
-	/// Add a node to the mesh.
+	/// Add a node to the mesh. The id of the node is set to its position in the node vector.
 	void addNode(Node* node);
 
-	/// Add an element to the mesh.
+	/**
+	 * Add an element to the mesh. The element information of all nodes is rebuilt,
+	 * i.e. the cost is linear in the size of the mesh. Use addElements() for adding
+	 * many elements.
+	 */
 	void addElement(Element* elem);
 
+	/// Add elements to the mesh. The element information of all nodes is rebuilt once.
+	void addElements(std::vector<Element*> const& elements);
+
 	/// Returns the dimension of the mesh (determinded by the maximum dimension over all elements).
 	unsigned getDimension() const { return _mesh_dimension; };
 
@@ -59,6 +84,12 @@ public:
 	/// Get the element with the given index.
 	const Element* getElement(unsigned idx) const { return _elements[idx]; };
 
+	/// Get the arena the nodes and elements were created in (NULL if the objects were allocated one by one).
+	MeshArena const* getArena() const { return _arena; };
+
+	/// Get the compact connectivity (element nodes and neighbours) of the elements.
+	MeshTopology const& getTopology() const { return _topology; };
+
 	/// Get the minimum edge length for the mesh
 	double getMinEdgeLength() const { return _edge_length[0]; };
 
@@ -80,6 +111,15 @@ public:
 	/// Get the element-vector for the mesh.
 	std::vector<Element*> const& getElements() const { return _elements; };
 
+	/**
+	 * Permutes the nodes and the elements of the mesh, afterwards node k is
+	 * the former node node_order[k] and element k is the former element
+	 * element_order[k]. The node IDs, the topology
+	 * and the neighbour information are updated, the Node and Element
+	 * objects are not moved.
+	 */
+	void reorder(std::vector<unsigned> const& node_order, std::vector<unsigned> const& element_order);
+
 	/// Resets the IDs of all mesh-nodes to their position in the node vector
 	void resetNodeIDs();
 
@@ -94,13 +134,27 @@ public:
 	void setName(const std::string &name) { this->_name = name; };
 
 protected:
-	/// Checks the coordinates of all mesh nodes and removes identical nodes. Elements are adapted accordingly.
-	void makeNodesUnique();
+	/**
+	 * Checks the coordinates of all mesh nodes and removes identical nodes. Elements are adapted accordingly.
+	 * Nodes are identical if their distance is smaller than rel_eps times the length of the
+	 * diagonal of the bounding box of the mesh. The node ids have to match the positions
+	 * in the node vector. Elements that have identical nodes after merging are removed.
+	 * Reporting is left to the caller: the number of merged nodes (elements) is the difference
+	 * of the node (element) numbers before and after the call.
+	 * @return the number of removed elements
+	 */
+	size_t makeNodesUnique(double rel_eps = std::numeric_limits<double>::epsilon());
 
 	/// Sets the dimension of the mesh.
 	void setDimension();
 
-	/// Fills in the neighbor-information for nodes (i.e. which element each node belongs to).
+	/// Copies the connectivity of the elements into the compact topology.
+	void resetTopology();
+
+	/**
+	 * Fills in the neighbor-information for nodes (i.e. which element each node belongs to).
+	 * The adjacency is stored in one array of the topology, the nodes refer to their part of it.
+	 */
 	void setElementInformationForNodes();
 
 	/// Fills in the neighbor-information for elements.
@@ -111,6 +165,10 @@ protected:
 	std::string _name;
 	std::vector<Node*> _nodes;
 	std::vector<Element*> _elements;
+	/// compact copy of the element connectivity, in the same order as _elements
+	MeshTopology _topology;
+	/// memory of the nodes and elements created during the construction
+	MeshArena* _arena;
 
 }; /* class */
 
@@ -0,0 +1,124 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file MeshArena.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <new>
+
+#include "MeshArena.h"
+#include "MeshTopology.h"
+#include "Node.h"
+#include "Elements/Edge.h"
+#include "Elements/Tri.h"
+#include "Elements/Quad.h"
+#include "Elements/Tet.h"
+#include "Elements/Tet10.h"
+#include "Elements/Hex.h"
+#include "Elements/Pyramid.h"
+#include "Elements/Prism.h"
+
+namespace MeshLib {
+
+/// alignment of the allocations (the alignment of the heap allocations)
+static const std::size_t ARENA_ALIGNMENT(2 * sizeof(double));
+
+/// comparison of an address with the begin of a block
+static bool startsBehind(char const* p, std::pair<char*, char*> const& block)
+{
+	return p < block.first;
+}
+
+MeshArena::MeshArena(std::size_t block_size) :
+	_block_size(block_size), _current(NULL), _end(NULL), _n_allocations(0), _memory(0)
+{}
+
+MeshArena::~MeshArena()
+{
+	const std::size_t n_blocks(_blocks.size());
+	for (std::size_t k(0); k < n_blocks; k++)
+		delete [] _blocks[k].first;
+}
+
+void* MeshArena::allocate(std::size_t n_bytes)
+{
+	n_bytes = (n_bytes + ARENA_ALIGNMENT - 1) / ARENA_ALIGNMENT * ARENA_ALIGNMENT;
+	if (n_bytes == 0)
+		n_bytes = ARENA_ALIGNMENT;
+	_n_allocations++;
+	if (static_cast<std::size_t>(_end - _current) >= n_bytes) {
+		void* p(_current);
+		_current += n_bytes;
+		return p;
+	}
+
+	// a new block, the rest of the current block is not used anymore
+	const std::size_t size(std::max(n_bytes, _block_size));
+	char* block(new char[size]);
+	_memory += size;
+	std::pair<char*, char*> const range(block, block + size);
+	_blocks.insert(std::upper_bound(_blocks.begin(), _blocks.end(), range), range);
+	if (size > n_bytes || _current == NULL) {
+		_current = block + n_bytes;
+		_end = block + size;
+	}
+	return block;
+}
+
+Node* MeshArena::createNode(double x, double y, double z, unsigned id)
+{
+	return new (allocate(sizeof(Node))) Node(x, y, z, id);
+}
+
+Element* MeshArena::createElement(MshElemType::type type, Node* const* nodes, unsigned n_nodes, unsigned value)
+{
+	Node** elem_nodes(allocateArray<Node*>(n_nodes));
+	std::copy(nodes, nodes + n_nodes, elem_nodes);
+	const unsigned n_neighbors(MeshTopology::getNFaces(type));
+	Element** neighbors(n_neighbors > 0 ? allocateArray<Element*>(n_neighbors) : NULL);
+
+	switch (type) {
+	case MshElemType::EDGE:
+		return new (allocate(sizeof(Edge))) Edge(elem_nodes, value);
+	case MshElemType::TRIANGLE:
+		return new (allocate(sizeof(Tri))) Tri(elem_nodes, value, neighbors);
+	case MshElemType::QUAD:
+		return new (allocate(sizeof(Quad))) Quad(elem_nodes, value, neighbors);
+	case MshElemType::TETRAHEDRON:
+		if (n_nodes == 10)
+			return new (allocate(sizeof(Tet10))) Tet10(elem_nodes, value, neighbors);
+		return new (allocate(sizeof(Tet))) Tet(elem_nodes, value, neighbors);
+	case MshElemType::HEXAHEDRON:
+		return new (allocate(sizeof(Hex))) Hex(elem_nodes, value, neighbors);
+	case MshElemType::PYRAMID:
+		return new (allocate(sizeof(Pyramid))) Pyramid(elem_nodes, value, neighbors);
+	case MshElemType::PRISM:
+		return new (allocate(sizeof(Prism))) Prism(elem_nodes, value, neighbors);
+	default:
+		std::cerr << "Error in MeshLib::MeshArena::createElement() - element type "
+		          << MshElemType2String(type) << " not supported." << std::endl;
+	}
+	return NULL;
+}
+
+bool MeshArena::contains(void const* p) const
+{
+	char const*const c(static_cast<char const*>(p));
+	// the first block starting behind p, p can only be in the block before
+	std::vector<std::pair<char*, char*> >::const_iterator it(
+		std::upper_bound(_blocks.begin(), _blocks.end(), c, startsBehind));
+	if (it == _blocks.begin())
+		return false;
+	--it;
+	return c < it->second;
+}
+
+} // end namespace MeshLib
@@ -0,0 +1,100 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file MeshArena.h
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#ifndef MESHARENA_H_
+#define MESHARENA_H_
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "MshEnums.h"
+
+namespace MeshLib {
+
+class Node;
+class Element;
+
+/**
+ * Class MeshArena is a bump allocator for the nodes and elements of a mesh.
+ * The memory is requested in large blocks, an allocation only advances a
+ * pointer within the current block. The objects created in the arena are
+ * not deleted one by one, the blocks are released all at once when the
+ * arena is destroyed.
+ *
+ * The mesh readers create the nodes and the elements (together with their
+ * node and neighbour arrays) in an arena and pass the arena to the Mesh,
+ * which takes ownership, see Mesh::Mesh().
+ */
+class MeshArena
+{
+public:
+	/**
+	 * @param block_size the size of the memory blocks in bytes, larger
+	 * requests get a block of their own
+	 */
+	explicit MeshArena(std::size_t block_size = 1 << 22);
+
+	/// Releases the memory blocks. The destructors of the objects are not called.
+	~MeshArena();
+
+	/**
+	 * Allocates memory for n_bytes bytes, the memory is aligned for objects
+	 * of any of the mesh classes.
+	 */
+	void* allocate(std::size_t n_bytes);
+
+	/** Allocates memory for an array of n objects of type T. */
+	template <typename T>
+	T* allocateArray(std::size_t n) { return static_cast<T*>(allocate(n * sizeof(T))); }
+
+	/** Creates a node in the arena. */
+	Node* createNode(double x, double y, double z, unsigned id);
+
+	/**
+	 * Creates an element of the given type in the arena. The node pointers
+	 * are copied into an array in the arena, the neighbour array is also
+	 * allocated in the arena. For tetrahedra with 10 nodes a Tet10 is
+	 * created.
+	 * @return the element or NULL if the type is not supported
+	 */
+	Element* createElement(MshElemType::type type, Node* const* nodes, unsigned n_nodes, unsigned value);
+
+	/** @return true if the object at address p was allocated in the arena */
+	bool contains(void const* p) const;
+
+	/** @return the number of allocations served by the arena */
+	std::size_t getNAllocations() const { return _n_allocations; }
+
+	/** @return the number of memory blocks (heap allocations) of the arena */
+	std::size_t getNBlocks() const { return _blocks.size(); }
+
+	/** @return the number of bytes allocated for the blocks */
+	std::size_t getMemoryUsage() const { return _memory; }
+
+private:
+	/// the arena owns the blocks, copying is not allowed
+	MeshArena(MeshArena const&);
+	MeshArena& operator=(MeshArena const&);
+
+	const std::size_t _block_size;
+	/// begin and end of the blocks, sorted by the address
+	std::vector<std::pair<char*, char*> > _blocks;
+	char* _current;
+	char* _end;
+	std::size_t _n_allocations;
+	std::size_t _memory;
+};
+
+} // end namespace MeshLib
+
+#endif /* MESHARENA_H_ */
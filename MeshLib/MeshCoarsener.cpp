@@ -9,6 +9,12 @@
  *  Created on  Aug 3, 2012 by Thomas Fischer
  */
 
+#include <algorithm>
+#include <limits>
+
+// BaseLib
+#include "ConcurrentUnionFind.h"
+
 // BaseLib/logog
 #include "logog.hpp"
 
@@ -19,6 +25,7 @@
 
 // MeshLib
 #include "Mesh.h"
+#include "MeshArena.h"
 #include "Node.h"
 #include "Elements/Element.h"
 
@@ -31,151 +38,190 @@ MeshCoarsener::MeshCoarsener(Mesh const*const mesh) :
 MeshCoarsener::~MeshCoarsener()
 {}
 
-Mesh* MeshCoarsener::operator()(double min_distance)
+void MeshCoarsener::getNodePositions(std::vector<Node*> const& nodes, std::vector<unsigned> &positions)
 {
-	// copy mesh nodes, reset mesh node ids and
-	// store original mesh node ids in a vector
-	std::vector<Node*> const& orig_nodes(_orig_mesh->getNodes());
-	const size_t n_nodes(orig_nodes.size());
-	std::vector<Node*> nodes(n_nodes);
-	std::map<size_t,size_t> orig_ids_map;
-	for (size_t k(0); k < n_nodes; k++) {
-		nodes[k] = new Node(orig_nodes[k]->getCoords(), k);
-		orig_ids_map.insert(std::pair<size_t, size_t>(orig_nodes[k]->getID(), k));
+	const std::size_t n_nodes(nodes.size());
+	std::size_t max_id(0);
+	for (std::size_t k(0); k < n_nodes; k++) {
+		max_id = std::max(max_id, nodes[k]->getID());
 	}
+	positions.assign(n_nodes > 0 ? max_id + 1 : 0, std::numeric_limits<unsigned>::max());
+	for (std::size_t k(0); k < n_nodes; k++) {
+		positions[nodes[k]->getID()] = static_cast<unsigned>(k);
+	}
+}
 
-	// init grid
-	GeoLib::Grid<Node>* grid(new GeoLib::Grid<Node>(nodes, 64));
-
-	// init id map
-	std::vector<size_t> id_map(n_nodes);
-	for (size_t k(0); k < n_nodes; k++) {
-		id_map[k] = nodes[k]->getID();
+std::size_t MeshCoarsener::mapCloseNodes(std::vector<Node*> const& nodes, double min_distance,
+	std::vector<unsigned> &id_map)
+{
+	const std::size_t n_nodes(nodes.size());
+	if (n_nodes == 0) {
+		id_map.clear();
+		return 0;
 	}
 
+	std::vector<unsigned> orig_ids_map;
+	getNodePositions(nodes, orig_ids_map);
+
+	// init grid
+	const GeoLib::Grid<Node> grid(nodes, 64);
 	const double sqr_min_distance (min_distance * min_distance);
 
-	// do the work - search nearest nodes
-	for (size_t k(0); k < n_nodes; k++) {
+	// do the work - search nearest nodes: the grid cells are processed in
+	// parallel, close nodes are merged into the same subset
+	BaseLib::ConcurrentUnionFind node_sets(n_nodes);
+	const std::size_t n_cells(grid.getNGridCells());
+#ifdef _OPENMP
+	OPENMP_LOOP_TYPE c;
+	#pragma omp parallel for
+#else
+	unsigned c(0);
+#endif
+	for (c = 0; c < n_cells; c++) {
+		std::vector<Node*> const& cell_nodes(grid.getPointsInGridCell(c));
+		const std::size_t n_cell_nodes(cell_nodes.size());
 		std::vector<std::vector<Node*> const*> node_vecs_intersecting_cube;
-		Node const*const node(nodes[k]);
-		const size_t node_id_k(node->getID());
-		grid->getVecsOfGridCellsIntersectingCube(node->getCoords(), min_distance, node_vecs_intersecting_cube);
-
-		const size_t n_vecs (node_vecs_intersecting_cube.size());
-		for (size_t i(0); i<n_vecs; i++) {
-			std::vector<Node*> const* node_vec (node_vecs_intersecting_cube[i]);
-			const size_t n_loc_nodes (node_vec->size());
-			for (size_t j(0); j<n_loc_nodes; j++) {
-				Node const*const test_node((*node_vec)[j]);
-				const size_t test_node_id (test_node->getID());
-				if (node_id_k < test_node_id) {
-					if (MathLib::sqrDist(node->getCoords(), test_node->getCoords()) < sqr_min_distance) {
+		for (std::size_t k(0); k < n_cell_nodes; k++) {
+			Node const*const node(cell_nodes[k]);
+			const unsigned node_idx(orig_ids_map[node->getID()]);
+			node_vecs_intersecting_cube.clear();
+			grid.getVecsOfGridCellsIntersectingCube(node->getCoords(), min_distance, node_vecs_intersecting_cube);
+
+			const std::size_t n_vecs (node_vecs_intersecting_cube.size());
+			for (std::size_t i(0); i<n_vecs; i++) {
+				std::vector<Node*> const* node_vec (node_vecs_intersecting_cube[i]);
+				const std::size_t n_loc_nodes (node_vec->size());
+				for (std::size_t j(0); j<n_loc_nodes; j++) {
+					Node const*const test_node((*node_vec)[j]);
+					const unsigned test_node_idx (orig_ids_map[test_node->getID()]);
+					if (node_idx < test_node_idx
+						&& MathLib::sqrDist(node->getCoords(), test_node->getCoords()) < sqr_min_distance) {
 						// two nodes are very close to each other
-						id_map[test_node_id] = node_id_k;
-#ifndef NDEBUG
-						INFO ("distance of nodes with ids %d and %d is %f", node_id_k, test_node_id, sqrt(MathLib::sqrDist(node->getCoords(), test_node->getCoords())));
-#endif
+						node_sets.unite(node_idx, test_node_idx);
 					}
 				}
 			}
 		}
 	}
 
-	// apply changes to id_map
-	for (size_t k(0), cnt(0); k < n_nodes; k++) {
-		if (id_map[k] != k) {
-			if (id_map[k] != id_map[id_map[k]]) {
-				id_map[k] = id_map[id_map[k]];
-			}
-		} else {
+	// every subset is replaced by its representative (the node with the
+	// smallest index), the representatives are numbered consecutively
+	node_sets.getRepresentatives(id_map);
+	std::size_t cnt(0);
+	for (std::size_t k(0); k < n_nodes; k++) {
+		if (id_map[k] == k) {
 			id_map[k] = cnt++;
-		}
-	}
-
-	// delete unused nodes
-	for (size_t k(0), cnt(0); k < n_nodes; k++) {
-		if (id_map[k] != cnt) {
-			delete nodes[k];
-			nodes[k] = NULL;
 		} else {
-			cnt++;
+			// the representative is smaller than k, hence it is already renumbered
+			id_map[k] = id_map[id_map[k]];
 		}
 	}
+	return cnt;
+}
 
-	// remove NULL-ptr from node vector
-	for (std::vector<Node*>::iterator it(nodes.begin()); it != nodes.end(); ) {
-		if (*it == NULL) {
-			it = nodes.erase (it);
-		} else {
-			it++;
+Mesh* MeshCoarsener::operator()(double min_distance)
+{
+	// map the original mesh node ids to the positions within the node vector
+	std::vector<Node*> const& orig_nodes(_orig_mesh->getNodes());
+	const std::size_t n_nodes(orig_nodes.size());
+	std::vector<unsigned> orig_ids_map;
+	getNodePositions(orig_nodes, orig_ids_map);
+	const unsigned no_idx(std::numeric_limits<unsigned>::max());
+
+	std::vector<unsigned> id_map;
+	mapCloseNodes(orig_nodes, min_distance, id_map);
+
+	MeshArena* arena(new MeshArena);
+	std::vector<Node*> nodes;
+	for (std::size_t k(0); k < n_nodes; k++) {
+		if (id_map[k] == nodes.size()) {
+			double const*const coords(orig_nodes[k]->getCoords());
+			nodes.push_back(arena->createNode(coords[0], coords[1], coords[2], id_map[k]));
 		}
 	}
+	INFO ("MeshCoarsener: %d of %d nodes remain", static_cast<int>(nodes.size()), static_cast<int>(n_nodes));
 
-	// reset mesh node ids
-	const size_t new_n_nodes(nodes.size());
-	for (size_t k(0); k < new_n_nodes; k++) {
-		nodes[k]->setID(k);
-	}
-
-	// copy mesh elements, reset the node pointers
+	// map the nodes of the elements and check if nodes of the element are collapsed
 	std::vector<Element*> const& orig_elements(_orig_mesh->getElements());
-	const size_t n_elements(orig_elements.size());
-	std::vector<Element*> elements(n_elements);
-	std::vector<size_t> mapped_node_ids_of_element;
-	for (size_t k(0), cnt(0); k < n_elements; k++) {
-		Element const*const kth_orig_elem(orig_elements[k]);
-		const size_t n_nodes_element (kth_orig_elem->getNNodes());
-		mapped_node_ids_of_element.clear();
-		for (size_t i(0); i<n_nodes_element; i++) {
-			const size_t orig_node_id (kth_orig_elem->getNode(i)->getID());
-			std::map<size_t, size_t>::const_iterator it(orig_ids_map.find(orig_node_id));
-			if (it == orig_ids_map.end()) {
-				std::cerr << "[MeshCoarsener::operator()] could not found mesh node id" << std::endl;
+	const std::size_t n_elements(orig_elements.size());
+	std::vector<unsigned> elem_node_ptr(n_elements + 1, 0);
+	for (std::size_t k(0); k < n_elements; k++) {
+		elem_node_ptr[k + 1] = elem_node_ptr[k] + orig_elements[k]->getNNodes();
+	}
+	std::vector<unsigned> elem_nodes(elem_node_ptr[n_elements]);
+	std::vector<char> collapsed(n_elements, 0);
+	std::vector<char> node_not_found(n_elements, 0);
+	std::size_t n_not_found(0);
+#ifdef _OPENMP
+	OPENMP_LOOP_TYPE e;
+	#pragma omp parallel for reduction(+:n_not_found)
+#else
+	unsigned e(0);
+#endif
+	for (e = 0; e < n_elements; e++) {
+		Element const*const orig_elem(orig_elements[e]);
+		const unsigned n_nodes_element (orig_elem->getNNodes());
+		unsigned *const mapped_node_ids_of_element(&elem_nodes[elem_node_ptr[e]]);
+		for (unsigned i(0); i<n_nodes_element; i++) {
+			const std::size_t orig_node_id (orig_elem->getNode(i)->getID());
+			const unsigned idx(orig_node_id < orig_ids_map.size() ? orig_ids_map[orig_node_id] : no_idx);
+			if (idx == no_idx) {
+				n_not_found++;
+				node_not_found[e] = 1;
+				mapped_node_ids_of_element[i] = 0;
 			} else {
-				mapped_node_ids_of_element.push_back(id_map[it->second]);
+				mapped_node_ids_of_element[i] = id_map[idx];
 			}
 		}
+		if (node_not_found[e])
+			continue;
 
-		// check if nodes of the element are collapsed
-		bool not_collapsed (true);
-		for (size_t i(0); i<n_nodes_element-1 && not_collapsed; i++) {
-			const size_t id_i(mapped_node_ids_of_element[i]);
-			for (size_t j(i+1); j<n_nodes_element && not_collapsed; j++) {
-				if (id_i == mapped_node_ids_of_element[j]) {
-					not_collapsed = false;
+		for (unsigned i(0); i+1<n_nodes_element && !collapsed[e]; i++) {
+			for (unsigned j(i+1); j<n_nodes_element && !collapsed[e]; j++) {
+				if (mapped_node_ids_of_element[i] == mapped_node_ids_of_element[j]) {
+					collapsed[e] = 1;
 				}
 			}
 		}
-		if (! not_collapsed) {
-			Element* elem (kth_orig_elem->clone());
-			if (elem != NULL) {
-				for (size_t i(0); i<n_nodes_element; i++) {
-					elem->setNode(i, nodes[mapped_node_ids_of_element[i]]);
+	}
+	if (n_not_found > 0) {
+		ERR("MeshCoarsener::operator(): could not find %d mesh node ids, the elements referencing them are skipped",
+			static_cast<int>(n_not_found));
+	}
+
+	// create the elements, collapsed elements are revised
+	std::vector<Element*> elements;
+	elements.reserve(n_elements);
+	std::vector<Node*> elem_node_ptrs;
+	for (std::size_t k(0); k < n_elements; k++) {
+		if (node_not_found[k])
+			continue;
+		Element const*const kth_orig_elem(orig_elements[k]);
+		const unsigned n_nodes_element (kth_orig_elem->getNNodes());
+		elem_node_ptrs.resize(n_nodes_element);
+		for (unsigned i(0); i<n_nodes_element; i++) {
+			elem_node_ptrs[i] = nodes[elem_nodes[elem_node_ptr[k] + i]];
+		}
+
+		Element* elem(NULL);
+		if (collapsed[k]) {
+			Element* tmp_elem (kth_orig_elem->clone());
+			if (tmp_elem != NULL) {
+				for (unsigned i(0); i<n_nodes_element; i++) {
+					tmp_elem->setNode(i, elem_node_ptrs[i]);
 				}
-				Element* revised_elem(elem->reviseElement());
-				elements[cnt] = revised_elem;
-				delete elem;
-				cnt++;
+				elem = tmp_elem->reviseElement();
+				delete tmp_elem;
 			}
 		} else {
-			elements[cnt] = kth_orig_elem->clone();
-			for (size_t i(0); i<n_nodes_element; i++) {
-				elements[cnt]->setNode(i, nodes[mapped_node_ids_of_element[i]]);
-			}
-			cnt++;
+			elem = arena->createElement(kth_orig_elem->getType(), &elem_node_ptrs[0], n_nodes_element, kth_orig_elem->getValue());
 		}
-	}
-
-	for (std::vector<Element*>::iterator it(elements.begin()); it != elements.end(); ) {
-		if (*it == NULL) {
-			it = elements.erase(it);
-		} else {
-			it++;
+		if (elem != NULL) {
+			elements.push_back(elem);
 		}
 	}
 
-	return new Mesh (_orig_mesh->getName() + "Collapsed", nodes, elements);
+	return new Mesh (_orig_mesh->getName() + "Collapsed", nodes, elements, arena);
 }
 
 } // end namespace MeshLib
@@ -18,6 +18,7 @@
 // forward declaration
 namespace MeshLib {
 class Mesh;
+class Node;
 }
 
 namespace MeshLib {
@@ -25,6 +26,10 @@ namespace MeshLib {
 /**
  * The class MeshCoarsener merges mesh nodes that have a smaller
  * distance than a (user) given minimal distance.
+ *
+ * The merging is transitive: if node a is close to node b and node b
+ * is close to node c, all three nodes are merged into the one with the
+ * smallest index, even if a and c are not close to each other.
  */
 class MeshCoarsener {
 public:
@@ -41,11 +46,34 @@ public:
 
 	/**
 	 * create new mesh and apply the coarsening process to the mesh
-	 * @param min_distance
+	 * @param min_distance nodes closer to each other than min_distance are merged
+	 * @return the new mesh, its nodes and elements are allocated in a MeshArena
 	 */
 	Mesh* operator() (double min_distance);
 
+	/**
+	 * Computes which nodes are merged: nodes closer to each other than
+	 * min_distance are merged (transitively) into the node with the smallest
+	 * index. The search runs in parallel over the cells of a GeoLib::Grid.
+	 * @param nodes the nodes, the ids of the nodes have to be unique
+	 * @param min_distance the distance below which nodes are merged
+	 * @param id_map (output) id_map[k] is the index of the merged node nodes[k]
+	 * belongs to, the merged nodes are numbered in the order of their first node
+	 * @return the number of merged nodes
+	 */
+	static std::size_t mapCloseNodes(std::vector<Node*> const& nodes, double min_distance,
+		std::vector<unsigned> &id_map);
+
 private:
+	/**
+	 * Computes the positions of the nodes within the vector from the node ids.
+	 * @param nodes the nodes
+	 * @param positions (output) positions[nodes[k]->getID()] == k, positions
+	 * of unused ids are std::numeric_limits<unsigned>::max()
+	 */
+	static void getNodePositions(std::vector<Node*> const& nodes, std::vector<unsigned> &positions);
+
+
 	Mesh const*const _orig_mesh;
 };
 
@@ -15,34 +15,43 @@ MeshQualityArea::MeshQualityArea(Mesh const* const mesh)
 
 void MeshQualityArea::check()
 {
-	// get all elements of mesh
-	const std::vector<MeshLib::Element*> &elements(_mesh->getElements());
+	// get the connectivity of all elements of mesh
+	MeshTopology const& topology(_mesh->getTopology());
+	double pnts[MeshTopology::MAX_ELEMENT_NODES][3];
+	double const* face_pnts[4];
 
-	const size_t nElems(elements.size());
+	const size_t nElems(topology.getNElements());
 	for (size_t k(0); k < nElems; k++) 
 	{
 		double area(std::numeric_limits<double>::max());
-		const Element* elem (elements[k]);
+		const ElementView elem (topology.getElement(k));
 
-		if (elem->getDimension() == 1)
+		if (elem.getDimension() == 1)
 		{
 			_mesh_quality_measure[k] = -1.0;
 			continue;
 		}
-		else if (elem->getDimension() == 2)
+		getNodeCoordinates(elem, pnts);
+		if (elem.getDimension() == 2)
 		{		
-			area = elem->getContent();
-			if (area < sqrt(fabs(std::numeric_limits<double>::min()))) errorMsg(elem, k);
+			const unsigned nNodes (elem.getNNodes());
+			for (unsigned j = 0; j < nNodes; j++)
+				face_pnts[j] = pnts[j];
+			area = calcFaceArea(face_pnts, nNodes);
+			if (area < sqrt(fabs(std::numeric_limits<double>::min()))) errorMsg(elem);
 		} 
 		else {
-			size_t nFaces(elem->getNFaces());
+			const unsigned nFaces(elem.getNFaces());
 
-			for (size_t i = 0; i < nFaces; i++) 
+			for (unsigned i = 0; i < nFaces; i++) 
 			{
-				const double sub_area (elem->getFace(i)->getContent());
+				const unsigned nFaceNodes (elem.getNFaceNodes(i));
+				for (unsigned j = 0; j < nFaceNodes; j++)
+					face_pnts[j] = pnts[MeshTopology::getFaceNode(elem.getType(), i, j)];
+				const double sub_area (calcFaceArea(face_pnts, nFaceNodes));
 
 				if (sub_area < sqrt(fabs(std::numeric_limits<double>::min())))
-					errorMsg(elem, k);
+					errorMsg(elem);
 				if (sub_area < area) area = sub_area;
 			}
 		}
@@ -53,4 +62,12 @@ void MeshQualityArea::check()
 	}
 }
 
+double MeshQualityArea::calcFaceArea(double const* const* face_pnts, unsigned nFaceNodes) const
+{
+	double area (MathLib::calcTriangleArea(face_pnts[0], face_pnts[1], face_pnts[2]));
+	if (nFaceNodes == 4)
+		area += MathLib::calcTriangleArea(face_pnts[2], face_pnts[3], face_pnts[0]);
+	return area;
+}
+
 } // end namespace MeshLib
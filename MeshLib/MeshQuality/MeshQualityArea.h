@@ -18,6 +18,10 @@ public:
 	virtual ~MeshQualityArea() {}
 
 	virtual void check ();
+
+private:
+	/// area of a triangle or a quadrilateral given by the coordinates of its nodes
+	double calcFaceArea (double const* const* face_pnts, unsigned nFaceNodes) const;
 };
 }
 
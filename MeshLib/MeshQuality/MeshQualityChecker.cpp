@@ -34,13 +34,26 @@ BASELIB::Histogram<double> MeshQualityChecker::getHistogram (size_t nclasses) co
 	return BASELIB::Histogram<double>(getMeshQuality(), nclasses, true);
 }
 
-void MeshQualityChecker::errorMsg (const Element* elem, size_t idx) const
+void MeshQualityChecker::errorMsg (ElementView const& elem) const
 {
 	std::cout << "Error in MeshQualityChecker::check() - "
 			  << "Calculated value of element is below double precision minimum." << std::endl;
-	std::cout << "Points of " << MshElemType2String(elem->getType()) << "-Element " << idx << ": " << std::endl;
-	for (size_t i(0); i < elem->getNNodes(); i++)
-		std::cout << "\t Node " << i << " " << GeoLib::Point((elem->getNode(i))->getCoords()) << std::endl;
+	std::cout << "Points of " << MshElemType2String(elem.getType()) << "-Element " << elem.getIndex() << ": " << std::endl;
+	double pnts[MeshTopology::MAX_ELEMENT_NODES][3];
+	getNodeCoordinates(elem, pnts);
+	for (size_t i(0); i < elem.getNNodes(); i++)
+		std::cout << "\t Node " << i << " " << GeoLib::Point(pnts[i]) << std::endl;
+}
+
+void MeshQualityChecker::getNodeCoordinates (ElementView const& elem, double pnts[][3]) const
+{
+	const unsigned nNodes (elem.getNNodes());
+	for (unsigned i(0); i < nNodes; i++)
+	{
+		double const*const coords (_mesh->getNode(elem.getNodeIndex(i))->getCoords());
+		for (unsigned k(0); k < 3; k++)
+			pnts[i][k] = coords[k];
+	}
 }
 
 std::vector<double> const&
@@ -20,6 +20,7 @@
 // MSH
 #include "Mesh.h"
 #include "Elements/Element.h"
+#include "ElementView.h"
 
 namespace MeshLib
 {
@@ -37,7 +38,15 @@ public:
 	virtual BASELIB::Histogram<double> getHistogram (size_t nclasses = 0) const;
 
 protected:
-	void errorMsg (const Element* elem, size_t idx) const;
+	void errorMsg (ElementView const& elem) const;
+
+	/**
+	 * copies the coordinates of the nodes of the element from the
+	 * structure of arrays store of the mesh
+	 * @param elem the element
+	 * @param pnts (output) the coordinates of the element nodes
+	 */
+	void getNodeCoordinates (ElementView const& elem, double pnts[][3]) const;
 
 	double _min;
 	double _max;
@@ -10,7 +10,6 @@
  */
 
 #include "MeshQualityEquiAngleSkew.h"
-#include "Node.h"
 
 #include "MathTools.h"
 
@@ -35,32 +34,34 @@ MeshQualityEquiAngleSkew::~MeshQualityEquiAngleSkew()
 
 void MeshQualityEquiAngleSkew::check ()
 {
-	// get all elements of mesh
-	const std::vector<MeshLib::Element*>& elements(_mesh->getElements());
+	// get the connectivity of all elements of mesh
+	MeshTopology const& topology(_mesh->getTopology());
 	const size_t nElements (_mesh->getNElements());
+	double pnts[MeshTopology::MAX_ELEMENT_NODES][3];
 
 	for (size_t k(0); k < nElements; k++)
 	{
-		const Element* elem (elements[k]);
-		switch (elem->getType())
+		const ElementView elem (topology.getElement(k));
+		getNodeCoordinates(elem, pnts);
+		switch (elem.getType())
 		{
 		case MshElemType::EDGE:
 			_mesh_quality_measure[k] = -1.0;
 			break;
 		case MshElemType::TRIANGLE:
-			_mesh_quality_measure[k] = checkTriangle (elem);
+			_mesh_quality_measure[k] = checkTriangle (pnts);
 			break;
 		case MshElemType::QUAD:
-			_mesh_quality_measure[k] = checkQuad (elem);
+			_mesh_quality_measure[k] = checkQuad (pnts);
 			break;
 		case MshElemType::TETRAHEDRON:
-			_mesh_quality_measure[k] = checkTetrahedron (elem);
+			_mesh_quality_measure[k] = checkTetrahedron (pnts);
 			break;
 		case MshElemType::HEXAHEDRON:
-			_mesh_quality_measure[k] = checkHexahedron (elem);
+			_mesh_quality_measure[k] = checkHexahedron (pnts);
 			break;
 		case MshElemType::PRISM:
-			_mesh_quality_measure[k] = checkPrism (elem);
+			_mesh_quality_measure[k] = checkPrism (pnts);
 			break;
 		default:
 			break;
@@ -68,11 +69,11 @@ void MeshQualityEquiAngleSkew::check ()
 	}
 }
 
-double MeshQualityEquiAngleSkew::checkTriangle (Element const* const elem) const
+double MeshQualityEquiAngleSkew::checkTriangle (double const pnts[][3]) const
 {
-	double const* const node0 (elem->getNode(0)->getCoords());
-	double const* const node1 (elem->getNode(1)->getCoords());
-	double const* const node2 (elem->getNode(2)->getCoords());
+	double const* const node0 (pnts[0]);
+	double const* const node1 (pnts[1]);
+	double const* const node2 (pnts[2]);
 
 	double min_angle (M_PI_2), max_angle (0.0);
 	getMinMaxAngleFromTriangle (node0, node1, node2, min_angle, max_angle);
@@ -82,12 +83,12 @@ double MeshQualityEquiAngleSkew::checkTriangle (Element const* const elem) const
 	                (M_PI_THIRD - min_angle) / (M_PI_THIRD));
 }
 
-double MeshQualityEquiAngleSkew::checkQuad (Element const* const elem) const
+double MeshQualityEquiAngleSkew::checkQuad (double const pnts[][3]) const
 {
-	double const* const node0 (elem->getNode(0)->getCoords());
-	double const* const node1 (elem->getNode(1)->getCoords());
-	double const* const node2 (elem->getNode(2)->getCoords());
-	double const* const node3 (elem->getNode(3)->getCoords());
+	double const* const node0 (pnts[0]);
+	double const* const node1 (pnts[1]);
+	double const* const node2 (pnts[2]);
+	double const* const node3 (pnts[3]);
 
 	double min_angle (TWICE_M_PI);
 	double max_angle (0.0);
@@ -98,12 +99,12 @@ double MeshQualityEquiAngleSkew::checkQuad (Element const* const elem) const
 	       std::max((max_angle - M_PI_2) / (M_PI - M_PI_2), (M_PI_2 - min_angle) / (M_PI_2));
 }
 
-double MeshQualityEquiAngleSkew::checkTetrahedron (Element const* const elem) const
+double MeshQualityEquiAngleSkew::checkTetrahedron (double const pnts[][3]) const
 {
-	double const* const node0 (elem->getNode(0)->getCoords());
-	double const* const node1 (elem->getNode(1)->getCoords());
-	double const* const node2 (elem->getNode(2)->getCoords());
-	double const* const node3 (elem->getNode(3)->getCoords());
+	double const* const node0 (pnts[0]);
+	double const* const node1 (pnts[1]);
+	double const* const node2 (pnts[2]);
+	double const* const node3 (pnts[3]);
 
 	double min_angle (M_PI_2);
 	double max_angle (0.0);
@@ -121,16 +122,16 @@ double MeshQualityEquiAngleSkew::checkTetrahedron (Element const* const elem) co
 	                      (M_PI_THIRD - min_angle) / (M_PI_THIRD));
 }
 
-double MeshQualityEquiAngleSkew::checkHexahedron (Element const* const elem) const
+double MeshQualityEquiAngleSkew::checkHexahedron (double const pnts[][3]) const
 {
-	double const* const node0 (elem->getNode(0)->getCoords());
-	double const* const node1 (elem->getNode(1)->getCoords());
-	double const* const node2 (elem->getNode(2)->getCoords());
-	double const* const node3 (elem->getNode(3)->getCoords());
-	double const* const node4 (elem->getNode(4)->getCoords());
-	double const* const node5 (elem->getNode(5)->getCoords());
-	double const* const node6 (elem->getNode(6)->getCoords());
-	double const* const node7 (elem->getNode(7)->getCoords());
+	double const* const node0 (pnts[0]);
+	double const* const node1 (pnts[1]);
+	double const* const node2 (pnts[2]);
+	double const* const node3 (pnts[3]);
+	double const* const node4 (pnts[4]);
+	double const* const node5 (pnts[5]);
+	double const* const node6 (pnts[6]);
+	double const* const node7 (pnts[7]);
 
 	double min_angle (2 * M_PI);
 	double max_angle (0.0);
@@ -152,14 +153,14 @@ double MeshQualityEquiAngleSkew::checkHexahedron (Element const* const elem) con
 	       std::max((max_angle - M_PI_2) / (M_PI - M_PI_2), (M_PI_2 - min_angle) / (M_PI_2));
 }
 
-double MeshQualityEquiAngleSkew::checkPrism (Element const* const elem) const
+double MeshQualityEquiAngleSkew::checkPrism (double const pnts[][3]) const
 {
-	double const* const node0 (elem->getNode(0)->getCoords());
-	double const* const node1 (elem->getNode(1)->getCoords());
-	double const* const node2 (elem->getNode(2)->getCoords());
-	double const* const node3 (elem->getNode(3)->getCoords());
-	double const* const node4 (elem->getNode(4)->getCoords());
-	double const* const node5 (elem->getNode(5)->getCoords());
+	double const* const node0 (pnts[0]);
+	double const* const node1 (pnts[1]);
+	double const* const node2 (pnts[2]);
+	double const* const node3 (pnts[3]);
+	double const* const node4 (pnts[4]);
+	double const* const node5 (pnts[5]);
 
 	double min_angle_tri (2 * M_PI);
 	double max_angle_tri (0.0);
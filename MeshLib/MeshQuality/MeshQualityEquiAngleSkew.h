@@ -25,11 +25,11 @@ public:
 	virtual void check ();
 
 private:
-	double checkTriangle(Element const* const elem) const;
-	double checkQuad(Element const* const elem) const;
-	double checkTetrahedron(Element const* const elem) const;
-	double checkHexahedron(Element const* const elem) const;
-	double checkPrism (Element const* const elem) const;
+	double checkTriangle(double const pnts[][3]) const;
+	double checkQuad(double const pnts[][3]) const;
+	double checkTetrahedron(double const pnts[][3]) const;
+	double checkHexahedron(double const pnts[][3]) const;
+	double checkPrism (double const pnts[][3]) const;
 	void getMinMaxAngleFromQuad(double const* const n0,
 	                            double const* const n1, double const* const n2,
 	                            double const* const n3, double &min_angle,
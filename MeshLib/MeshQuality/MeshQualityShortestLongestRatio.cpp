@@ -10,7 +10,6 @@
  */
 
 #include "MeshQualityShortestLongestRatio.h"
-#include "Node.h"
 #include "MathTools.h"
 
 namespace MeshLib
@@ -23,54 +22,50 @@ MeshQualityShortestLongestRatio::MeshQualityShortestLongestRatio(
 
 void MeshQualityShortestLongestRatio::check()
 {
-	// get all elements of mesh
-	const std::vector<MeshLib::Element*>& elements(_mesh->getElements());
+	// get the connectivity of all elements of mesh
+	MeshTopology const& topology(_mesh->getTopology());
 	const size_t nElements (_mesh->getNElements());
+	double pnts[MeshTopology::MAX_ELEMENT_NODES][3];
 	for (size_t k(0); k < nElements; k++)
 	{
-		const Element* elem (elements[k]);
-		switch (elem->getType())
+		const ElementView elem (topology.getElement(k));
+		getNodeCoordinates(elem, pnts);
+		switch (elem.getType())
 		{
 		case MshElemType::EDGE:
 			_mesh_quality_measure[k] = 1.0;
 			break;
 		case MshElemType::TRIANGLE: {
-			_mesh_quality_measure[k] = checkTriangle(elem->getNode(0), elem->getNode(1), elem->getNode(2));
+			_mesh_quality_measure[k] = checkTriangle(pnts[0], pnts[1], pnts[2]);
 			break;
 		}
 		case MshElemType::QUAD: {
-			_mesh_quality_measure[k] = checkQuad(elem->getNode(0), elem->getNode(1), elem->getNode(2), elem->getNode(3));
+			_mesh_quality_measure[k] = checkQuad(pnts[0], pnts[1], pnts[2], pnts[3]);
 			break;
 		}
 		case MshElemType::TETRAHEDRON: {
-			_mesh_quality_measure[k] = checkTetrahedron(elem->getNode(0), elem->getNode(1), elem->getNode(2), elem->getNode(3));
+			_mesh_quality_measure[k] = checkTetrahedron(pnts[0], pnts[1], pnts[2], pnts[3]);
 			break;
 		}
 		case MshElemType::PRISM: {
-			std::vector<const GeoLib::Point*> pnts;
-			for (size_t j(0); j < 6; j++)
-				pnts.push_back(elem->getNode(j));
 			_mesh_quality_measure[k] = checkPrism(pnts);
 			break;
 		}
 		case MshElemType::HEXAHEDRON: {
-			std::vector<const GeoLib::Point*> pnts;
-			for (size_t j(0); j < 8; j++)
-				pnts.push_back(elem->getNode(j));
 			_mesh_quality_measure[k] = checkHexahedron(pnts);
 			break;
 		}
 		default:
 			std::cout << "MeshQualityShortestLongestRatio::check () check for element type "
-			          << MshElemType2String(elem->getType())
+			          << MshElemType2String(elem.getType())
 			          << " not implemented" << std::endl;
 		}
 	}
 }
 
-double MeshQualityShortestLongestRatio::checkTriangle (GeoLib::Point const* const a,
-                                                       GeoLib::Point const* const b,
-                                                       GeoLib::Point const* const c) const
+double MeshQualityShortestLongestRatio::checkTriangle (double const* const a,
+                                                       double const* const b,
+                                                       double const* const c) const
 {
 	double len0 (sqrt(MathLib::sqrDist (b,a)));
 	double len1 (sqrt(MathLib::sqrDist (b,c)));
@@ -102,10 +97,10 @@ double MeshQualityShortestLongestRatio::checkTriangle (GeoLib::Point const* cons
 	}
 }
 
-double MeshQualityShortestLongestRatio::checkQuad (GeoLib::Point const* const a,
-                                                   GeoLib::Point const* const b,
-                                                   GeoLib::Point const* const c,
-                                                   GeoLib::Point const* const d) const
+double MeshQualityShortestLongestRatio::checkQuad (double const* const a,
+                                                   double const* const b,
+                                                   double const* const c,
+                                                   double const* const d) const
 {
 	double sqr_lengths[4] = {MathLib::sqrDist (b,a),
 		                 MathLib::sqrDist (c,b),
@@ -121,10 +116,10 @@ double MeshQualityShortestLongestRatio::checkQuad (GeoLib::Point const* const a,
 	return sqrt(sqr_lengths[0]) / sqrt(sqr_lengths[3]);
 }
 
-double MeshQualityShortestLongestRatio::checkTetrahedron (GeoLib::Point const* const a,
-                                                          GeoLib::Point const* const b,
-                                                          GeoLib::Point const* const c,
-                                                          GeoLib::Point const* const d) const
+double MeshQualityShortestLongestRatio::checkTetrahedron (double const* const a,
+                                                          double const* const b,
+                                                          double const* const c,
+                                                          double const* const d) const
 {
 	double sqr_lengths[6] = {MathLib::sqrDist (b,a), MathLib::sqrDist (c,b),
 		                 MathLib::sqrDist (c,a), MathLib::sqrDist (a,d),
@@ -139,7 +134,7 @@ double MeshQualityShortestLongestRatio::checkTetrahedron (GeoLib::Point const* c
 	return sqrt(sqr_lengths[0]) / sqrt(sqr_lengths[5]);
 }
 
-double MeshQualityShortestLongestRatio::checkPrism (std::vector<const GeoLib::Point*> const & pnts) const
+double MeshQualityShortestLongestRatio::checkPrism (double const pnts[][3]) const
 {
 	double sqr_lengths[9] = {MathLib::sqrDist (pnts[0],pnts[1]),
 		                 MathLib::sqrDist (pnts[1],pnts[2]),
@@ -160,7 +155,7 @@ double MeshQualityShortestLongestRatio::checkPrism (std::vector<const GeoLib::Po
 	return sqrt(sqr_lengths[0]) / sqrt(sqr_lengths[8]);
 }
 
-double MeshQualityShortestLongestRatio::checkHexahedron (std::vector<const GeoLib::Point*> const & pnts)
+double MeshQualityShortestLongestRatio::checkHexahedron (double const pnts[][3])
 const
 {
 	double sqr_lengths[12] = {MathLib::sqrDist (pnts[0],pnts[1]),
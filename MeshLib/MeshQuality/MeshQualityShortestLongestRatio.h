@@ -13,7 +13,6 @@
 #define MESHQUALITYSHORTESTLONGESTRATIO_H_
 
 #include "MeshQualityChecker.h"
-#include "Point.h"
 
 namespace MeshLib
 {
@@ -26,19 +25,19 @@ public:
 	virtual void check ();
 
 private:
-	double checkTriangle (GeoLib::Point const* const a,
-	                      GeoLib::Point const* const b,
-	                      GeoLib::Point const* const c) const;
-	double checkQuad (GeoLib::Point const* const a,
-	                  GeoLib::Point const* const b,
-	                  GeoLib::Point const* const c,
-	                  GeoLib::Point const* const d) const;
-	double checkTetrahedron (GeoLib::Point const* const a,
-	                         GeoLib::Point const* const b,
-	                         GeoLib::Point const* const c,
-	                         GeoLib::Point const* const d) const;
-	double checkPrism (std::vector<const GeoLib::Point*> const & pnts) const;
-	double checkHexahedron (std::vector<const GeoLib::Point*> const & pnts) const;
+	double checkTriangle (double const* const a,
+	                      double const* const b,
+	                      double const* const c) const;
+	double checkQuad (double const* const a,
+	                  double const* const b,
+	                  double const* const c,
+	                  double const* const d) const;
+	double checkTetrahedron (double const* const a,
+	                         double const* const b,
+	                         double const* const c,
+	                         double const* const d) const;
+	double checkPrism (double const pnts[][3]) const;
+	double checkHexahedron (double const pnts[][3]) const;
 };
 }
 
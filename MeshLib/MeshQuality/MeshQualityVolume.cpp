@@ -23,29 +23,27 @@ MeshQualityVolume::MeshQualityVolume(Mesh const* const mesh) :
 
 void MeshQualityVolume::check()
 {
-	// get all elements of mesh
+	// get all elements of mesh, the volume is cached in the Element objects
 	const std::vector<MeshLib::Element*>& elements(_mesh->getElements());
+	MeshTopology const& topology(_mesh->getTopology());
 
 	size_t error_count(0);
 	size_t nElements (_mesh->getNElements());
 
 	for (size_t k(0); k < nElements; k++)
 	{
-		const Element* elem (elements[k]);
-		MshElemType::type elem_type (elem->getType());
-		if (elem_type == MshElemType::EDGE
-		    || elem_type == MshElemType::TRIANGLE
-		    || elem_type == MshElemType::QUAD)
+		const ElementView elem (topology.getElement(k));
+		if (elem.getDimension() < 3)
 		{
             _mesh_quality_measure[k] = -1.0;
             continue;
         }
 
-        double volume (elem->getContent());
+        double volume (elements[k]->getContent());
         if (volume > _max)
             _max = volume;
         if (volume < sqrt(fabs(std::numeric_limits<double>::min()))) {
-			errorMsg(elem, k);
+			errorMsg(elem);
 			error_count++;
 		} else if (volume < _min)
             _min = volume;
@@ -0,0 +1,293 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file MeshRenumbering.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "MeshRenumbering.h"
+#include "Mesh.h"
+#include "MeshTopology.h"
+#include "Node.h"
+
+namespace MeshLib {
+
+/// number of bits of the cell index per direction of the space filling curves
+static const unsigned SFC_BITS(10);
+
+MeshRenumberingMethod convertStringToMeshRenumberingMethod(std::string const& str)
+{
+	if (str.compare("morton") == 0)
+		return MORTON_ORDER;
+	if (str.compare("rcm") == 0)
+		return RCM_ORDER;
+	return HILBERT_ORDER;
+}
+
+/** spreads the lower 10 bits of v such that two zero bits follow every bit */
+static unsigned spreadBits(unsigned v)
+{
+	v &= 0x3ff;
+	v = (v | (v << 16)) & 0x30000ff;
+	v = (v | (v << 8)) & 0x300f00f;
+	v = (v | (v << 4)) & 0x30c30c3;
+	v = (v | (v << 2)) & 0x9249249;
+	return v;
+}
+
+/** @return the position of the cell (ix, iy, iz) on the Morton curve */
+static unsigned getMortonKey(unsigned ix, unsigned iy, unsigned iz)
+{
+	return (spreadBits(ix) << 2) | (spreadBits(iy) << 1) | spreadBits(iz);
+}
+
+/**
+ * @return the position of the cell (ix, iy, iz) on the Hilbert curve. The
+ * coordinates are transformed into the transposed Hilbert index (J. Skilling,
+ * Programming the Hilbert curve, AIP Conf. Proc. 707, 2004), the bits of the
+ * transposed index are interleaved.
+ */
+static unsigned getHilbertKey(unsigned ix, unsigned iy, unsigned iz)
+{
+	unsigned X[3] = { ix, iy, iz };
+	const unsigned M(1u << (SFC_BITS - 1));
+	for (unsigned Q(M); Q > 1; Q >>= 1) {
+		const unsigned P(Q - 1);
+		for (unsigned i(0); i < 3; i++) {
+			if (X[i] & Q)
+				X[0] ^= P;
+			else {
+				const unsigned t((X[0] ^ X[i]) & P);
+				X[0] ^= t;
+				X[i] ^= t;
+			}
+		}
+	}
+	// Gray encoding
+	X[1] ^= X[0];
+	X[2] ^= X[1];
+	unsigned t(0);
+	for (unsigned Q(M); Q > 1; Q >>= 1)
+		if (X[2] & Q)
+			t ^= Q - 1;
+	for (unsigned i(0); i < 3; i++)
+		X[i] ^= t;
+
+	return (spreadBits(X[0]) << 2) | (spreadBits(X[1]) << 1) | spreadBits(X[2]);
+}
+
+void MeshRenumbering::getSpaceFillingCurveOrder(std::size_t n, double const* x, double const* y,
+	double const* z, bool hilbert, std::vector<unsigned> &order)
+{
+	order.resize(n);
+	if (n == 0)
+		return;
+
+	double const*const coords[3] = { x, y, z };
+	double min[3], scale[3];
+	const double n_cells(static_cast<double>(1u << SFC_BITS));
+	for (unsigned d(0); d < 3; d++) {
+		min[d] = *std::min_element(coords[d], coords[d] + n);
+		const double max(*std::max_element(coords[d], coords[d] + n));
+		scale[d] = (max > min[d]) ? n_cells / (max - min[d]) : 0.0;
+	}
+
+	std::vector<std::pair<unsigned, unsigned> > keys(n);
+#ifdef _OPENMP
+	OPENMP_LOOP_TYPE k;
+	#pragma omp parallel for
+#else
+	unsigned k(0);
+#endif
+	for (k = 0; k < n; k++) {
+		unsigned cell[3];
+		for (unsigned d(0); d < 3; d++)
+			cell[d] = std::min(static_cast<unsigned>((coords[d][k] - min[d]) * scale[d]), (1u << SFC_BITS) - 1);
+		keys[k].first = hilbert ? getHilbertKey(cell[0], cell[1], cell[2])
+			: getMortonKey(cell[0], cell[1], cell[2]);
+		keys[k].second = static_cast<unsigned>(k);
+	}
+	std::sort(keys.begin(), keys.end());
+	for (std::size_t j(0); j < n; j++)
+		order[j] = keys[j].second;
+}
+
+/**
+ * Breadth first search from vertex start. The vertices reached are appended
+ * to visited in the order of the search, level holds their distance to start
+ * (the other entries of level have to be std::numeric_limits<unsigned>::max()).
+ * @return the largest distance to start
+ */
+static unsigned breadthFirstSearch(std::vector<unsigned> const& ptr, std::vector<unsigned> const& adj,
+	unsigned start, std::vector<unsigned> &level, std::vector<unsigned> &visited)
+{
+	const unsigned no_level(std::numeric_limits<unsigned>::max());
+	const std::size_t first(visited.size());
+	level[start] = 0;
+	visited.push_back(start);
+	for (std::size_t head(first); head < visited.size(); head++) {
+		const unsigned v(visited[head]);
+		for (unsigned j(ptr[v]); j < ptr[v + 1]; j++) {
+			if (level[adj[j]] == no_level) {
+				level[adj[j]] = level[v] + 1;
+				visited.push_back(adj[j]);
+			}
+		}
+	}
+	return level[visited.back()];
+}
+
+/** orders vertices by increasing degree, vertices of equal degree by their index */
+class CompareDegree
+{
+public:
+	CompareDegree(std::vector<unsigned> const& ptr) : _ptr(ptr) {}
+	bool operator()(unsigned a, unsigned b) const
+	{
+		const unsigned deg_a(_ptr[a + 1] - _ptr[a]), deg_b(_ptr[b + 1] - _ptr[b]);
+		return deg_a < deg_b || (deg_a == deg_b && a < b);
+	}
+private:
+	std::vector<unsigned> const& _ptr;
+};
+
+void MeshRenumbering::getRCMOrder(std::vector<unsigned> const& ptr, std::vector<unsigned> const& adj,
+	std::vector<unsigned> &order)
+{
+	const unsigned no_level(std::numeric_limits<unsigned>::max());
+	const std::size_t n(ptr.size() - 1);
+	const CompareDegree compare_degree(ptr);
+	std::vector<unsigned> level(n, no_level);
+	std::vector<bool> numbered(n, false);
+	std::vector<unsigned> component, neighbors;
+	order.clear();
+	order.reserve(n);
+
+	for (std::size_t v(0); v < n; v++) {
+		if (numbered[v])
+			continue;
+
+		// pseudo-peripheral start vertex: a vertex of minimal degree in the
+		// last level of the breadth first search, as long as the depth grows
+		unsigned start(static_cast<unsigned>(v));
+		component.clear();
+		unsigned depth(breadthFirstSearch(ptr, adj, start, level, component));
+		for (unsigned iter(0); iter < 8; iter++) {
+			unsigned candidate(component.back());
+			for (std::size_t j(component.size()); j > 0 && level[component[j - 1]] == depth; j--)
+				if (compare_degree(component[j - 1], candidate))
+					candidate = component[j - 1];
+			for (std::size_t j(0); j < component.size(); j++)
+				level[component[j]] = no_level;
+			component.clear();
+			const unsigned candidate_depth(breadthFirstSearch(ptr, adj, candidate, level, component));
+			if (candidate_depth <= depth)
+				break;
+			start = candidate;
+			depth = candidate_depth;
+		}
+		for (std::size_t j(0); j < component.size(); j++)
+			level[component[j]] = no_level;
+
+		// Cuthill-McKee: the unnumbered neighbours by increasing degree
+		std::size_t head(order.size());
+		order.push_back(start);
+		numbered[start] = true;
+		for (; head < order.size(); head++) {
+			const unsigned u(order[head]);
+			neighbors.clear();
+			for (unsigned j(ptr[u]); j < ptr[u + 1]; j++) {
+				if (!numbered[adj[j]]) {
+					numbered[adj[j]] = true;
+					neighbors.push_back(adj[j]);
+				}
+			}
+			std::sort(neighbors.begin(), neighbors.end(), compare_degree);
+			order.insert(order.end(), neighbors.begin(), neighbors.end());
+		}
+	}
+	std::reverse(order.begin(), order.end());
+}
+
+MeshRenumbering::MeshRenumbering(Mesh &mesh) :
+	_mesh(mesh)
+{}
+
+void MeshRenumbering::operator() (MeshRenumberingMethod method)
+{
+	MeshTopology const& topology(_mesh.getTopology());
+	const std::size_t n_nodes(_mesh.getNNodes());
+	const std::size_t n_elements(topology.getNElements());
+
+	std::vector<unsigned> node_order, element_order;
+	if (method == RCM_ORDER) {
+		std::vector<unsigned> ptr, adj;
+		topology.getNodeGraph(ptr, adj);
+		getRCMOrder(ptr, adj, node_order);
+
+		// the elements are ordered by their first node in the new numbering
+		std::vector<unsigned> new_idx(n_nodes);
+		for (std::size_t k(0); k < n_nodes; k++)
+			new_idx[node_order[k]] = static_cast<unsigned>(k);
+		std::vector<std::pair<unsigned, unsigned> > keys(n_elements);
+		for (std::size_t e(0); e < n_elements; e++) {
+			unsigned const*const nodes(topology.getNodeIndices(e));
+			unsigned first(std::numeric_limits<unsigned>::max());
+			for (unsigned j(0); j < topology.getNNodes(e); j++)
+				first = std::min(first, new_idx[nodes[j]]);
+			keys[e] = std::make_pair(first, static_cast<unsigned>(e));
+		}
+		std::sort(keys.begin(), keys.end());
+		element_order.resize(n_elements);
+		for (std::size_t e(0); e < n_elements; e++)
+			element_order[e] = keys[e].second;
+	} else {
+		const bool hilbert(method == HILBERT_ORDER);
+		// the curve is computed on coordinate arrays
+		std::vector<Node*> const& mesh_nodes(_mesh.getNodes());
+		std::vector<double> node_coords[3];
+		for (unsigned d(0); d < 3; d++)
+			node_coords[d].resize(n_nodes);
+		for (std::size_t k(0); k < n_nodes; k++) {
+			double const*const x(mesh_nodes[k]->getCoords());
+			for (unsigned d(0); d < 3; d++)
+				node_coords[d][k] = x[d];
+		}
+		if (n_nodes > 0)
+			getSpaceFillingCurveOrder(n_nodes, &node_coords[0][0], &node_coords[1][0], &node_coords[2][0],
+				hilbert, node_order);
+
+		// the elements are ordered by their centroids
+		std::vector<double> centroids[3];
+		for (unsigned d(0); d < 3; d++)
+			centroids[d].resize(n_elements);
+		for (std::size_t e(0); e < n_elements; e++) {
+			unsigned const*const nodes(topology.getNodeIndices(e));
+			const unsigned n_elem_nodes(topology.getNNodes(e));
+			double c[3] = { 0.0, 0.0, 0.0 };
+			for (unsigned j(0); j < n_elem_nodes; j++) {
+				c[0] += node_coords[0][nodes[j]];
+				c[1] += node_coords[1][nodes[j]];
+				c[2] += node_coords[2][nodes[j]];
+			}
+			for (unsigned d(0); d < 3; d++)
+				centroids[d][e] = c[d] / n_elem_nodes;
+		}
+		if (n_elements > 0)
+			getSpaceFillingCurveOrder(n_elements, &centroids[0][0], &centroids[1][0], &centroids[2][0],
+				hilbert, element_order);
+	}
+
+	_mesh.reorder(node_order, element_order);
+}
+
+} // end namespace MeshLib
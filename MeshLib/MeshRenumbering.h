@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file MeshRenumbering.h
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#ifndef MESHRENUMBERING_H_
+#define MESHRENUMBERING_H_
+
+#include <string>
+#include <vector>
+
+namespace MeshLib {
+
+class Mesh;
+
+/**
+ * Orders for the renumbering of the mesh nodes and elements.
+ */
+enum MeshRenumberingMethod {
+	MORTON_ORDER, //!< nodes and element centroids along a Morton (Z) curve
+	HILBERT_ORDER, //!< nodes and element centroids along a Hilbert curve
+	RCM_ORDER //!< reverse Cuthill-McKee order of the node graph, elements ordered by their nodes
+};
+
+/**
+ * Converts "morton", "hilbert" or "rcm" into the method.
+ * @return HILBERT_ORDER for unknown strings
+ */
+MeshRenumberingMethod convertStringToMeshRenumberingMethod(std::string const& str);
+
+/**
+ * The class MeshRenumbering permutes the nodes and elements of a mesh such
+ * that nodes (elements) close to each other in space or in the node graph
+ * get close indices. Meshes from mesh generators often have an almost
+ * random numbering, the renumbering improves the locality of the accesses
+ * to neighbouring nodes and elements and reduces the bandwidth of the
+ * assembled matrices.
+ */
+class MeshRenumbering {
+public:
+	/**
+	 * Constructor of class MeshRenumbering that takes the mesh object that should be renumbered.
+	 * @param mesh the mesh object
+	 */
+	MeshRenumbering(Mesh &mesh);
+
+	/**
+	 * Renumbers the nodes and the elements of the mesh in place, see
+	 * Mesh::reorder().
+	 * @param method the order of the nodes and elements
+	 */
+	void operator() (MeshRenumberingMethod method);
+
+	/**
+	 * Computes the order of points along a space filling curve through the
+	 * bounding box of the points (10 bits per direction). Points in the
+	 * same cell of the curve keep their relative order.
+	 * @param n the number of points
+	 * @param x the x coordinates of the points
+	 * @param y the y coordinates of the points
+	 * @param z the z coordinates of the points
+	 * @param hilbert true for the Hilbert curve, false for the Morton curve
+	 * @param order (output) order[k] is the index of the k-th point on the curve
+	 */
+	static void getSpaceFillingCurveOrder(std::size_t n, double const* x, double const* y,
+		double const* z, bool hilbert, std::vector<unsigned> &order);
+
+	/**
+	 * Computes the reverse Cuthill-McKee order of a graph. Every connected
+	 * component is started at a pseudo-peripheral vertex, the neighbours of
+	 * a vertex are visited by increasing degree.
+	 * @param ptr the offsets of the neighbours of the vertices (n+1 entries)
+	 * @param adj the neighbours of the vertices
+	 * @param order (output) order[k] is the index of the k-th vertex
+	 */
+	static void getRCMOrder(std::vector<unsigned> const& ptr, std::vector<unsigned> const& adj,
+		std::vector<unsigned> &order);
+
+private:
+	Mesh &_mesh;
+};
+
+} // end namespace MeshLib
+
+#endif /* MESHRENUMBERING_H_ */
@@ -0,0 +1,500 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file MeshTopology.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <algorithm>
+#include <limits>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "MeshTopology.h"
+#include "ElementView.h"
+#include "FaceView.h"
+#include "MeshArena.h"
+#include "Node.h"
+#include "Elements/Tri.h"
+#include "Elements/Quad.h"
+#include "Elements/Tet.h"
+#include "Elements/Hex.h"
+#include "Elements/Pyramid.h"
+#include "Elements/Prism.h"
+
+namespace MeshLib {
+
+const unsigned MeshTopology::NO_NEIGHBOR(std::numeric_limits<unsigned>::max());
+
+namespace {
+
+/// a face in the hash table of MeshTopology::computeNeighbors()
+struct BucketFace
+{
+	unsigned hash;
+	unsigned elem;
+	unsigned face;
+};
+
+/// orders the faces of a bucket by the hash value and (element, local face)
+bool lessHash(BucketFace const& a, BucketFace const& b)
+{
+	if (a.hash != b.hash)
+		return a.hash < b.hash;
+	if (a.elem != b.elem)
+		return a.elem < b.elem;
+	return a.face < b.face;
+}
+
+/**
+ * Orders the faces of a bucket by the hash value, the sorted node indices, the
+ * dimension of the element and (element, local face). Identical faces of
+ * elements of the same dimension are adjacent in ascending element order.
+ * The node indices are only looked up if the hash values are equal.
+ */
+class BucketFaceOrder
+{
+public:
+	explicit BucketFaceOrder(MeshTopology const& topology) : _topology(topology) {}
+
+	bool operator()(BucketFace const& a, BucketFace const& b) const
+	{
+		if (a.hash != b.hash)
+			return a.hash < b.hash;
+		const int cmp(compareFaces(a, b));
+		if (cmp != 0)
+			return cmp < 0;
+		if (a.elem != b.elem)
+			return a.elem < b.elem;
+		return a.face < b.face;
+	}
+
+	/**
+	 * compares the sorted node indices and the element dimensions of the faces
+	 * @return a negative value, zero or a positive value if a is smaller than,
+	 * identical to or larger than b
+	 */
+	int compareFaces(BucketFace const& a, BucketFace const& b) const
+	{
+		unsigned nodes_a[4] = {0, 0, 0, 0}, nodes_b[4] = {0, 0, 0, 0};
+		const unsigned n_a(FaceView(_topology, a.elem, a.face).getSortedNodeIndices(nodes_a));
+		const unsigned n_b(FaceView(_topology, b.elem, b.face).getSortedNodeIndices(nodes_b));
+		if (n_a != n_b)
+			return (n_a < n_b) ? -1 : 1;
+		for (unsigned j(0); j < n_a; j++)
+			if (nodes_a[j] != nodes_b[j])
+				return (nodes_a[j] < nodes_b[j]) ? -1 : 1;
+		const unsigned dim_a(MeshTopology::getDimension(_topology.getType(a.elem)));
+		const unsigned dim_b(MeshTopology::getDimension(_topology.getType(b.elem)));
+		if (dim_a != dim_b)
+			return (dim_a < dim_b) ? -1 : 1;
+		return 0;
+	}
+
+private:
+	MeshTopology const& _topology;
+};
+
+} // end anonymous namespace
+
+MeshTopology::MeshTopology() :
+	_elem_node_ptr(1, 0), _neighbor_ptr(1, 0)
+{}
+
+MeshTopology::MeshTopology(std::vector<Element*> const& elements) :
+	_elem_node_ptr(1, 0), _neighbor_ptr(1, 0)
+{
+	const std::size_t n_elements(elements.size());
+	std::size_t n_elem_nodes(0);
+	for (std::size_t k(0); k < n_elements; k++)
+		n_elem_nodes += elements[k]->getNNodes();
+	_types.reserve(n_elements);
+	_values.reserve(n_elements);
+	_elem_node_ptr.reserve(n_elements + 1);
+	_elem_nodes.reserve(n_elem_nodes);
+	for (std::size_t k(0); k < n_elements; k++) {
+		Element const*const elem(elements[k]);
+		_types.push_back(elem->getType());
+		_values.push_back(elem->getValue());
+		const unsigned n_nodes(elem->getNNodes());
+		for (unsigned j(0); j < n_nodes; j++)
+			_elem_nodes.push_back(elem->getNodeIndex(j));
+		_elem_node_ptr.push_back(static_cast<unsigned>(_elem_nodes.size()));
+	}
+}
+
+void MeshTopology::addElement(MshElemType::type type, unsigned n_nodes, unsigned const* nodes, unsigned value)
+{
+	_types.push_back(type);
+	_values.push_back(value);
+	_elem_nodes.insert(_elem_nodes.end(), nodes, nodes + n_nodes);
+	_elem_node_ptr.push_back(static_cast<unsigned>(_elem_nodes.size()));
+	// the neighbour information is not valid anymore
+	_neighbor_ptr.resize(1);
+	_neighbors.clear();
+	_boundary_faces.clear();
+	// the node-element adjacency is not valid anymore
+	_node_elem_ptr.clear();
+	_node_elems.clear();
+}
+
+void MeshTopology::createElements(std::vector<Node*> const& nodes, std::vector<Element*> &elements,
+	MeshArena &arena) const
+{
+	const std::size_t n_elements(getNElements());
+	elements.reserve(elements.size() + n_elements);
+	Node* elem_nodes[MAX_ELEMENT_NODES];
+	for (std::size_t k(0); k < n_elements; k++) {
+		const unsigned n_nodes(getNNodes(k));
+		unsigned const*const node_indices(getNodeIndices(k));
+		for (unsigned j(0); j < n_nodes; j++)
+			elem_nodes[j] = nodes[node_indices[j]];
+		Element *const elem(arena.createElement(_types[k], elem_nodes, n_nodes, _values[k]));
+		if (elem != NULL)
+			elements.push_back(elem);
+	}
+}
+
+void MeshTopology::computeNeighbors()
+{
+	const std::size_t n_elements(getNElements());
+	_neighbor_ptr.resize(n_elements + 1);
+	_neighbor_ptr[0] = 0;
+	for (std::size_t k(0); k < n_elements; k++)
+		_neighbor_ptr[k + 1] = _neighbor_ptr[k] + getNFaces(_types[k]);
+	const unsigned n_faces(_neighbor_ptr[n_elements]);
+	_neighbors.assign(n_faces, NO_NEIGHBOR);
+	_boundary_faces.clear();
+	if (n_faces == 0)
+		return;
+
+	// the faces are distributed to the buckets by their smallest node index,
+	// so that the buckets hold the faces of elements close to each other for
+	// meshes with a local numbering. Face i of element k is stored at
+	// position _neighbor_ptr[k] + i.
+	std::vector<unsigned> face_bucket(n_faces);
+	std::vector<unsigned> face_hash(n_faces);
+#ifdef _OPENMP
+	OPENMP_LOOP_TYPE k;
+	#pragma omp parallel for
+#else
+	unsigned k(0);
+#endif
+	for (k = 0; k < n_elements; k++) {
+		const unsigned n_elem_faces(getNFaces(_types[k]));
+		for (unsigned i(0); i < n_elem_faces; i++) {
+			unsigned face[4] = {0, 0, 0, 0};
+			const unsigned n_face_nodes(FaceView(*this, k, i).getSortedNodeIndices(face));
+			face_bucket[_neighbor_ptr[k] + i] = face[0];
+			face_hash[_neighbor_ptr[k] + i] = hashFace(face, n_face_nodes);
+		}
+	}
+
+	// the hash table: the faces of bucket b are at the positions
+	// [bucket_ptr[b], bucket_ptr[b+1]) of bucket_faces (compressed row storage)
+	const unsigned n_buckets(*std::max_element(face_bucket.begin(), face_bucket.end()) + 1);
+	std::vector<unsigned> bucket_ptr(n_buckets + 1, 0);
+	for (unsigned f(0); f < n_faces; f++)
+		bucket_ptr[face_bucket[f] + 1]++;
+	for (unsigned b(0); b < n_buckets; b++)
+		bucket_ptr[b + 1] += bucket_ptr[b];
+	std::vector<unsigned> pos(bucket_ptr.begin(), bucket_ptr.end() - 1);
+	std::vector<BucketFace> bucket_faces(n_faces);
+	for (std::size_t e(0); e < n_elements; e++) {
+		for (unsigned f(_neighbor_ptr[e]); f < _neighbor_ptr[e + 1]; f++) {
+			BucketFace &bucket_face(bucket_faces[pos[face_bucket[f]]++]);
+			bucket_face.hash = face_hash[f];
+			bucket_face.elem = static_cast<unsigned>(e);
+			bucket_face.face = f - _neighbor_ptr[e];
+		}
+	}
+	std::vector<unsigned>().swap(face_bucket);
+	std::vector<unsigned>().swap(face_hash);
+
+	// every face belongs to exactly one bucket, so the buckets can be
+	// processed independently. A bucket is sorted by the hash values first,
+	// runs of equal hash values with more than two faces (hash collisions,
+	// non-conforming meshes) are sorted by the sorted node indices in
+	// addition. Identical faces are adjacent then, i.e. a bucket with m
+	// faces costs O(m log m) also for nodes with many elements (fans,
+	// rotation axes).
+	const BucketFaceOrder order(*this);
+#ifdef _OPENMP
+	OPENMP_LOOP_TYPE b;
+	#pragma omp parallel for
+#else
+	unsigned b(0);
+#endif
+	for (b = 0; b < n_buckets; b++) {
+		const std::vector<BucketFace>::iterator bucket(bucket_faces.begin() + bucket_ptr[b]);
+		const unsigned n_bucket_faces(bucket_ptr[b + 1] - bucket_ptr[b]);
+		std::sort(bucket, bucket + n_bucket_faces, lessHash);
+		unsigned p(0);
+		while (p < n_bucket_faces) {
+			unsigned q(p + 1);
+			while (q < n_bucket_faces && bucket[q].hash == bucket[p].hash)
+				q++;
+			if (q - p > 2)
+				std::sort(bucket + p, bucket + q, order);
+			// pair the identical faces of the run [p, q) in ascending element
+			// order, a face is not paired with a face of the same element
+			unsigned unpaired(p);
+			for (unsigned r(p + 1); r < q; r++) {
+				if (unpaired != NO_NEIGHBOR && order.compareFaces(bucket[r - 1], bucket[r]) != 0)
+					unpaired = NO_NEIGHBOR;
+				if (unpaired == NO_NEIGHBOR) {
+					unpaired = r;
+				} else if (bucket[r].elem != bucket[unpaired].elem) {
+					_neighbors[_neighbor_ptr[bucket[unpaired].elem] + bucket[unpaired].face] = bucket[r].elem;
+					_neighbors[_neighbor_ptr[bucket[r].elem] + bucket[r].face] = bucket[unpaired].elem;
+					unpaired = NO_NEIGHBOR;
+				}
+			}
+			p = q;
+		}
+	}
+
+	// the faces without neighbour are the boundary of the mesh
+	for (std::size_t e(0); e < n_elements; e++)
+		for (unsigned f(_neighbor_ptr[e]); f < _neighbor_ptr[e + 1]; f++)
+			if (_neighbors[f] == NO_NEIGHBOR)
+				_boundary_faces.push_back(std::make_pair(static_cast<unsigned>(e), f - _neighbor_ptr[e]));
+}
+
+void MeshTopology::computeNodeElements(std::size_t n_nodes)
+{
+	const std::size_t n_elements(getNElements());
+	_node_elem_ptr.assign(n_nodes + 1, 0);
+	if (n_nodes == 0)
+		return;
+
+	// the threads work on the elements, the entries of the nodes are
+	// updated atomically. Hence the temporary memory is one array of
+	// positions, independent of the number of threads.
+	unsigned const*const elem_node_ptr(&_elem_node_ptr[0]);
+	unsigned const*const elem_nodes(getElementNodeArray());
+	unsigned *const node_elem_ptr(&_node_elem_ptr[0]);
+
+	// first pass: count the elements of every node
+#ifdef _OPENMP
+	OPENMP_LOOP_TYPE k;
+	#pragma omp parallel for
+#else
+	unsigned k(0);
+#endif
+	for (k = 0; k < n_elements; k++) {
+		for (unsigned j(elem_node_ptr[k]); j < elem_node_ptr[k + 1]; j++) {
+#ifdef _OPENMP
+			#pragma omp atomic
+#endif
+			node_elem_ptr[elem_nodes[j] + 1]++;
+		}
+	}
+	for (std::size_t l(0); l < n_nodes; l++)
+		node_elem_ptr[l + 1] += node_elem_ptr[l];
+
+	// second pass: store the element indices
+	_node_elems.resize(_node_elem_ptr[n_nodes]);
+	if (_node_elems.empty())
+		return;
+	unsigned *const node_elems(&_node_elems[0]);
+	std::vector<unsigned> pos(_node_elem_ptr.begin(), _node_elem_ptr.end() - 1);
+	unsigned *const node_pos(&pos[0]);
+#ifdef _OPENMP
+	#pragma omp parallel for
+#endif
+	for (k = 0; k < n_elements; k++) {
+		for (unsigned j(elem_node_ptr[k]); j < elem_node_ptr[k + 1]; j++) {
+			unsigned slot;
+#ifdef _OPENMP
+			#pragma omp atomic capture
+#endif
+			slot = node_pos[elem_nodes[j]]++;
+			node_elems[slot] = static_cast<unsigned>(k);
+		}
+	}
+
+	// the order of the threads is arbitrary, the elements of a node are stored in ascending order
+#ifdef _OPENMP
+	OPENMP_LOOP_TYPE i;
+	#pragma omp parallel for schedule(dynamic, 1024)
+#else
+	unsigned i(0);
+#endif
+	for (i = 0; i < n_nodes; i++)
+		std::sort(node_elems + node_elem_ptr[i], node_elems + node_elem_ptr[i + 1]);
+}
+
+void MeshTopology::getNodeGraph(std::vector<unsigned> &ptr, std::vector<unsigned> &adj) const
+{
+	const std::size_t n_nodes(_node_elem_ptr.empty() ? 0 : _node_elem_ptr.size() - 1);
+	ptr.resize(n_nodes + 1);
+	ptr[0] = 0;
+	adj.clear();
+	std::vector<unsigned> nodes;
+	for (std::size_t i(0); i < n_nodes; i++) {
+		nodes.clear();
+		for (unsigned e(_node_elem_ptr[i]); e < _node_elem_ptr[i + 1]; e++) {
+			const unsigned elem(_node_elems[e]);
+			nodes.insert(nodes.end(), _elem_nodes.begin() + _elem_node_ptr[elem],
+				_elem_nodes.begin() + _elem_node_ptr[elem + 1]);
+		}
+		std::sort(nodes.begin(), nodes.end());
+		nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+		for (std::size_t j(0); j < nodes.size(); j++)
+			if (nodes[j] != i)
+				adj.push_back(nodes[j]);
+		ptr[i + 1] = static_cast<unsigned>(adj.size());
+	}
+}
+
+ElementView MeshTopology::getElement(std::size_t k) const
+{
+	return ElementView(*this, k);
+}
+
+std::size_t MeshTopology::getMemoryUsage() const
+{
+	return _types.capacity() * sizeof(MshElemType::type)
+		+ (_values.capacity() + _elem_node_ptr.capacity() + _elem_nodes.capacity()
+			+ _neighbor_ptr.capacity() + _neighbors.capacity()
+			+ _node_elem_ptr.capacity() + _node_elems.capacity()) * sizeof(unsigned)
+		+ _boundary_faces.capacity() * sizeof(std::pair<unsigned, unsigned>);
+}
+
+unsigned MeshTopology::hashFace(unsigned const* face, unsigned n_face_nodes)
+{
+	// multiplicative hashing, the constant is 2^32 divided by the golden ratio
+	unsigned h(n_face_nodes);
+	for (unsigned j(0); j < n_face_nodes; j++)
+		h = (h ^ face[j]) * 2654435761u;
+	return h ^ (h >> 16);
+}
+
+unsigned MeshTopology::getDimension(MshElemType::type type)
+{
+	switch (type) {
+	case MshElemType::EDGE:
+		return 1;
+	case MshElemType::TRIANGLE:
+	case MshElemType::QUAD:
+		return 2;
+	case MshElemType::TETRAHEDRON:
+	case MshElemType::HEXAHEDRON:
+	case MshElemType::PYRAMID:
+	case MshElemType::PRISM:
+		return 3;
+	default:
+		return 0;
+	}
+}
+
+unsigned MeshTopology::getNFaces(MshElemType::type type)
+{
+	switch (type) {
+	case MshElemType::TRIANGLE:
+		return 3;
+	case MshElemType::QUAD:
+	case MshElemType::TETRAHEDRON:
+		return 4;
+	case MshElemType::PYRAMID:
+	case MshElemType::PRISM:
+		return 5;
+	case MshElemType::HEXAHEDRON:
+		return 6;
+	default:
+		return 0;
+	}
+}
+
+unsigned MeshTopology::getNFaceNodes(MshElemType::type type, unsigned i)
+{
+	switch (type) {
+	case MshElemType::TRIANGLE:
+	case MshElemType::QUAD:
+		return 2;
+	case MshElemType::TETRAHEDRON:
+		return 3;
+	case MshElemType::HEXAHEDRON:
+		return 4;
+	case MshElemType::PYRAMID:
+		return Pyramid::_n_face_nodes[i];
+	case MshElemType::PRISM:
+		return Prism::_n_face_nodes[i];
+	default:
+		return 0;
+	}
+}
+
+unsigned MeshTopology::getFaceNode(MshElemType::type type, unsigned i, unsigned j)
+{
+	switch (type) {
+	case MshElemType::TRIANGLE:
+		return Tri::_edge_nodes[i][j];
+	case MshElemType::QUAD:
+		return Quad::_edge_nodes[i][j];
+	case MshElemType::TETRAHEDRON:
+		return Tet::_face_nodes[i][j];
+	case MshElemType::HEXAHEDRON:
+		return Hex::_face_nodes[i][j];
+	case MshElemType::PYRAMID:
+		return Pyramid::_face_nodes[i][j];
+	case MshElemType::PRISM:
+		return Prism::_face_nodes[i][j];
+	default:
+		return std::numeric_limits<unsigned>::max();
+	}
+}
+
+unsigned MeshTopology::getNEdges(MshElemType::type type)
+{
+	switch (type) {
+	case MshElemType::EDGE:
+		return 1;
+	case MshElemType::TRIANGLE:
+		return 3;
+	case MshElemType::QUAD:
+		return 4;
+	case MshElemType::TETRAHEDRON:
+		return 6;
+	case MshElemType::HEXAHEDRON:
+		return 12;
+	case MshElemType::PYRAMID:
+		return 8;
+	case MshElemType::PRISM:
+		return 9;
+	default:
+		return 0;
+	}
+}
+
+unsigned MeshTopology::getEdgeNode(MshElemType::type type, unsigned i, unsigned j)
+{
+	switch (type) {
+	case MshElemType::EDGE:
+		return j;
+	case MshElemType::TRIANGLE:
+		return Tri::_edge_nodes[i][j];
+	case MshElemType::QUAD:
+		return Quad::_edge_nodes[i][j];
+	case MshElemType::TETRAHEDRON:
+		return Tet::_edge_nodes[i][j];
+	case MshElemType::HEXAHEDRON:
+		return Hex::_edge_nodes[i][j];
+	case MshElemType::PYRAMID:
+		return Pyramid::_edge_nodes[i][j];
+	case MshElemType::PRISM:
+		return Prism::_edge_nodes[i][j];
+	default:
+		return std::numeric_limits<unsigned>::max();
+	}
+}
+
+} // end namespace MeshLib
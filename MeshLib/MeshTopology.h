@@ -0,0 +1,214 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file MeshTopology.h
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#ifndef MESHTOPOLOGY_H_
+#define MESHTOPOLOGY_H_
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "MshEnums.h"
+
+namespace MeshLib {
+
+class Node;
+class Element;
+class ElementView;
+class MeshArena;
+
+/**
+ * Class MeshTopology stores the connectivity of the mesh elements in a
+ * compact form:
+ * - an array of element types and an array of element values,
+ * - the node indices of all elements in one array, the nodes of
+ *   element k are at the positions [_elem_node_ptr[k], _elem_node_ptr[k+1])
+ *   (compressed row storage),
+ * - the indices of the neighbours of all elements in one array, the
+ *   neighbour across face (3d elements) or edge (2d elements) i of element k is
+ *   stored at position _neighbor_ptr[k] + i. The local numbering of the
+ *   faces and edges is the numbering of the element classes,
+ * - the indices of the elements every node is part of in one array, the
+ *   elements of node i are at the positions
+ *   [_node_elem_ptr[i], _node_elem_ptr[i+1]) (compressed row storage).
+ *
+ * Loops over the element connectivity read a few contiguous arrays instead
+ * of following the node and neighbour pointers of the Element objects.
+ * Single elements are accessed via the non-allocating ElementView.
+ */
+class MeshTopology
+{
+public:
+	/// value of the neighbour index if there is no neighbour across the face
+	static const unsigned NO_NEIGHBOR;
+	/// maximal number of nodes of the element types supported by the mesh
+	static const unsigned MAX_ELEMENT_NODES = 10;
+
+	MeshTopology();
+
+	/**
+	 * Exports the connectivity of the given elements. The node indices are
+	 * the ids of the nodes, i.e. the positions of the nodes within the mesh.
+	 * The neighbour information is not copied, see computeNeighbors().
+	 * @param elements the elements of a mesh
+	 */
+	explicit MeshTopology(std::vector<Element*> const& elements);
+
+	/**
+	 * Appends an element. The neighbours of the element are not set.
+	 * @param type the type of the element
+	 * @param n_nodes the number of nodes of the element
+	 * @param nodes the indices of the nodes of the element
+	 * @param value the value (material group) of the element
+	 */
+	void addElement(MshElemType::type type, unsigned n_nodes, unsigned const* nodes, unsigned value);
+
+	/**
+	 * Creates Element objects for the nodes in the given arena.
+	 * @param nodes the nodes the node indices of the topology refer to
+	 * @param elements (output) the created elements
+	 * @param arena the arena the elements and their arrays are allocated in
+	 */
+	void createElements(std::vector<Node*> const& nodes, std::vector<Element*> &elements,
+		MeshArena &arena) const;
+
+	/**
+	 * Computes for every element the neighbours across its faces (3d
+	 * elements) or edges (2d elements), i.e. the elements of the same
+	 * dimension that have a face (edge) with the same nodes. The faces are
+	 * distributed to buckets by their smallest node index, every bucket is
+	 * sorted by (hash, sorted face node indices) and identical faces are
+	 * matched within the sorted runs, i.e. the cost is O(m log m) for a
+	 * bucket with m faces. The faces without a matching face form the
+	 * boundary of the mesh.
+	 */
+	void computeNeighbors();
+
+	/**
+	 * Computes for every node the elements the node is part of. The
+	 * adjacency is built in parallel in two passes (counting and filling)
+	 * over the element connectivity, the elements of a node are sorted
+	 * afterwards. The work is linear in the size of the connectivity, one
+	 * array of n_nodes positions is needed temporarily.
+	 * @param n_nodes the number of nodes of the mesh
+	 */
+	void computeNodeElements(std::size_t n_nodes);
+
+	/**
+	 * Computes the node graph: two nodes are adjacent if they belong to a
+	 * common element. The neighbours of node i (without i itself, in
+	 * ascending order) are at the positions [ptr[i], ptr[i+1]) of adj.
+	 * computeNodeElements() has to be called before.
+	 * @param ptr (output) the offsets of the neighbours of the nodes
+	 * @param adj (output) the neighbours of all nodes
+	 */
+	void getNodeGraph(std::vector<unsigned> &ptr, std::vector<unsigned> &adj) const;
+
+	/** @return the number of elements */
+	std::size_t getNElements() const { return _types.size(); }
+
+	/** @return a non-allocating view to the element with index k */
+	ElementView getElement(std::size_t k) const;
+
+	/** @return the type of element k */
+	MshElemType::type getType(std::size_t k) const { return _types[k]; }
+
+	/** @return the value (material group) of element k */
+	unsigned getValue(std::size_t k) const { return _values[k]; }
+
+	/** @return the number of nodes of element k */
+	unsigned getNNodes(std::size_t k) const { return _elem_node_ptr[k + 1] - _elem_node_ptr[k]; }
+
+	/** @return the node indices of element k */
+	unsigned const* getNodeIndices(std::size_t k) const { return &_elem_nodes[_elem_node_ptr[k]]; }
+
+	/** @return the number of neighbours (faces or edges) of element k */
+	unsigned getNNeighbors(std::size_t k) const { return _neighbor_ptr[k + 1] - _neighbor_ptr[k]; }
+
+	/**
+	 * @return the neighbour indices of element k, NO_NEIGHBOR marks faces
+	 * without neighbour
+	 */
+	unsigned const* getNeighborIndices(std::size_t k) const
+	{
+		return _neighbors.empty() ? NULL : &_neighbors[_neighbor_ptr[k]];
+	}
+
+	/**
+	 * @return the faces (3d elements) or edges (2d elements) without
+	 * neighbour as pairs (element index, local face index), sorted by the
+	 * element index
+	 */
+	std::vector<std::pair<unsigned, unsigned> > const& getBoundaryFaces() const { return _boundary_faces; }
+
+	/** @return the number of elements node i is part of */
+	unsigned getNNodeElements(std::size_t i) const { return _node_elem_ptr[i + 1] - _node_elem_ptr[i]; }
+
+	/** @return the indices of the elements node i is part of (ascending) */
+	unsigned const* getNodeElementIndices(std::size_t i) const
+	{
+		return _node_elems.empty() ? NULL : &_node_elems[0] + _node_elem_ptr[i];
+	}
+
+	/** @return true if computeNeighbors() was called after the last change */
+	bool hasNeighbors() const { return _neighbor_ptr.size() == _types.size() + 1; }
+
+	/** @return true if computeNodeElements() was called after the last change */
+	bool hasNodeElements() const { return !_node_elem_ptr.empty(); }
+
+	/** @return the offsets of the element nodes (getNElements()+1 entries) */
+	unsigned const* getElementNodePtrArray() const { return &_elem_node_ptr[0]; }
+	/** @return the node indices of all elements */
+	unsigned const* getElementNodeArray() const { return _elem_nodes.empty() ? NULL : &_elem_nodes[0]; }
+
+	/** @return the number of bytes allocated for the arrays */
+	std::size_t getMemoryUsage() const;
+
+	/** @return the dimension of an element of the given type */
+	static unsigned getDimension(MshElemType::type type);
+
+	/**
+	 * @return the number of faces (3d elements) or edges (2d elements) an
+	 * element of the given type shares with its neighbours
+	 */
+	static unsigned getNFaces(MshElemType::type type);
+
+	/** @return the number of nodes of face (3d elements) or edge (2d elements) i */
+	static unsigned getNFaceNodes(MshElemType::type type, unsigned i);
+
+	/** @return the local index of node j of face (3d elements) or edge (2d elements) i */
+	static unsigned getFaceNode(MshElemType::type type, unsigned i, unsigned j);
+
+	/** @return the number of edges of an element of the given type */
+	static unsigned getNEdges(MshElemType::type type);
+
+	/** @return the local index of node j (0 or 1) of edge i */
+	static unsigned getEdgeNode(MshElemType::type type, unsigned i, unsigned j);
+
+private:
+	/** @return the hash value of the sorted face node indices */
+	static unsigned hashFace(unsigned const* face, unsigned n_face_nodes);
+
+	std::vector<MshElemType::type> _types;
+	std::vector<unsigned> _values;
+	std::vector<unsigned> _elem_node_ptr;
+	std::vector<unsigned> _elem_nodes;
+	std::vector<unsigned> _neighbor_ptr;
+	std::vector<unsigned> _neighbors;
+	std::vector<std::pair<unsigned, unsigned> > _boundary_faces;
+	std::vector<unsigned> _node_elem_ptr;
+	std::vector<unsigned> _node_elems;
+};
+
+} // end namespace MeshLib
+
+#endif /* MESHTOPOLOGY_H_ */
@@ -9,15 +9,20 @@
  * Created on 2011-06-15 by Karsten Rink
  */
 
+#include <cassert>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+
 #include "MshEditor.h"
 #include "PointWithID.h"
 #include "Mesh.h"
+#include "MeshArena.h"
+#include "MeshTopology.h"
+#include "FaceView.h"
 #include "Node.h"
 #include "Elements/Element.h"
-#include "Elements/Face.h"
-#include "Elements/Cell.h"
-#include "Elements/Tri.h"
-#include "Elements/Quad.h"
 
 #include "MathTools.h"
 
@@ -36,7 +41,8 @@ void MshEditor::getSurfaceAreaForNodes(const MeshLib::Mesh* mesh, std::vector<do
 		{
 			double node_area (0);
 
-			std::vector<MeshLib::Element*> conn_elems = nodes[n]->getElements();
+			// the range refers to the mesh, the mesh is not changed here
+			const MeshLib::NodeElements &conn_elems = nodes[n]->getElements();
 			const size_t nConnElems (conn_elems.size());
 
 			for (size_t i=0; i<nConnElems;i++)
@@ -68,13 +74,11 @@ MeshLib::Mesh* MshEditor::removeMeshNodes(MeshLib::Mesh* mesh,
 	for (size_t i = 0; i < delNodes; i++)
 	{
 		const MeshLib::Node* node = new_mesh->getNode(i);
-		std::vector<MeshLib::Element*> conn_elems = node->getElements();
+		// the range refers to the element array of new_mesh, which is not changed by deleting the elements
+		const MeshLib::NodeElements &conn_elems = node->getElements();
 
 		for (size_t j = 0; j < conn_elems.size(); j++)
-		{
 			delete conn_elems[j];
-			conn_elems[j] = NULL;
-		}
 		delete mesh_nodes[i];
 		mesh_nodes[i] = NULL;
 	}
@@ -115,117 +119,219 @@ MeshLib::Mesh* MshEditor::removeMeshNodes(MeshLib::Mesh* mesh,
 
 std::vector<GeoLib::PointWithID*> MshEditor::getSurfaceNodes(const MeshLib::Mesh &mesh)
 {
-	/* TODO6
 	std::cout << "Extracting surface nodes..." << std::endl;
-	// Sort points lexicographically
-	size_t nNodes (mesh.nod_vector.size());
-	std::vector<GeoLib::PointWithID*> nodes;
-	std::vector<size_t> perm;
-	for (size_t j(0); j<nNodes; j++)
+	std::vector<GeoLib::PointWithID*> surface_pnts;
+	if (mesh.getDimension() != 2 && mesh.getDimension() != 3)
 	{
-		nodes.push_back(new GeoLib::PointWithID(mesh.nod_vector[j]->getData(), j));
-		perm.push_back(j);
+		std::cout << "Error in MshEditor::getSurfaceNodes() - Given mesh is neither 2d nor 3d." << std::endl;
+		return surface_pnts;
 	}
-	Quicksort<GeoLib::PointWithID*> (nodes, 0, nodes.size(), perm);
 
-	// Extract surface points
-	double eps (std::numeric_limits<double>::epsilon());
-	*/
-	std::vector<GeoLib::PointWithID*> surface_pnts;
-	/* TODO6
-	for (size_t k(1); k < nNodes; k++)
+	// all nodes of a 2d mesh are surface nodes, for a 3d mesh take the top faces
+	const double dir[3] = {0, 0, 1};
+	std::vector<unsigned> surface_elements, surface_nodes, n_surface_nodes;
+	getSurfaceElements(mesh, (mesh.getDimension() == 3) ? dir : NULL, surface_elements, surface_nodes, n_surface_nodes);
+
+	const size_t nNodes (mesh.getNNodes());
+	std::vector<bool> is_surface_node;
+	surface_pnts.reserve(markSurfaceNodes(nNodes, surface_nodes, n_surface_nodes, is_surface_node));
+	for (size_t i=0; i<nNodes; i++)
 	{
-		const GeoLib::PointWithID& p0 (*(nodes[k - 1]));
-		const GeoLib::PointWithID& p1 (*(nodes[k]));
-		if (fabs (p0[0] - p1[0]) > eps || fabs (p0[1] - p1[1]) > eps)
-			surface_pnts.push_back (nodes[k - 1]);
+		if (is_surface_node[i])
+			surface_pnts.push_back(new GeoLib::PointWithID(mesh.getNode(i)->getCoords(), i));
 	}
-	// Add last point
-	surface_pnts.push_back (nodes[nNodes - 1]);
-
-	*/
 	return surface_pnts;
 }
 
 MeshLib::Mesh* MshEditor::getMeshSurface(const MeshLib::Mesh &mesh, const double* dir)
 {
 	std::cout << "Extracting mesh surface..." << std::endl;
+	if (mesh.getDimension() != 2 && mesh.getDimension() != 3)
+	{
+		std::cout << "Error in MshEditor::getMeshSurface() - Given mesh is neither 2d nor 3d." << std::endl;
+		return NULL;
+	}
+
+	std::vector<unsigned> surface_elements, surface_nodes, n_surface_nodes;
+	getSurfaceElements(mesh, dir, surface_elements, surface_nodes, n_surface_nodes);
 
-	const std::vector<MeshLib::Element*> elements = mesh.getElements();
+	// create the used nodes in the order of the original nodes
+	const size_t nNodes (mesh.getNNodes());
+	std::vector<bool> is_surface_node;
+	const size_t nNewNodes (markSurfaceNodes(nNodes, surface_nodes, n_surface_nodes, is_surface_node));
+	MeshLib::MeshArena* arena (new MeshLib::MeshArena);
+	std::vector<MeshLib::Node*> new_nodes;
+	new_nodes.reserve(nNewNodes);
+	std::vector<MeshLib::Node*> node_map(nNodes, NULL);
+	for (size_t i=0; i<nNodes; i++)
+	{
+		if (is_surface_node[i])
+		{
+			double const*const coords (mesh.getNode(i)->getCoords());
+			node_map[i] = arena->createNode(coords[0], coords[1], coords[2], new_nodes.size());
+			new_nodes.push_back(node_map[i]);
+		}
+	}
+
+	const std::vector<MeshLib::Element*> &elements (mesh.getElements());
+	const size_t nSurfaceElements (surface_elements.size());
 	std::vector<MeshLib::Element*> new_elements;
-	const size_t nElements (mesh.getNElements());
+	for (size_t i=0; i<nSurfaceElements; i++)
+	{
+		const unsigned nElemNodes (n_surface_nodes[i]);
+		if (nElemNodes == 0)
+			continue;
+		MeshLib::Node* elem_nodes[4];
+		for (unsigned j=0; j<nElemNodes; j++)
+			elem_nodes[j] = node_map[surface_nodes[4*i+j]];
+		const MshElemType::type type ((nElemNodes == 3) ? MshElemType::TRIANGLE : MshElemType::QUAD);
+		new_elements.push_back(arena->createElement(type, elem_nodes, nElemNodes, elements[surface_elements[i]]->getValue()));
+	}
+
+	return new MeshLib::Mesh(mesh.getName() + "-Surface", new_nodes, new_elements, arena);
+}
 
-	bool complete_surface = ((dir[0]*dir[0] + dir[1]*dir[1] + dir[2]*dir[2]) == 0) ? true : false;
+void MshEditor::getSurfaceElements(const MeshLib::Mesh &mesh, const double* dir,
+	std::vector<unsigned> &surface_elements, std::vector<unsigned> &surface_nodes,
+	std::vector<unsigned> &n_surface_nodes)
+{
+	const MeshLib::MeshTopology &topology (mesh.getTopology());
+	const bool is_3d (mesh.getDimension() == 3);
 
-	// 2D meshes
-	if (mesh.getDimension() == 2 )
+	// candidates: the faces without neighbour of the 3d elements or the 2d elements
+	std::vector<unsigned> local_faces;
+	surface_elements.clear();
+	if (is_3d)
 	{
-		if (complete_surface) return new MeshLib::Mesh(mesh); // simply copy the mesh
-		else	// check only surface normal directions of all elements
+		const std::vector<std::pair<unsigned, unsigned> > &boundary_faces (topology.getBoundaryFaces());
+		for (size_t i=0; i<boundary_faces.size(); i++)
 		{
-			for (unsigned i=0; i<nElements; i++)
+			if (MeshLib::MeshTopology::getDimension(topology.getType(boundary_faces[i].first)) == 3)
 			{
-				MeshLib::Face* face = dynamic_cast<MeshLib::Face*>(elements[i]);
-				double normal[3];
-				face->getSurfaceNormal(normal);
-				if (MathLib::scpr(normal, dir, 3) > 0)
-					new_elements.push_back(static_cast<MeshLib::Element*>(face));
+				surface_elements.push_back(boundary_faces[i].first);
+				local_faces.push_back(boundary_faces[i].second);
 			}
 		}
 	}
-	// 3D meshes
-	else if (mesh.getDimension() == 3)	//
+	else
+	{
+		const size_t nElements (topology.getNElements());
+		for (size_t i=0; i<nElements; i++)
+			if (MeshLib::MeshTopology::getDimension(topology.getType(i)) == 2)
+				surface_elements.push_back(i);
+	}
+
+	const double dir_norm (dir == NULL ? 0 : sqrt(dir[0]*dir[0] + dir[1]*dir[1] + dir[2]*dir[2]));
+	const bool complete_surface (dir_norm == 0);
+	// faces (almost) parallel to dir, e.g. the vertical faces of a rotated layered mesh,
+	// may have a small positive scalar product caused by round-off, they are not selected
+	const double tol (sqrt(std::numeric_limits<double>::epsilon()));
+	const std::vector<MeshLib::Node*> &mesh_nodes (mesh.getNodes());
+	const size_t nSurfaceElements (surface_elements.size());
+	surface_nodes.assign(4*nSurfaceElements, 0);
+	n_surface_nodes.assign(nSurfaceElements, 0);
+
+#ifdef _OPENMP
+	OPENMP_LOOP_TYPE i;
+	#pragma omp parallel for
+#else
+	unsigned i(0);
+#endif
+	for (i=0; i<nSurfaceElements; i++)
 	{
-		for (unsigned i=0; i<nElements; i++)
+		const unsigned elem_idx (surface_elements[i]);
+		unsigned* nodes (&surface_nodes[4*i]);
+		unsigned nElemNodes (0);
+		if (is_3d)
 		{
-			if (const MeshLib::Cell* cell = dynamic_cast<MeshLib::Cell*>(elements[i]))
+			const MeshLib::FaceView face (topology, elem_idx, local_faces[i]);
+			nElemNodes = face.getNNodes();
+			for (unsigned j=0; j<nElemNodes; j++)
+				nodes[j] = face.getNodeIndex(j);
+		}
+		else
+		{
+			// the corner nodes (stored first) of triangles and quads, at most four
+			nElemNodes = (topology.getType(elem_idx) == MshElemType::TRIANGLE) ? 3 : 4;
+			assert(nElemNodes <= topology.getNNodes(elem_idx));
+			std::copy(topology.getNodeIndices(elem_idx), topology.getNodeIndices(elem_idx) + nElemNodes, nodes);
+		}
+
+		// normal vector, for quads the cross product of the diagonals
+		double u[3], v[3], normal[3];
+		double const*const p0 (mesh_nodes[nodes[0]]->getCoords());
+		double const*const p1 (mesh_nodes[nodes[1]]->getCoords());
+		double const*const p2 (mesh_nodes[nodes[2]]->getCoords());
+		if (nElemNodes == 3)
+		{
+			for (unsigned k=0; k<3; k++)
 			{
-				if (cell->isOnSurface())
-				{
-					const unsigned nFaces (cell->getNFaces());
-					for (unsigned j=0; j<nFaces; j++)
-					{
-						if (cell->getNeighbor(i) == NULL)
-						{
-							const MeshLib::Face* face = static_cast<const MeshLib::Face*>(cell->getFace(i));
-							if (!complete_surface)
-							{
-								double normal[3];
-								face->getSurfaceNormal(normal);
-								if (MathLib::scpr<double,3>(normal, dir) <= 0)
-									continue;
-							}
-
-							if (face->getType() == MshElemType::TRIANGLE)
-								new_elements.push_back(new MeshLib::Tri(*static_cast<const MeshLib::Tri*>(face)));
-							else
-								new_elements.push_back(new MeshLib::Quad(*static_cast<const MeshLib::Quad*>(face)));
-						}
-					}
-				}
+				u[k] = p1[k] - p0[k];
+				v[k] = p2[k] - p0[k];
 			}
 		}
+		else
+		{
+			double const*const p3 (mesh_nodes[nodes[3]]->getCoords());
+			for (unsigned k=0; k<3; k++)
+			{
+				u[k] = p2[k] - p0[k];
+				v[k] = p3[k] - p1[k];
+			}
+		}
+		MathLib::crossProd(u, v, normal);
 
-		// now copy nodes
-		const size_t nNewElements (new_elements.size());
-		std::vector<const MeshLib::Node*> tmp_nodes(mesh.getNNodes(), NULL);
-		const size_t nNodes (tmp_nodes.size());
-		for (unsigned i=0; i<nNewElements; i++)
+		// let the normal of a face point away from the centre of its element
+		if (is_3d)
 		{
-			const MeshLib::Element* elem (new_elements[i]);
-			for (unsigned j=0; j<elem->getNNodes(); j++)
+			const unsigned nCellNodes (topology.getNNodes(elem_idx));
+			unsigned const*const cell_nodes (topology.getNodeIndices(elem_idx));
+			double outward[3] = {0, 0, 0};
+			for (unsigned j=0; j<nCellNodes; j++)
+			{
+				double const*const x (mesh_nodes[cell_nodes[j]]->getCoords());
+				for (unsigned k=0; k<3; k++)
+					outward[k] -= x[k] / nCellNodes;
+			}
+			for (unsigned j=0; j<nElemNodes; j++)
 			{
-				const MeshLib::Node* node (elem->getNode(i));
-				tmp_nodes[node->getID()] = node;
+				double const*const x (mesh_nodes[nodes[j]]->getCoords());
+				for (unsigned k=0; k<3; k++)
+					outward[k] += x[k] / nElemNodes;
+			}
+			if (MathLib::scpr<double,3>(normal, outward) < 0)
+			{
+				std::reverse(nodes + 1, nodes + nElemNodes);
+				for (unsigned k=0; k<3; k++)
+					normal[k] = -normal[k];
 			}
 		}
-		std::vector<MeshLib::Node*> new_nodes;
-		for (unsigned i=0; i<nNodes; i++)
-			if (tmp_nodes[i])
-				new_nodes.push_back(new MeshLib::Node(tmp_nodes[i]->getCoords()));
-	}
 
+		if (complete_surface || MathLib::scpr<double,3>(normal, dir)
+			> tol * sqrt(MathLib::scpr<double,3>(normal, normal)) * dir_norm)
+			n_surface_nodes[i] = nElemNodes;
+	}
+}
 
+size_t MshEditor::markSurfaceNodes(size_t n_mesh_nodes, std::vector<unsigned> const& surface_nodes,
+	std::vector<unsigned> const& n_surface_nodes, std::vector<bool> &is_surface_node)
+{
+	is_surface_node.assign(n_mesh_nodes, false);
+	size_t nMarked (0);
+	const size_t nSurfaceElements (n_surface_nodes.size());
+	for (size_t i=0; i<nSurfaceElements; i++)
+	{
+		for (unsigned j=0; j<n_surface_nodes[i]; j++)
+		{
+			const unsigned node_idx (surface_nodes[4*i+j]);
+			if (!is_surface_node[node_idx])
+			{
+				is_surface_node[node_idx] = true;
+				nMarked++;
+			}
+		}
+	}
+	return nMarked;
 }
 
 } // end namespace MeshLib
@@ -41,13 +41,46 @@ public:
 	/// Removes the mesh nodes (and connected elements) given in the nodes-list from the mesh.
 	static MeshLib::Mesh* removeMeshNodes(MeshLib::Mesh* mesh, const std::vector<size_t> &nodes);
 
-	/// Returns the surface nodes of a layered mesh.
+	/**
+	 * Returns the surface nodes of a layered mesh, i.e. the nodes of the boundary faces
+	 * with an upward outward normal (all nodes of a 2d mesh). The ids of the points are
+	 * the indices of the nodes in the mesh, the caller takes ownership of the points.
+	 */
 	static std::vector<GeoLib::PointWithID*> getSurfaceNodes(const MeshLib::Mesh &mesh);
 
-	/// Returns the 2d-element mesh representing the surface of the given layered mesh.
-	static MeshLib::Mesh* getMeshSurface(const MeshLib::Mesh &mesh, const double* dir);
+	/**
+	 * Returns the 2d-element mesh representing the surface of the given mesh. The
+	 * surface of a 3d mesh consists of the faces without neighbour, the surface
+	 * elements are oriented such that their normal points outward. The surface of
+	 * a 2d mesh consists of copies of its elements.
+	 * @param mesh the 2d or 3d mesh
+	 * @param dir if dir is given only the surface elements with a normal having a
+	 * positive scalar product with dir are selected (faces parallel to dir up to
+	 * round-off are not), a NULL pointer or a zero vector selects the complete surface
+	 * @return the surface mesh with its own nodes (numbered in the order of the
+	 * original nodes) or NULL if the mesh is neither 2d nor 3d
+	 */
+	static MeshLib::Mesh* getMeshSurface(const MeshLib::Mesh &mesh, const double* dir = NULL);
 
 private:
+	/**
+	 * Computes the surface elements of a mesh as described in getMeshSurface().
+	 * @param mesh the 2d or 3d mesh
+	 * @param dir the direction or NULL for the complete surface
+	 * @param surface_elements (output) the index of the mesh element the surface element belongs to
+	 * @param surface_nodes (output) four entries per surface element, the mesh indices of its nodes
+	 * @param n_surface_nodes (output) the number of nodes of the surface element, 0 if it is not selected
+	 */
+	static void getSurfaceElements(const MeshLib::Mesh &mesh, const double* dir,
+		std::vector<unsigned> &surface_elements, std::vector<unsigned> &surface_nodes,
+		std::vector<unsigned> &n_surface_nodes);
+
+	/**
+	 * Marks the nodes used by the selected surface elements.
+	 * @return the number of marked nodes
+	 */
+	static std::size_t markSurfaceNodes(std::size_t n_mesh_nodes, std::vector<unsigned> const& surface_nodes,
+		std::vector<unsigned> const& n_surface_nodes, std::vector<bool> &is_surface_node);
 };
 
 } // end namespace MeshLib
@@ -18,6 +18,7 @@
 #include <vector>
 
 #include "PointWithID.h"
+#include "NodeElements.h"
 #include "Mesh.h"
 #include "MshEditor.h"
 
@@ -50,8 +51,13 @@ public:
 	/// Get an element the node is part of.
 	const Element* getElement(unsigned idx) const { return _elements[idx]; };
 
-	/// Get all elements the node is part of.
-	const std::vector<Element*>& getElements() const { return _elements; };
+	/**
+	 * Get all elements the node is part of. The range refers to the node-element
+	 * adjacency of the mesh (it used to be a std::vector<Element*>), it supports
+	 * size(), operator[] and begin()/end(). The range is valid as long as the mesh
+	 * is not changed, e.g. by Mesh::addElement(), copy it to keep the elements.
+	 */
+	const NodeElements& getElements() const { return _elements; };
 
 	/// Get number of elements the node is part of.
 	size_t getNElements() const { return _elements.size(); };
@@ -61,10 +67,10 @@ public:
 
 protected:
 	/**
-	 * Add an element the node is part of.
-	 * This method is called by Mesh::addElement(Element*), see friend definition.
+	 * Sets the elements the node is part of.
+	 * This method is called by Mesh::setElementInformationForNodes(), see friend definition.
 	 */
-	void addElement(Element* elem) { _elements.push_back(elem); };
+	void setElements(NodeElements const& elements) { _elements = elements; };
 
 	/// Sets the ID of a node to the given value.
 	void setID(unsigned id) { this->_id = id; };
@@ -72,8 +78,8 @@ protected:
 	/// Update coordinates of a node.
 	/// This method automatically also updates the areas/volumes of all connected elements.
 	virtual void updateCoordinates(double x, double y, double z);
-	
-	std::vector<Element*> _elements;
+
+	NodeElements _elements;
 
 }; /* class */
 
@@ -0,0 +1,124 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file NodeElements.h
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#ifndef NODEELEMENTS_H_
+#define NODEELEMENTS_H_
+
+#include <cstddef>
+#include <iterator>
+
+namespace MeshLib {
+
+class Element;
+
+/**
+ * Class NodeElements is a read-only range of the elements a node is part
+ * of. It refers to a part of the node-element adjacency of the mesh topology
+ * (the element indices) and to the element array of the mesh, i.e. it does
+ * not own memory. The range is valid as long as the mesh is not changed.
+ *
+ * Like the std::vector<Element*> it replaces, the range provides random
+ * access iterators, i.e. the elements can be copied into a vector
+ * (std::vector<Element*> v(range.begin(), range.end())) or processed by
+ * the algorithms of the standard library.
+ */
+class NodeElements
+{
+public:
+	/** random access iterator over the elements, it is invalidated together with the range */
+	class const_iterator
+	{
+	public:
+		typedef std::random_access_iterator_tag iterator_category;
+		typedef Element* value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef Element* const* pointer;
+		typedef Element* const& reference;
+
+		const_iterator() : _elements(NULL), _index(NULL) {}
+		const_iterator(Element* const* elements, unsigned const* index) :
+			_elements(elements), _index(index)
+		{}
+
+		reference operator*() const { return _elements[*_index]; }
+		pointer operator->() const { return &_elements[*_index]; }
+		reference operator[](difference_type i) const { return _elements[_index[i]]; }
+
+		const_iterator& operator++() { ++_index; return *this; }
+		const_iterator operator++(int) { const_iterator it(*this); ++_index; return it; }
+		const_iterator& operator--() { --_index; return *this; }
+		const_iterator operator--(int) { const_iterator it(*this); --_index; return it; }
+		const_iterator& operator+=(difference_type i) { _index += i; return *this; }
+		const_iterator& operator-=(difference_type i) { _index -= i; return *this; }
+		const_iterator operator+(difference_type i) const { return const_iterator(_elements, _index + i); }
+		const_iterator operator-(difference_type i) const { return const_iterator(_elements, _index - i); }
+		difference_type operator-(const_iterator const& it) const { return _index - it._index; }
+
+		bool operator==(const_iterator const& it) const { return _index == it._index; }
+		bool operator!=(const_iterator const& it) const { return _index != it._index; }
+		bool operator<(const_iterator const& it) const { return _index < it._index; }
+		bool operator>(const_iterator const& it) const { return _index > it._index; }
+		bool operator<=(const_iterator const& it) const { return _index <= it._index; }
+		bool operator>=(const_iterator const& it) const { return _index >= it._index; }
+
+	private:
+		Element* const* _elements;
+		unsigned const* _index;
+	};
+	typedef const_iterator iterator;
+	typedef Element* value_type;
+	typedef std::size_t size_type;
+
+	/// an empty range
+	NodeElements() :
+		_elements(NULL), _indices(NULL), _n(0)
+	{}
+
+	/**
+	 * @param elements the element array of the mesh
+	 * @param indices the indices of the elements of the node
+	 * @param n the number of elements of the node
+	 */
+	NodeElements(Element* const* elements, unsigned const* indices, std::size_t n) :
+		_elements(elements), _indices(indices), _n(n)
+	{}
+
+	/** @return the number of elements */
+	std::size_t size() const { return _n; }
+
+	/** @return true if the node is not part of any element */
+	bool empty() const { return _n == 0; }
+
+	/** @return an iterator to the first element */
+	const_iterator begin() const { return const_iterator(_elements, _indices); }
+
+	/** @return an iterator past the last element */
+	const_iterator end() const { return const_iterator(_elements, _indices + _n); }
+
+	/** @return the i-th element */
+	Element* operator[](std::size_t i) const { return _elements[_indices[i]]; }
+
+	/** @return the mesh index of the i-th element */
+	unsigned getIndex(std::size_t i) const { return _indices[i]; }
+
+	/** @return the mesh indices of the elements (ascending) */
+	unsigned const* getIndices() const { return _indices; }
+
+private:
+	Element* const* _elements;
+	unsigned const* _indices;
+	std::size_t _n;
+};
+
+} // end namespace MeshLib
+
+#endif /* NODEELEMENTS_H_ */
@@ -0,0 +1,150 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ * \file BatchedGaussBenchmark.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+
+#include "LinAlg/Dense/Matrix.h"
+#include "LinAlg/Solvers/GaussAlgorithm.h"
+#include "LinAlg/Solvers/BatchedGaussAlgorithm.h"
+
+// BaseLib
+#include "RunTime.h"
+#include "CPUTime.h"
+// BaseLib/logog
+#include "logog.hpp"
+#include "formatter.hpp"
+// BaseLib/tclap
+#include "tclap/CmdLine.h"
+
+#ifdef OGS_BUILD_INFO
+#include "BuildInfo.h"
+#endif
+
+/**
+ * new formatter for logog
+ */
+class FormatterCustom : public logog::FormatterGCC
+{
+    virtual TOPIC_FLAGS GetTopicFlags( const logog::Topic &topic )
+    {
+        return ( Formatter::GetTopicFlags( topic ) &
+                 ~( TOPIC_FILE_NAME_FLAG | TOPIC_LINE_NUMBER_FLAG ));
+    }
+};
+
+int main(int argc, char *argv[])
+{
+	LOGOG_INITIALIZE();
+
+	TCLAP::CmdLine cmd("Benchmark of batched small dense solves compared to GaussAlgorithm applied in a loop", ' ', "0.1");
+
+	TCLAP::ValueArg<unsigned> n_matrices_arg("m", "number-of-matrices", "number of linear systems of every size", false, 100000, "number");
+	cmd.add( n_matrices_arg );
+
+	TCLAP::ValueArg<unsigned> max_size_arg("n", "max-size", "largest size of the linear systems", false, 30, "number");
+	cmd.add( max_size_arg );
+
+	cmd.parse( argc, argv );
+
+	const std::size_t n_matrices(n_matrices_arg.getValue());
+	const unsigned max_size(max_size_arg.getValue());
+
+	FormatterCustom *custom_format (new FormatterCustom);
+	logog::Cout *logogCout(new logog::Cout);
+	logogCout->SetFormatter(*custom_format);
+
+#ifdef OGS_BUILD_INFO
+	INFO("%s was build with compiler %s", argv[0], CMAKE_CXX_COMPILER);
+	if (std::string(CMAKE_BUILD_TYPE).compare("Release") == 0) {
+		INFO("CXX_FLAGS: %s %s", CMAKE_CXX_FLAGS, CMAKE_CXX_FLAGS_RELEASE);
+	} else {
+		INFO("CXX_FLAGS: %s %s", CMAKE_CXX_FLAGS, CMAKE_CXX_FLAGS_DEBUG);
+	}
+#endif
+
+	const unsigned sizes[] = {2, 3, 4, 6, 8, 12, 16, 24, 30};
+	const unsigned n_sizes(sizeof(sizes) / sizeof(unsigned));
+
+	INFO("%4s %10s %14s %14s %10s %12s", "n", "matrices", "loop time [s]", "batch time [s]", "speedup", "max diff");
+
+	BaseLib::RunTime timer;
+	for (unsigned s(0); s < n_sizes && sizes[s] <= max_size; s++) {
+		const std::size_t n(sizes[s]);
+
+		// random, diagonally dominant matrices, right hand sides for the solution x = 1
+		double* mats(new double[n_matrices * n * n]);
+		double* rhs(new double[n_matrices * n]);
+		for (std::size_t e(0); e < n_matrices; e++) {
+			double* a(mats + e * n * n);
+			for (std::size_t k(0); k < n * n; k++)
+				a[k] = static_cast<double>(rand()) / RAND_MAX - 0.5;
+			for (std::size_t i(0); i < n; i++) {
+				a[i * n + i] += static_cast<double>(n);
+				rhs[e * n + i] = 0.0;
+				for (std::size_t j(0); j < n; j++)
+					rhs[e * n + i] += a[i * n + j];
+			}
+		}
+
+		// GaussAlgorithm in a loop
+		double* x_loop(new double[n_matrices * n]);
+		std::copy(rhs, rhs + n_matrices * n, x_loop);
+		timer.start();
+		for (std::size_t e(0); e < n_matrices; e++) {
+			MathLib::Matrix<double> A(n, n);
+			std::copy(mats + e * n * n, mats + (e + 1) * n * n, A.getEntryArray());
+			MathLib::GaussAlgorithm lu(A);
+			lu.execute(x_loop + e * n);
+		}
+		timer.stop();
+		const double loop_time(timer.elapsed());
+
+		// batched factorization and solve
+		MathLib::BatchedGaussAlgorithm batched(n, n_matrices);
+		double* x_batch(new double[batched.getVectorSize()]);
+		std::fill(x_batch, x_batch + batched.getVectorSize(), 0.0);
+		for (std::size_t e(0); e < n_matrices; e++) {
+			batched.setMatrix(e, mats + e * n * n);
+			for (std::size_t i(0); i < n; i++)
+				x_batch[batched.getVectorIndex(e, i)] = rhs[e * n + i];
+		}
+		timer.start();
+		if (!batched.factorize())
+			WARN("some matrices are singular");
+		batched.execute(x_batch);
+		timer.stop();
+		const double batch_time(timer.elapsed());
+
+		double diff(0.0);
+		for (std::size_t e(0); e < n_matrices; e++) {
+			for (std::size_t i(0); i < n; i++) {
+				diff = std::max(diff, fabs(x_loop[e * n + i] - 1.0));
+				diff = std::max(diff, fabs(x_batch[batched.getVectorIndex(e, i)] - 1.0));
+			}
+		}
+
+		INFO("%4d %10d %14.4f %14.4f %10.2f %12.3e", n, n_matrices, loop_time, batch_time,
+			loop_time / batch_time, diff);
+
+		delete [] x_batch;
+		delete [] x_loop;
+		delete [] rhs;
+		delete [] mats;
+	}
+
+	delete custom_format;
+	delete logogCout;
+	LOGOG_SHUTDOWN();
+
+	return 0;
+}
@@ -0,0 +1,238 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ * \file DenseMatrixKernels.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+
+#include "LinAlg/Dense/Matrix.h"
+#include "LinAlg/Solvers/GaussAlgorithm.h"
+
+// BaseLib
+#include "RunTime.h"
+#include "CPUTime.h"
+// BaseLib/logog
+#include "logog.hpp"
+#include "formatter.hpp"
+// BaseLib/tclap
+#include "tclap/CmdLine.h"
+
+#ifdef OGS_BUILD_INFO
+#include "BuildInfo.h"
+#endif
+
+/**
+ * new formatter for logog
+ */
+class FormatterCustom : public logog::FormatterGCC
+{
+    virtual TOPIC_FLAGS GetTopicFlags( const logog::Topic &topic )
+    {
+        return ( Formatter::GetTopicFlags( topic ) &
+                 ~( TOPIC_FILE_NAME_FLAG | TOPIC_LINE_NUMBER_FLAG ));
+    }
+};
+
+/** reference implementation: naive triple loop C = A B */
+void naiveMatMult(MathLib::Matrix<double> const& A, MathLib::Matrix<double> const& B,
+		MathLib::Matrix<double> & C)
+{
+	const size_t n(A.getNRows()), m(B.getNCols()), l(A.getNCols());
+	double const*const a(A.getEntryArray());
+	double const*const b(B.getEntryArray());
+	double *c(C.getEntryArray());
+	for (size_t i = 0; i < n; i++) {
+		for (size_t j = 0; j < m; j++) {
+			double t(0.0);
+			for (size_t k = 0; k < l; k++)
+				t += a[i*l+k] * b[k*m+j];
+			c[i*m+j] = t;
+		}
+	}
+}
+
+/** reference implementation: unblocked LU factorization with partial pivoting */
+void naiveLU(MathLib::Matrix<double> &A)
+{
+	const size_t n(A.getNRows());
+	double *a(A.getEntryArray());
+	for (size_t k = 0; k < n; k++) {
+		size_t p(k);
+		for (size_t i = k+1; i < n; i++)
+			if (fabs(a[i*n+k]) > fabs(a[p*n+k]))
+				p = i;
+		if (p != k)
+			for (size_t j = 0; j < n; j++)
+				std::swap(a[k*n+j], a[p*n+j]);
+		for (size_t i = k+1; i < n; i++) {
+			const double l(a[i*n+k] / a[k*n+k]);
+			for (size_t j = k+1; j < n; j++)
+				a[i*n+j] -= l * a[k*n+j];
+			a[i*n+k] = l;
+		}
+	}
+}
+
+void fillRandom(MathLib::Matrix<double> &A, bool diag_dominant)
+{
+	const size_t n(A.getNRows()), m(A.getNCols());
+	double *a(A.getEntryArray());
+	for (size_t k = 0; k < n*m; k++)
+		a[k] = static_cast<double>(rand()) / RAND_MAX - 0.5;
+	if (diag_dominant)
+		for (size_t k = 0; k < std::min(n,m); k++)
+			a[k*m+k] += static_cast<double>(m);
+}
+
+double maxDiff(MathLib::Matrix<double> const& A, MathLib::Matrix<double> const& B)
+{
+	double const*const a(A.getEntryArray());
+	double const*const b(B.getEntryArray());
+	double diff(0.0);
+	for (size_t k = 0; k < A.getNRows()*A.getNCols(); k++)
+		diff = std::max(diff, fabs(a[k]-b[k]));
+	return diff;
+}
+
+/** repeats the operation until at least min_time seconds are elapsed */
+const double min_time(0.2);
+
+int main(int argc, char *argv[])
+{
+	LOGOG_INITIALIZE();
+
+	TCLAP::CmdLine cmd("Benchmark of the dense matrix kernels (GEMV, GEMM, LU factorization)", ' ', "0.1");
+
+	TCLAP::ValueArg<unsigned> max_size_arg("n", "max-size", "largest matrix size", false, 4000, "number");
+	cmd.add( max_size_arg );
+
+	TCLAP::ValueArg<unsigned> max_ref_size_arg("r", "max-reference-size", "largest matrix size for the naive reference implementations", false, 1000, "number");
+	cmd.add( max_ref_size_arg );
+
+	cmd.parse( argc, argv );
+
+	const unsigned max_size(max_size_arg.getValue());
+	const unsigned max_ref_size(max_ref_size_arg.getValue());
+
+	FormatterCustom *custom_format (new FormatterCustom);
+	logog::Cout *logogCout(new logog::Cout);
+	logogCout->SetFormatter(*custom_format);
+
+#ifdef OGS_BUILD_INFO
+	INFO("%s was build with compiler %s", argv[0], CMAKE_CXX_COMPILER);
+	if (std::string(CMAKE_BUILD_TYPE).compare("Release") == 0) {
+		INFO("CXX_FLAGS: %s %s", CMAKE_CXX_FLAGS, CMAKE_CXX_FLAGS_RELEASE);
+	} else {
+		INFO("CXX_FLAGS: %s %s", CMAKE_CXX_FLAGS, CMAKE_CXX_FLAGS_DEBUG);
+	}
+#endif
+
+	const unsigned sizes[] = {8, 16, 32, 64, 128, 256, 512, 1000, 2000, 4000};
+	const unsigned n_sizes(sizeof(sizes) / sizeof(unsigned));
+
+	INFO("%6s %12s %12s %12s %12s %12s %12s", "n", "GEMV GF/s", "GEMM GF/s", "naive GF/s",
+		"LU GF/s", "naive LU", "max diff");
+
+	BaseLib::RunTime timer;
+	for (unsigned s(0); s < n_sizes && sizes[s] <= max_size; s++) {
+		const size_t n(sizes[s]);
+		MathLib::Matrix<double> A(n, n), B(n, n), C(n, n), C_ref(n, n, 0.0);
+		fillRandom(A, true);
+		fillRandom(B, false);
+		double *x(new double[n]);
+		double *y(new double[n]);
+		for (size_t k(0); k < n; k++)
+			x[k] = 1.0 / (k+1);
+
+		// GEMV
+		unsigned reps(0);
+		timer.start();
+		do {
+			A.amux(1.0, x, y);
+			reps++;
+			timer.stop();
+		} while (timer.elapsed() < min_time);
+		const double gemv_gflops(2.0 * n * n * reps / timer.elapsed() * 1e-9);
+
+		// blocked GEMM
+		reps = 0;
+		timer.start();
+		do {
+			A.multiply(B, C);
+			reps++;
+			timer.stop();
+		} while (timer.elapsed() < min_time);
+		const double gemm_gflops(2.0 * n * n * n * reps / timer.elapsed() * 1e-9);
+
+		// naive GEMM
+		double naive_gflops(0.0), diff(0.0);
+		if (n <= max_ref_size) {
+			reps = 0;
+			timer.start();
+			do {
+				naiveMatMult(A, B, C_ref);
+				reps++;
+				timer.stop();
+			} while (timer.elapsed() < min_time);
+			naive_gflops = 2.0 * n * n * n * reps / timer.elapsed() * 1e-9;
+			diff = maxDiff(C, C_ref);
+		}
+
+		// blocked LU (GaussAlgorithm)
+		reps = 0;
+		double lu_time(0.0);
+		do {
+			MathLib::Matrix<double> LU(A);
+			timer.start();
+			MathLib::GaussAlgorithm lu(LU);
+			timer.stop();
+			lu_time += timer.elapsed();
+			reps++;
+		} while (lu_time < min_time);
+		const double lu_gflops(2.0 / 3.0 * n * n * n * reps / lu_time * 1e-9);
+
+		// naive LU
+		double naive_lu_gflops(0.0);
+		if (n <= max_ref_size) {
+			reps = 0;
+			lu_time = 0.0;
+			do {
+				MathLib::Matrix<double> LU(A);
+				timer.start();
+				naiveLU(LU);
+				timer.stop();
+				lu_time += timer.elapsed();
+				reps++;
+			} while (lu_time < min_time);
+			naive_lu_gflops = 2.0 / 3.0 * n * n * n * reps / lu_time * 1e-9;
+		}
+
+		// check the solution of the blocked LU
+		MathLib::Matrix<double> LU(A);
+		MathLib::GaussAlgorithm lu(LU);
+		A.amux(1.0, x, y);
+		lu.execute(y);
+		for (size_t k(0); k < n; k++)
+			diff = std::max(diff, fabs(y[k] - x[k]));
+
+		INFO("%6d %12.3f %12.3f %12.3f %12.3f %12.3f %12.3e", n, gemv_gflops, gemm_gflops,
+			naive_gflops, lu_gflops, naive_lu_gflops, diff);
+
+		delete [] x;
+		delete [] y;
+	}
+
+	delete custom_format;
+	delete logogCout;
+	LOGOG_SHUTDOWN();
+
+	return 0;
+}
@@ -0,0 +1,279 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ * \file FixedMatrixCheck.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+
+#include "LinAlg/Dense/Matrix.h"
+#include "LinAlg/Dense/FixedMatrix.h"
+#include "LinAlg/Solvers/GaussAlgorithm.h"
+
+// BaseLib/logog
+#include "logog.hpp"
+#include "formatter.hpp"
+// BaseLib/tclap
+#include "tclap/CmdLine.h"
+
+/**
+ * new formatter for logog
+ */
+class FormatterCustom : public logog::FormatterGCC
+{
+    virtual TOPIC_FLAGS GetTopicFlags( const logog::Topic &topic )
+    {
+        return ( Formatter::GetTopicFlags( topic ) &
+                 ~( TOPIC_FILE_NAME_FLAG | TOPIC_LINE_NUMBER_FLAG ));
+    }
+};
+
+/** relative tolerance for the comparisons */
+const double tol(1e-12);
+
+double random(double scale)
+{
+	return scale * (static_cast<double>(rand()) / RAND_MAX - 0.5);
+}
+
+/** fills the matrix with random entries, the diagonal is enlarged by diag_shift */
+template <std::size_t R, std::size_t C>
+void fillRandom(MathLib::FixedMatrix<double, R, C> &A, double diag_shift)
+{
+	for (std::size_t i(0); i < R; i++)
+		for (std::size_t j(0); j < C; j++)
+			A(i, j) = random(1.0) + ((i == j) ? diag_shift : 0.0);
+}
+
+template <std::size_t R, std::size_t C>
+double maxDiff(MathLib::FixedMatrix<double, R, C> const& A, MathLib::FixedMatrix<double, R, C> const& B)
+{
+	double diff(0.0);
+	for (std::size_t i(0); i < R; i++)
+		for (std::size_t j(0); j < C; j++)
+			diff = std::max(diff, fabs(A(i, j) - B(i, j)));
+	return diff;
+}
+
+/** reference determinant: LU factorization with partial pivoting of a MathLib::Matrix */
+double referenceDeterminant(MathLib::Matrix<double> A)
+{
+	const std::size_t n(A.getNRows());
+	double det(1.0);
+	for (std::size_t k(0); k < n; k++) {
+		std::size_t p(k);
+		for (std::size_t i(k + 1); i < n; i++)
+			if (fabs(A(i, k)) > fabs(A(p, k)))
+				p = i;
+		if (p != k) {
+			for (std::size_t j(0); j < n; j++)
+				std::swap(A(k, j), A(p, j));
+			det = -det;
+		}
+		det *= A(k, k);
+		if (A(k, k) == 0.0)
+			return 0.0;
+		for (std::size_t i(k + 1); i < n; i++) {
+			const double l(A(i, k) / A(k, k));
+			for (std::size_t j(k + 1); j < n; j++)
+				A(i, j) -= l * A(k, j);
+		}
+	}
+	return det;
+}
+
+/**
+ * checks determinant() and invert() of random N x N matrices against the
+ * MathLib::Matrix / GaussAlgorithm reference, invert(A, A) and the detection
+ * of singular matrices
+ */
+template <std::size_t N>
+bool checkInverse(unsigned n_trials)
+{
+	const int n(N); // for the output
+	bool ok(true);
+	double max_det_err(0.0), max_inv_err(0.0);
+	for (unsigned t(0); t < n_trials; t++) {
+		// every other matrix is not diagonally dominant, pivoting is necessary
+		MathLib::FixedMatrix<double, N, N> A;
+		fillRandom(A, (t % 2 == 0) ? static_cast<double>(N) : 0.0);
+		MathLib::Matrix<double> A_ref(N, N);
+		for (std::size_t i(0); i < N; i++)
+			for (std::size_t j(0); j < N; j++)
+				A_ref(i, j) = A(i, j);
+
+		const double det(MathLib::determinant(A));
+		const double det_ref(referenceDeterminant(A_ref));
+		max_det_err = std::max(max_det_err, fabs(det - det_ref) / fabs(det_ref));
+
+		MathLib::FixedMatrix<double, N, N> A_inv;
+		if (!MathLib::invert(A, A_inv)) {
+			ERR("%dx%d: invert() reports a regular matrix as singular", n, n);
+			ok = false;
+			continue;
+		}
+		// column j of the reference inverse is the solution of A x = e_j
+		MathLib::GaussAlgorithm gauss(A_ref);
+		double inv_norm(0.0), inv_err(0.0);
+		for (std::size_t j(0); j < N; j++) {
+			double e[N];
+			for (std::size_t i(0); i < N; i++)
+				e[i] = (i == j) ? 1.0 : 0.0;
+			gauss.execute(e);
+			for (std::size_t i(0); i < N; i++) {
+				inv_norm = std::max(inv_norm, fabs(e[i]));
+				inv_err = std::max(inv_err, fabs(A_inv(i, j) - e[i]));
+			}
+		}
+		max_inv_err = std::max(max_inv_err, inv_err / inv_norm);
+
+		// in place inversion
+		MathLib::FixedMatrix<double, N, N> B(A);
+		MathLib::invert(B, B);
+		if (maxDiff(B, A_inv) != 0.0) {
+			ERR("%dx%d: invert(A, A) differs from invert(A, B)", n, n);
+			ok = false;
+		}
+	}
+
+	// a matrix with a zero row is singular
+	MathLib::FixedMatrix<double, N, N> S;
+	fillRandom(S, 0.0);
+	for (std::size_t j(0); j < N; j++)
+		S(N / 2, j) = 0.0;
+	MathLib::FixedMatrix<double, N, N> S_inv;
+	if (MathLib::determinant(S) != 0.0 || MathLib::invert(S, S_inv)) {
+		ERR("%dx%d: singular matrix not detected", n, n);
+		ok = false;
+	}
+
+	INFO("%dx%d: max. rel. error determinant %e, inverse %e", n, n, max_det_err, max_inv_err);
+	if (max_det_err > tol || max_inv_err > tol) {
+		ERR("%dx%d: determinant or inverse differ from the reference", n, n);
+		ok = false;
+	}
+	return ok;
+}
+
+/**
+ * checks the batched operations against the operations on single matrices
+ */
+bool checkBatch(std::size_t n)
+{
+	bool ok(true);
+	MathLib::FixedMatrixBatch<double, 2, 2> A2(n), A2_inv(n);
+	MathLib::FixedMatrixBatch<double, 3, 3> A3(n), A3_inv(n);
+	MathLib::FixedMatrixBatch<double, 3, 2> B(n);
+	MathLib::FixedMatrixBatch<double, 2, 4> C(n);
+	MathLib::FixedMatrixBatch<double, 3, 4> BC(n), D(n);
+	MathLib::FixedMatrixBatch<double, 2, 4> BtD(n);
+	double* det2(new double[n]);
+	double* det3(new double[n]);
+	double* w(new double[n]);
+	for (std::size_t e(0); e < n; e++) {
+		MathLib::FixedMatrix<double, 2, 2> a2; fillRandom(a2, 2.0); A2.set(e, a2);
+		MathLib::FixedMatrix<double, 3, 3> a3; fillRandom(a3, 3.0); A3.set(e, a3);
+		MathLib::FixedMatrix<double, 3, 2> b; fillRandom(b, 0.0); B.set(e, b);
+		MathLib::FixedMatrix<double, 2, 4> c; fillRandom(c, 0.0); C.set(e, c);
+		MathLib::FixedMatrix<double, 3, 4> d; fillRandom(d, 0.0); D.set(e, d);
+		w[e] = random(2.0);
+	}
+	BtD.setZero();
+
+	MathLib::invert(A2, A2_inv, det2);
+	MathLib::invert(A3, A3_inv, det3);
+	MathLib::multiply(B, C, BC);
+	MathLib::addTransposedProduct(w, B, D, BtD);
+
+	double err_inv(0.0), err_det(0.0), err_mult(0.0);
+	for (std::size_t e(0); e < n; e++) {
+		MathLib::FixedMatrix<double, 2, 2> a2, a2_inv, a2_inv_batch;
+		A2.get(e, a2);
+		A2_inv.get(e, a2_inv_batch);
+		MathLib::invert(a2, a2_inv);
+		err_inv = std::max(err_inv, maxDiff(a2_inv, a2_inv_batch));
+		err_det = std::max(err_det, fabs(MathLib::determinant(a2) - det2[e]));
+
+		MathLib::FixedMatrix<double, 3, 3> a3, a3_inv, a3_inv_batch;
+		A3.get(e, a3);
+		A3_inv.get(e, a3_inv_batch);
+		MathLib::invert(a3, a3_inv);
+		err_inv = std::max(err_inv, maxDiff(a3_inv, a3_inv_batch));
+		err_det = std::max(err_det, fabs(MathLib::determinant(a3) - det3[e]));
+
+		MathLib::FixedMatrix<double, 3, 2> b;
+		MathLib::FixedMatrix<double, 2, 4> c, btd, btd_batch(0.0);
+		MathLib::FixedMatrix<double, 3, 4> d, bc, bc_batch;
+		B.get(e, b); C.get(e, c); D.get(e, d);
+		b.multiply(c, bc);
+		BC.get(e, bc_batch);
+		err_mult = std::max(err_mult, maxDiff(bc, bc_batch));
+		btd = MathLib::FixedMatrix<double, 2, 4>(0.0);
+		b.addTransposedProduct(w[e], d, btd);
+		BtD.get(e, btd_batch);
+		err_mult = std::max(err_mult, maxDiff(btd, btd_batch));
+	}
+
+	// in place batched inversion
+	MathLib::invert(A3, A3, det3);
+	double err_in_place(0.0);
+	for (std::size_t e(0); e < n; e++)
+		for (std::size_t i(0); i < 3; i++)
+			for (std::size_t j(0); j < 3; j++)
+				err_in_place = std::max(err_in_place, fabs(A3(e, i, j) - A3_inv(e, i, j)));
+
+	INFO("batch of %d matrices: max. difference to the single matrix operations: inverse %e, determinant %e, products %e, in place inverse %e",
+		static_cast<int>(n), err_inv, err_det, err_mult, err_in_place);
+	if (err_inv > tol || err_det > tol || err_mult > tol || err_in_place != 0.0) {
+		ERR("the batched operations differ from the single matrix operations");
+		ok = false;
+	}
+
+	delete [] det2;
+	delete [] det3;
+	delete [] w;
+	return ok;
+}
+
+int main(int argc, char *argv[])
+{
+	LOGOG_INITIALIZE();
+
+	TCLAP::CmdLine cmd("Checks determinant, inverse and the batched operations of FixedMatrix", ' ', "0.1");
+
+	TCLAP::ValueArg<unsigned> n_trials_arg("t", "trials", "number of random matrices per size", false, 100, "number");
+	cmd.add( n_trials_arg );
+
+	TCLAP::ValueArg<unsigned> batch_size_arg("b", "batch-size", "number of matrices in a batch", false, 1000, "number");
+	cmd.add( batch_size_arg );
+
+	cmd.parse( argc, argv );
+
+	FormatterCustom *custom_format (new FormatterCustom);
+	logog::Cout *logogCout(new logog::Cout);
+	logogCout->SetFormatter(*custom_format);
+
+	const unsigned n_trials(n_trials_arg.getValue());
+	bool ok(true);
+	ok = checkInverse<2>(n_trials) && ok;
+	ok = checkInverse<3>(n_trials) && ok;
+	ok = checkInverse<4>(n_trials) && ok;
+	ok = checkInverse<6>(n_trials) && ok;
+	ok = checkBatch(batch_size_arg.getValue()) && ok;
+
+	if (ok)
+		INFO("all checks passed");
+
+	delete custom_format;
+	delete logogCout;
+	LOGOG_SHUTDOWN();
+
+	return ok ? 0 : 1;
+}
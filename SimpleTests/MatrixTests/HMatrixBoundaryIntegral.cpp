@@ -0,0 +1,243 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ * \file HMatrixBoundaryIntegral.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+
+#include "LinAlg/HMatrix/HMatrix.h"
+#include "LinAlg/HMatrix/MatrixEntryGenerator.h"
+#include "LinAlg/Solvers/GMRes.h"
+
+// BaseLib
+#include "RunTime.h"
+// BaseLib/logog
+#include "logog.hpp"
+#include "formatter.hpp"
+// BaseLib/tclap
+#include "tclap/CmdLine.h"
+
+/**
+ * new formatter for logog
+ */
+class FormatterCustom : public logog::FormatterGCC
+{
+    virtual TOPIC_FLAGS GetTopicFlags( const logog::Topic &topic )
+    {
+        return ( Formatter::GetTopicFlags( topic ) &
+                 ~( TOPIC_FILE_NAME_FLAG | TOPIC_LINE_NUMBER_FLAG ));
+    }
+};
+
+/**
+ * Single layer potential of the Laplacian on a circle discretized by
+ * piecewise constant functions and collocation in the midpoints of n
+ * panels: A_ij = -h log|x_i - x_j| for i != j and the integral over the
+ * own panel on the diagonal.
+ */
+class SingleLayerCircle : public MathLib::MatrixEntryGenerator
+{
+public:
+	SingleLayerCircle(unsigned n, double radius) :
+		_n(n), _h(2.0 * M_PI * radius / n), _x(new double[n]), _y(new double[n])
+	{
+		for (unsigned i(0); i < n; i++) {
+			const double phi(2.0 * M_PI * (i + 0.5) / n);
+			_x[i] = radius * cos(phi);
+			_y[i] = radius * sin(phi);
+		}
+	}
+
+	~SingleLayerCircle()
+	{
+		delete [] _x;
+		delete [] _y;
+	}
+
+	double operator() (unsigned i, unsigned j) const
+	{
+		if (i == j)
+			return _h * (1.0 - log(_h / 2.0));
+		const double dx(_x[i] - _x[j]), dy(_y[i] - _y[j]);
+		return -0.5 * _h * log(dx * dx + dy * dy);
+	}
+
+	/** y = A x, the entries are computed on the fly */
+	void amux(double const*const x, double* y) const
+	{
+		const OPENMP_LOOP_TYPE n(_n);
+		OPENMP_LOOP_TYPE i;
+		#pragma omp parallel for
+		for (i = 0; i < n; i++) {
+			double s(0.0);
+			for (unsigned j(0); j < _n; j++)
+				s += (*this)(i, j) * x[j];
+			y[i] = s;
+		}
+	}
+
+private:
+	const unsigned _n;
+	const double _h;
+	double* const _x;
+	double* const _y;
+};
+
+/** the accurate hierarchical matrix, preconditioned by a coarse one */
+class PreconditionedHMatrix : public MathLib::LinearOperator<double>
+{
+public:
+	PreconditionedHMatrix(MathLib::HMatrix const& A, MathLib::HMatrix const& P) :
+		MathLib::LinearOperator<double>(A.getNRows(), A.getNCols()), _A(A), _P(P)
+	{}
+
+	void amux(double d, double const * const __restrict__ x, double * __restrict__ y) const
+	{
+		_A.amux(d, x, y);
+	}
+
+	void precondApply(double* x) const
+	{
+		_P.precondApply(x);
+	}
+
+private:
+	MathLib::HMatrix const& _A;
+	MathLib::HMatrix const& _P;
+};
+
+double maxNorm(unsigned n, double const*const x)
+{
+	double m(0.0);
+	for (unsigned i(0); i < n; i++)
+		m = std::max(m, fabs(x[i]));
+	return m;
+}
+
+int main(int argc, char *argv[])
+{
+	LOGOG_INITIALIZE();
+
+	TCLAP::CmdLine cmd("Hierarchical matrix approximation of a boundary integral operator", ' ', "0.1");
+
+	TCLAP::ValueArg<unsigned> n_arg("n", "panels", "number of boundary panels", false, 4000, "number");
+	cmd.add( n_arg );
+
+	TCLAP::ValueArg<double> eps_arg("e", "eps", "accuracy of the low rank blocks", false, 1e-8, "number");
+	cmd.add( eps_arg );
+
+	TCLAP::ValueArg<unsigned> leaf_arg("l", "leaf-size", "maximal size of the leaves of the cluster tree", false, 64, "number");
+	cmd.add( leaf_arg );
+
+	TCLAP::ValueArg<std::string> method_arg("c", "compression", "compression of the blocks: aca or svd", false, "aca", "string");
+	cmd.add( method_arg );
+
+	TCLAP::ValueArg<double> precond_eps_arg("p", "precond-eps", "accuracy of the hierarchical matrix used as preconditioner", false, 1e-3, "number");
+	cmd.add( precond_eps_arg );
+
+	cmd.parse( argc, argv );
+
+	FormatterCustom *custom_format (new FormatterCustom);
+	logog::Cout *logogCout(new logog::Cout);
+	logogCout->SetFormatter(*custom_format);
+
+	const unsigned n(n_arg.getValue());
+	const MathLib::HMatrix::CompressionMethod method(
+			method_arg.getValue() == "svd" ? MathLib::HMatrix::SVD : MathLib::HMatrix::ACA);
+	SingleLayerCircle A(n, 0.25);
+
+	BaseLib::RunTime timer;
+	timer.start();
+	MathLib::HMatrix H(A, n, leaf_arg.getValue(), eps_arg.getValue(), method);
+	timer.stop();
+	INFO("hierarchical matrix: %d dense blocks, %d low rank blocks (max rank %d), %.1f%% of the dense storage, setup %e s",
+			H.getNDenseBlocks(), H.getNLowRankBlocks(), H.getMaxRank(),
+			100.0 * H.getNStoredEntries() / (static_cast<double>(n) * n), timer.elapsed());
+
+	// accuracy and speed of the matrix vector product
+	double* x(new double[n]);
+	double* y(new double[n]);
+	double* y_ref(new double[n]);
+	srand(42);
+	for (unsigned i(0); i < n; i++)
+		x[i] = rand() / static_cast<double>(RAND_MAX) - 0.5;
+	timer.start();
+	A.amux(x, y_ref);
+	timer.stop();
+	const double t_dense(timer.elapsed());
+	timer.start();
+	H.amux(1.0, x, y);
+	timer.stop();
+	for (unsigned i(0); i < n; i++)
+		y[i] -= y_ref[i];
+	const double amux_err(maxNorm(n, y) / maxNorm(n, y_ref));
+	INFO("amux: relative error %e, %e s (dense product on the fly %e s)",
+			amux_err, timer.elapsed(), t_dense);
+
+	bool ok(amux_err < 100.0 * eps_arg.getValue());
+	if (!ok)
+		ERR("the error of the hierarchical matrix product is too large");
+
+	// the Fourier modes are eigenvectors of the operator on the circle, hence
+	// a random right hand side is used
+	double* b(new double[n]);
+	for (unsigned i(0); i < n; i++)
+		b[i] = rand() / static_cast<double>(RAND_MAX);
+
+	unsigned steps_plain(1000);
+	double eps(1e-10);
+	for (unsigned i(0); i < n; i++)
+		x[i] = 0.0;
+	timer.start();
+	MathLib::GMRes(H, b, x, eps, 30, steps_plain);
+	timer.stop();
+	INFO("GMRes(30): %d steps, residuum %e, %e s", steps_plain, eps, timer.elapsed());
+
+	timer.start();
+	MathLib::HMatrix P(A, n, leaf_arg.getValue(), precond_eps_arg.getValue(), method);
+	P.factorize();
+	timer.stop();
+	INFO("preconditioner (eps %e): %.1f%% of the dense storage, setup and factorization %e s",
+			precond_eps_arg.getValue(),
+			100.0 * P.getNStoredEntries() / (static_cast<double>(n) * n), timer.elapsed());
+
+	PreconditionedHMatrix HP(H, P);
+	unsigned steps_precond(1000);
+	eps = 1e-10;
+	for (unsigned i(0); i < n; i++)
+		y[i] = 0.0;
+	timer.start();
+	MathLib::GMRes(HP, b, y, eps, 30, steps_precond);
+	timer.stop();
+	INFO("GMRes(30) with hierarchical preconditioner: %d steps, residuum %e, %e s",
+			steps_precond, eps, timer.elapsed());
+
+	for (unsigned i(0); i < n; i++)
+		y[i] -= x[i];
+	const double sol_diff(maxNorm(n, y) / maxNorm(n, x));
+	INFO("relative difference of the solutions %e", sol_diff);
+	if (eps > 1e-10 || steps_precond > steps_plain || sol_diff > 1e-6) {
+		ERR("the preconditioned solver failed");
+		ok = false;
+	}
+
+	delete [] b;
+	delete [] x;
+	delete [] y;
+	delete [] y_ref;
+
+	delete custom_format;
+	delete logogCout;
+	LOGOG_SHUTDOWN();
+
+	return ok ? 0 : 1;
+}
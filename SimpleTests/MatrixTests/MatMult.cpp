@@ -18,10 +18,13 @@
 #include "LinAlg/Sparse/CRSMatrix.h"
 #include "LinAlg/Sparse/CRSMatrixOpenMP.h"
 #include "LinAlg/Sparse/CRSMatrixPThreads.h"
+#include "LinAlg/Sparse/amuxCRS.h"
+#include "LinAlg/firstTouch.h"
 
 // BaseLib
 #include "RunTime.h"
 #include "CPUTime.h"
+#include "ThreadPinning.h"
 // BaseLib/logog
 #include "logog.hpp"
 #include "formatter.hpp"
@@ -73,6 +76,9 @@ int main(int argc, char *argv[])
 	TCLAP::ValueArg<unsigned> n_mults_arg("n", "number-of-multiplications", "number of multiplications to perform", true, 10, "number");
 	cmd.add( n_mults_arg );
 
+	TCLAP::ValueArg<std::string> pinning_arg("t", "thread-pinning", "binding of the threads to the processors [none, compact, scatter]", false, "none", "string");
+	cmd.add( pinning_arg );
+
 	TCLAP::ValueArg<std::string> output_arg("o", "output", "output file", false, "", "string");
 	cmd.add( output_arg );
 
@@ -115,6 +121,14 @@ int main(int argc, char *argv[])
 	delete [] host_name_len;
 #endif
 
+#ifdef _OPENMP
+	// the threads have to be placed before the data is touched first
+	omp_set_num_threads(n_threads);
+	if (!BaseLib::pinOpenMPThreads(BaseLib::convertStringToThreadPinningStrategy(pinning_arg.getValue())))
+		WARN("could not pin threads");
+	INFO("thread placement: %s", BaseLib::getOpenMPThreadPlacement().c_str());
+#endif
+
 	// *** reading matrix in crs format from file
 	std::ifstream in(fname_mat.c_str(), std::ios::in | std::ios::binary);
 	double *A(NULL);
@@ -134,7 +148,6 @@ int main(int argc, char *argv[])
 	INFO("\tParameters read: n=%d, nnz=%d", n, nnz);
 
 #ifdef _OPENMP
-	omp_set_num_threads(n_threads);
 	unsigned *mat_entries_per_core(new unsigned[n_threads]);
 	for (unsigned k(0); k<n_threads; k++) {
 		mat_entries_per_core[k] = 0;
@@ -155,17 +168,13 @@ int main(int argc, char *argv[])
 #endif
 
 #ifdef _OPENMP
-	omp_set_num_threads(n_threads);
 	MathLib::CRSMatrixOpenMP<double, unsigned> mat (n, iA, jA, A);
 #else
 	MathLib::CRSMatrix<double, unsigned> mat (n, iA, jA, A);
 #endif
 
-	double *x(new double[n]);
-	double *y(new double[n]);
-
-	for (unsigned k(0); k<n; ++k)
-		x[k] = 1.0;
+	double *x(MathLib::newFirstTouch<double>(n, 1.0));
+	double *y(MathLib::newFirstTouch<double>(n));
 
 	INFO("*** %d matrix vector multiplications (MVM) with Toms amuxCRS (%d threads) ...", n_mults, n_threads);
 	BaseLib::RunTime run_timer;
@@ -179,6 +188,8 @@ int main(int argc, char *argv[])
 	run_timer.stop();
 
 	INFO("\t[MVM] - took %e sec cpu time, %e sec run time", cpu_timer.elapsed(), run_timer.elapsed());
+	INFO("\t[MVM] - memory bandwidth at least %f GB/s",
+			n_mults * MathLib::amuxCRSDataVolume<double, unsigned>(n, nnz) / run_timer.elapsed() * 1e-9);
 
 	delete [] x;
 	delete [] y;
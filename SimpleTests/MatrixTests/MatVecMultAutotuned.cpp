@@ -0,0 +1,112 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ * \file MatVecMultAutotuned.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <string>
+#include "LinAlg/Sparse/CRSMatrixAutotuned.h"
+
+// BaseLib
+#include "RunTime.h"
+#include "CPUTime.h"
+// BaseLib/logog
+#include "logog.hpp"
+#include "formatter.hpp"
+// BaseLib/tclap
+#include "tclap/CmdLine.h"
+
+#ifdef OGS_BUILD_INFO
+#include "BuildInfo.h"
+#endif
+
+/**
+ * new formatter for logog
+ */
+class FormatterCustom : public logog::FormatterGCC
+{
+    virtual TOPIC_FLAGS GetTopicFlags( const logog::Topic &topic )
+    {
+        return ( Formatter::GetTopicFlags( topic ) &
+                 ~( TOPIC_FILE_NAME_FLAG | TOPIC_LINE_NUMBER_FLAG ));
+    }
+};
+
+int main(int argc, char *argv[])
+{
+	LOGOG_INITIALIZE();
+
+	TCLAP::CmdLine cmd("Matrix vector multiplication with automatically selected kernel", ' ', "0.1");
+
+	TCLAP::ValueArg<std::string> matrix_arg("m", "matrix", "input matrix file", true, "", "string");
+	cmd.add( matrix_arg );
+
+	TCLAP::ValueArg<unsigned> n_mults_arg("n", "number-of-multiplications", "number of multiplications to perform", false, 100, "number");
+	cmd.add( n_mults_arg );
+
+	TCLAP::ValueArg<std::string> cache_arg("c", "cache", "file for caching the tuning results (no caching if not given)", false, "", "string");
+	cmd.add( cache_arg );
+
+	TCLAP::SwitchArg force_arg("f", "force", "benchmark the kernels even if a cached result exists");
+	cmd.add( force_arg );
+
+	cmd.parse( argc, argv );
+
+	FormatterCustom *custom_format (new FormatterCustom);
+	logog::Cout *logogCout(new logog::Cout);
+	logogCout->SetFormatter(*custom_format);
+
+#ifdef OGS_BUILD_INFO
+	INFO("%s was build with compiler %s", argv[0], CMAKE_CXX_COMPILER);
+	if (std::string(CMAKE_BUILD_TYPE).compare("Release") == 0) {
+		INFO("CXX_FLAGS: %s %s", CMAKE_CXX_FLAGS, CMAKE_CXX_FLAGS_RELEASE);
+	} else {
+		INFO("CXX_FLAGS: %s %s", CMAKE_CXX_FLAGS, CMAKE_CXX_FLAGS_DEBUG);
+	}
+#endif
+
+	// the constructor selects the kernel
+	BaseLib::RunTime run_timer;
+	run_timer.start();
+	MathLib::CRSMatrixAutotuned mat(matrix_arg.getValue(), cache_arg.getValue());
+	if (force_arg.getValue())
+		mat.tune(true);
+	run_timer.stop();
+	const unsigned n(mat.getNRows());
+	INFO("\tParameters read: n=%d, nnz=%d", n, mat.getNNZ());
+	INFO("\tfingerprint: %s", mat.getFingerprint().c_str());
+	INFO("*** selected kernel: %s with %d threads (reading and tuning took %e s)",
+		MathLib::CRSMatrixAutotuned::getKernelName(mat.getKernelType()).c_str(),
+		mat.getNThreads(), run_timer.elapsed());
+
+	double *x(new double[n]);
+	double *y(new double[n]);
+	for (unsigned k(0); k<n; ++k)
+		x[k] = 1.0;
+
+	const unsigned n_mults (n_mults_arg.getValue());
+	INFO("*** %d matrix vector multiplications (MVM) ...", n_mults);
+	BaseLib::CPUTime cpu_timer;
+	run_timer.start();
+	cpu_timer.start();
+	for (size_t k(0); k<n_mults; k++) {
+		mat.amux (1.0, x, y);
+	}
+	cpu_timer.stop();
+	run_timer.stop();
+	INFO("\t[MVM] - took %e sec cpu time, %e sec run time", cpu_timer.elapsed(), run_timer.elapsed());
+
+	delete [] x;
+	delete [] y;
+
+	delete custom_format;
+	delete logogCout;
+	LOGOG_SHUTDOWN();
+
+	return 0;
+}
@@ -30,6 +30,7 @@
 
 // MathLib
 #include "sparse.h"
+#include "LinAlg/Sparse/amuxCRS.h"
 
 #include "LinAlg/Sparse/NestedDissectionPermutation/AdjMat.h"
 #include "LinAlg/Sparse/NestedDissectionPermutation/CRSMatrixReordered.h"
@@ -193,6 +194,8 @@ int main(int argc, char *argv[])
 
 	if (verbose) {
 		INFO("\t[MVM] - took %e sec\t %e sec", cpu_timer.elapsed(), run_timer.elapsed());
+		INFO("\t[MVM] - memory bandwidth at least %f GB/s",
+				n_mults * MathLib::amuxCRSDataVolume<double, unsigned>(n, nnz) / run_timer.elapsed() * 1e-9);
 	}
 
 	delete [] x;
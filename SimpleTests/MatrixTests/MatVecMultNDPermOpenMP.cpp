@@ -14,6 +14,7 @@
 // BaseLib
 #include "RunTime.h"
 #include "CPUTime.h"
+#include "ThreadPinning.h"
 // BaseLib/tclap
 #include "tclap/CmdLine.h"
 // BaseLib/logog
@@ -22,6 +23,8 @@
 
 // MathLib
 #include "sparse.h"
+#include "LinAlg/firstTouch.h"
+#include "LinAlg/Sparse/amuxCRS.h"
 
 #include "LinAlg/Sparse/NestedDissectionPermutation/AdjMat.h"
 #include "LinAlg/Sparse/NestedDissectionPermutation/CRSMatrixReorderedOpenMP.h"
@@ -72,6 +75,9 @@ int main(int argc, char *argv[])
 	TCLAP::ValueArg<unsigned> n_mults_arg("n", "number-of-multiplications", "number of multiplications to perform", true, 10, "number of multiplications");
 	cmd.add( n_mults_arg );
 
+	TCLAP::ValueArg<std::string> pinning_arg("t", "thread-pinning", "binding of the threads to the processors [none, compact, scatter]", false, "none", "string");
+	cmd.add( pinning_arg );
+
 	TCLAP::ValueArg<std::string> output_arg("o", "output", "output file", false, "", "string");
 	cmd.add( output_arg );
 
@@ -109,6 +115,16 @@ int main(int argc, char *argv[])
 	delete [] hostname;
 #endif
 
+#ifdef _OPENMP
+	// the threads have to be placed before the data is touched first
+	omp_set_num_threads(n_threads);
+	if (!BaseLib::pinOpenMPThreads(BaseLib::convertStringToThreadPinningStrategy(pinning_arg.getValue())))
+		WARN("could not pin threads");
+	if (verbose) {
+		INFO("thread placement: %s", BaseLib::getOpenMPThreadPlacement().c_str());
+	}
+#endif
+
 	// *** reading matrix in crs format from file
 	std::ifstream in(fname_mat.c_str(), std::ios::in | std::ios::binary);
 	double *A(NULL);
@@ -134,7 +150,6 @@ int main(int argc, char *argv[])
 	}
 
 #ifdef _OPENMP
-	omp_set_num_threads(n_threads);
 	MathLib::CRSMatrixReorderedOpenMP mat(n, iA, jA, A);
 #else
 	delete [] iA;
@@ -143,11 +158,8 @@ int main(int argc, char *argv[])
 	ERROR("program is not using OpenMP");
 	return -1;
 #endif
-	double *x(new double[n]);
-	double *y(new double[n]);
-
-	for (unsigned k(0); k<n; ++k)
-		x[k] = 1.0;
+	double *x(MathLib::newFirstTouch<double>(n, 1.0));
+	double *y(MathLib::newFirstTouch<double>(n));
 
 	// create time measurement objects
 	BaseLib::RunTime run_timer;
@@ -198,6 +210,8 @@ int main(int argc, char *argv[])
 
 	if (verbose) {
 		INFO("\t[MVM] - took %e sec cpu time, %e sec run time", cpu_timer.elapsed(), run_timer.elapsed());
+		INFO("\t[MVM] - memory bandwidth at least %f GB/s",
+				n_mults * MathLib::amuxCRSDataVolume<double, unsigned>(n, nnz) / run_timer.elapsed() * 1e-9);
 	}
 
 	delete [] x;
@@ -15,6 +15,7 @@
 #include <limits>
 #include <cstdlib>
 #include "sparse.h"
+#include "LinAlg/Sparse/amuxCRS.h"
 #include "LinAlg/Sparse/CRSMatrix.h"
 #include "LinAlg/Sparse/CRSMatrixOpenMP.h"
 #include "LinAlg/Sparse/CRSMatrixPThreads.h"
@@ -153,6 +154,8 @@ int main(int argc, char *argv[])
 	run_timer.stop();
 
 	INFO("\t[MVM] - took %e sec cpu time, %e sec run time", cpu_timer.elapsed(), run_timer.elapsed());
+	INFO("\t[MVM] - memory bandwidth at least %f GB/s",
+			n_mults * MathLib::amuxCRSDataVolume<double, unsigned>(n, nnz) / run_timer.elapsed() * 1e-9);
 
 	delete [] x;
 	delete [] y;
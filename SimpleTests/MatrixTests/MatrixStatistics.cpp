@@ -0,0 +1,438 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ * \file MatrixStatistics.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "LinAlg/Dense/denseKernels.h"
+#include "LinAlg/Sparse/CRSMatrix.h"
+#include "LinAlg/Sparse/CRSMatrixStatistics.h"
+#include "LinAlg/Sparse/amuxCRS.h"
+
+// BaseLib
+#include "RunTime.h"
+// BaseLib/logog
+#include "logog.hpp"
+#include "formatter.hpp"
+// BaseLib/tclap
+#include "tclap/CmdLine.h"
+
+#ifdef OGS_BUILD_INFO
+#include "BuildInfo.h"
+#endif
+
+/**
+ * new formatter for logog
+ */
+class FormatterCustom : public logog::FormatterGCC
+{
+    virtual TOPIC_FLAGS GetTopicFlags( const logog::Topic &topic )
+    {
+        return ( Formatter::GetTopicFlags( topic ) &
+                 ~( TOPIC_FILE_NAME_FLAG | TOPIC_LINE_NUMBER_FLAG ));
+    }
+};
+
+/** writes s as JSON string literal, i.e. quoted and with escaped special characters */
+void writeJSONString(std::ostream &os, std::string const& s)
+{
+	os << "\"";
+	for (std::size_t k(0); k < s.size(); k++) {
+		const unsigned char c(static_cast<unsigned char>(s[k]));
+		if (c == '"' || c == '\\')
+			os << "\\" << s[k];
+		else if (c == '\n')
+			os << "\\n";
+		else if (c == '\t')
+			os << "\\t";
+		else if (c < 0x20)
+			os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<unsigned>(c)
+				<< std::dec << std::setfill(' ');
+		else
+			os << s[k];
+	}
+	os << "\"";
+}
+
+/** writes v as JSON number, non-finite values (e.g. rates of a kernel timed with 0 s) as null */
+void writeJSONNumber(std::ostream &os, double v)
+{
+	if (v != v || v > std::numeric_limits<double>::max() || v < -std::numeric_limits<double>::max())
+		os << "null";
+	else
+		os << v;
+}
+
+/** the sparse matrix in the different formats used by the kernels */
+struct MatrixData {
+	unsigned n;
+	unsigned const* iA;
+	unsigned const* jA;
+	double const* A;
+	/** upper triangle for the symmetric kernel (only if the matrix is symmetric) */
+	std::vector<unsigned> iA_sym, jA_sym;
+	std::vector<double> A_sym;
+	/** row intervals with balanced number of non-zeros for the pthreads kernel */
+	std::vector<unsigned> workload;
+};
+
+/** measurement of one kernel */
+struct KernelResult {
+	std::string name;
+	unsigned n_threads;
+	double time;
+	double bytes;
+};
+
+enum KernelType {
+	CRS_SEQUENTIAL,
+	CRS_OPENMP,
+	CRS_PTHREADS,
+	CRS_SYM
+};
+
+void runKernel(KernelType kernel, unsigned n_threads, MatrixData const& mat,
+		double const*const x, double* y)
+{
+	switch (kernel) {
+	case CRS_SEQUENTIAL:
+		MathLib::amuxCRS(1.0, mat.n, mat.iA, mat.jA, mat.A, x, y);
+		break;
+	case CRS_OPENMP:
+#ifdef _OPENMP
+		omp_set_num_threads(n_threads);
+		MathLib::amuxCRSParallelOpenMP(1.0, mat.n, mat.iA, mat.jA, mat.A, x, y);
+#endif
+		break;
+	case CRS_PTHREADS:
+		MathLib::amuxCRSParallelPThreads(1.0, mat.n, mat.iA, mat.jA, mat.A, x, y,
+				n_threads, &mat.workload[0]);
+		break;
+	case CRS_SYM:
+		MathLib::amuxCRSSym(1.0, mat.n, &mat.iA_sym[0], &mat.jA_sym[0], &mat.A_sym[0], x, y);
+		break;
+	}
+}
+
+/** @return the minimal time of one multiplication, the kernel runs at least min_time seconds */
+double benchmark(KernelType kernel, unsigned n_threads, MatrixData const& mat,
+		double const*const x, double* y, double min_time)
+{
+	runKernel(kernel, n_threads, mat, x, y);
+	BaseLib::RunTime timer;
+	double best(std::numeric_limits<double>::max()), total(0.0);
+	unsigned runs(0);
+	while (total < min_time || runs < 3) {
+		timer.start();
+		runKernel(kernel, n_threads, mat, x, y);
+		timer.stop();
+		best = std::min(best, timer.elapsed());
+		total += timer.elapsed();
+		runs++;
+	}
+	return best;
+}
+
+/** @return the bandwidth in bytes/s of the STREAM triad a = b + s c with n entries per vector */
+double measureBandwidth(unsigned n, unsigned n_threads)
+{
+#ifdef _OPENMP
+	omp_set_num_threads(n_threads);
+#else
+	(void) n_threads;
+#endif
+	double* a(new double[n]);
+	double* b(new double[n]);
+	double* c(new double[n]);
+	const OPENMP_LOOP_TYPE m(n);
+	OPENMP_LOOP_TYPE i;
+	#pragma omp parallel for schedule(static)
+	for (i = 0; i < m; i++) {
+		a[i] = 0.0;
+		b[i] = 1.0;
+		c[i] = 2.0;
+	}
+	BaseLib::RunTime timer;
+	double best(std::numeric_limits<double>::max());
+	for (unsigned r(0); r < 5; r++) {
+		timer.start();
+		#pragma omp parallel for schedule(static)
+		for (i = 0; i < m; i++)
+			a[i] = b[i] + 0.5 * c[i];
+		timer.stop();
+		best = std::min(best, timer.elapsed());
+	}
+	delete [] a;
+	delete [] b;
+	delete [] c;
+	return 3.0 * sizeof(double) * n / best;
+}
+
+/** @return the flop rate of the cache blocked dense matrix product */
+double measureFlopRate(unsigned n_threads)
+{
+#ifdef _OPENMP
+	omp_set_num_threads(n_threads);
+#else
+	(void) n_threads;
+#endif
+	const std::size_t m(512);
+	std::vector<double> A(m * m, 1.0), B(m * m, 0.5), C(m * m, 0.0);
+	MathLib::gemm(m, m, m, 1.0, &A[0], m, &B[0], m, &C[0], m);
+	BaseLib::RunTime timer;
+	double best(std::numeric_limits<double>::max());
+	for (unsigned r(0); r < 3; r++) {
+		timer.start();
+		MathLib::gemm(m, m, m, 1.0, &A[0], m, &B[0], m, &C[0], m);
+		timer.stop();
+		best = std::min(best, timer.elapsed());
+	}
+	return 2.0 * m * m * m / best;
+}
+
+void setupSymmetricKernel(MatrixData &mat)
+{
+	mat.iA_sym.assign(1, 0);
+	for (unsigned i(0); i < mat.n; i++) {
+		for (unsigned k(mat.iA[i]); k < mat.iA[i + 1]; k++) {
+			if (mat.jA[k] >= i) {
+				mat.jA_sym.push_back(mat.jA[k]);
+				mat.A_sym.push_back(mat.A[k]);
+			}
+		}
+		mat.iA_sym.push_back(mat.jA_sym.size());
+	}
+}
+
+void setupWorkload(MatrixData &mat, unsigned n_threads)
+{
+	mat.workload.assign(n_threads + 1, mat.n);
+	mat.workload[0] = 0;
+	const double nnz_per_thread(static_cast<double>(mat.iA[mat.n]) / n_threads);
+	unsigned row(0);
+	for (unsigned t(1); t < n_threads; t++) {
+		while (row < mat.n && mat.iA[row] < t * nnz_per_thread)
+			row++;
+		mat.workload[t] = row;
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	LOGOG_INITIALIZE();
+
+	TCLAP::CmdLine cmd("Statistics of a sparse matrix and roofline analysis of the matrix vector multiplication kernels", ' ', "0.1");
+
+	TCLAP::ValueArg<std::string> matrix_arg("m", "matrix", "input matrix file (binary compressed row storage)", true, "", "string");
+	cmd.add( matrix_arg );
+
+	TCLAP::ValueArg<std::string> json_arg("o", "output", "file for the JSON summary, if empty the summary is written to stdout", false, "", "string");
+	cmd.add( json_arg );
+
+	TCLAP::ValueArg<double> time_arg("t", "time", "minimal measuring time per kernel in seconds", false, 0.2, "number");
+	cmd.add( time_arg );
+
+	TCLAP::ValueArg<unsigned> stream_arg("s", "stream-size", "number of entries per vector of the STREAM triad (should exceed the caches)", false, 1u << 23, "number");
+	cmd.add( stream_arg );
+
+	TCLAP::ValueArg<unsigned> block_arg("b", "max-block-size", "block sizes 1, ..., b are checked", false, 6, "number");
+	cmd.add( block_arg );
+
+	cmd.parse( argc, argv );
+
+	FormatterCustom *custom_format (new FormatterCustom);
+	logog::Cout *logogCout(new logog::Cout);
+	logogCout->SetFormatter(*custom_format);
+
+#ifdef OGS_BUILD_INFO
+	INFO("%s was build with compiler %s", argv[0], CMAKE_CXX_COMPILER);
+#endif
+
+	MathLib::CRSMatrix<double, unsigned> crs(matrix_arg.getValue());
+	if (crs.getRowPtrArray() == NULL) {
+		ERR("could not read matrix %s", matrix_arg.getValue().c_str());
+		return 1;
+	}
+	MatrixData mat;
+	mat.n = crs.getNRows();
+	mat.iA = crs.getRowPtrArray();
+	mat.jA = crs.getColIdxArray();
+	mat.A = crs.getEntryArray();
+
+	BaseLib::RunTime timer;
+	timer.start();
+	MathLib::CRSMatrixStatistics stats;
+	MathLib::computeCRSMatrixStatistics(mat.n, mat.iA, mat.jA, mat.A, stats,
+			std::max(block_arg.getValue(), 1u));
+	timer.stop();
+	INFO("n=%d, nnz=%d, nnz per row %d ... %d (mean %.2f, stddev %.2f), bandwidth %d (analysis %e s)",
+			stats.n_rows, stats.nnz, stats.min_row_nnz, stats.max_row_nnz, stats.mean_row_nnz,
+			stats.stddev_row_nnz, stats.bandwidth, timer.elapsed());
+	INFO("symmetric: %s, strictly diagonally dominant rows: %d, detected block size %d (fill %.3f)",
+			stats.numerically_symmetric ? "yes" : (stats.structurally_symmetric ? "pattern only" : "no"),
+			stats.n_strictly_dominant_rows, stats.block_size, stats.block_fill[stats.block_size - 1]);
+
+#ifdef _OPENMP
+	const unsigned max_threads(omp_get_max_threads());
+#else
+	const unsigned max_threads(1);
+#endif
+
+	// machine balance: memory and compute roof
+	const double bandwidth(measureBandwidth(stream_arg.getValue(), max_threads));
+	const double flop_rate(measureFlopRate(max_threads));
+	INFO("roofs with %d threads: STREAM triad %.2f GB/s, dense gemm %.2f GFLOP/s",
+			max_threads, bandwidth * 1e-9, flop_rate * 1e-9);
+
+	// data volume models (bytes per SpMV)
+	const double bytes_crs(MathLib::amuxCRSDataVolume<double, unsigned>(mat.n, stats.nnz));
+	// no reuse of x: every non-zero entry loads its entry of x
+	const double bytes_crs_no_reuse(bytes_crs + (static_cast<double>(stats.nnz) - mat.n) * sizeof(double));
+	const double flops(2.0 * stats.nnz);
+
+	// benchmark of the kernels
+	double* x(new double[mat.n]);
+	double* y(new double[mat.n]);
+	for (unsigned k(0); k < mat.n; k++)
+		x[k] = 1.0;
+	std::vector<KernelResult> results;
+	KernelResult res;
+	res.name = "crs_sequential";
+	res.n_threads = 1;
+	res.bytes = bytes_crs;
+	res.time = benchmark(CRS_SEQUENTIAL, 1, mat, x, y, time_arg.getValue());
+	results.push_back(res);
+#ifdef _OPENMP
+	for (unsigned t(1); t <= max_threads; t = (2 * t > max_threads && t < max_threads) ? max_threads : 2 * t) {
+		res.name = "crs_openmp";
+		res.n_threads = t;
+		res.time = benchmark(CRS_OPENMP, t, mat, x, y, time_arg.getValue());
+		results.push_back(res);
+	}
+	omp_set_num_threads(max_threads);
+#endif
+#ifdef HAVE_PTHREADS
+	setupWorkload(mat, max_threads);
+	res.name = "crs_pthreads_balanced";
+	res.n_threads = max_threads;
+	res.time = benchmark(CRS_PTHREADS, max_threads, mat, x, y, time_arg.getValue());
+	results.push_back(res);
+#endif
+	if (stats.numerically_symmetric) {
+		setupSymmetricKernel(mat);
+		res.name = "crs_sym";
+		res.n_threads = 1;
+		res.bytes = MathLib::amuxCRSDataVolume<double, unsigned>(mat.n, mat.jA_sym.size());
+		res.time = benchmark(CRS_SYM, 1, mat, x, y, time_arg.getValue());
+		results.push_back(res);
+	}
+	delete [] x;
+	delete [] y;
+
+	std::size_t best(0);
+	for (std::size_t k(0); k < results.size(); k++) {
+		KernelResult const& r(results[k]);
+		INFO("%-22s %2d threads: %e s, %.2f GB/s, %.2f GFLOP/s, %.0f%% of the roofline",
+				r.name.c_str(), r.n_threads, r.time, r.bytes / r.time * 1e-9, flops / r.time * 1e-9,
+				100.0 * (flops / r.time) / std::min(flop_rate, flops / r.bytes * bandwidth));
+		if (r.time < results[best].time)
+			best = k;
+	}
+
+	// hints for the selection of the storage format
+	std::vector<std::string> hints;
+	if (stats.block_size > 1) {
+		std::ostringstream os;
+		os << "blocked CRS with block size " << stats.block_size << " reduces the data volume by "
+			<< static_cast<int>(100.0 * (1.0 - MathLib::amuxBCRSDataVolume(stats, stats.block_size) / bytes_crs))
+			<< "%";
+		hints.push_back(os.str());
+	}
+	if (stats.numerically_symmetric)
+		hints.push_back("symmetric storage halves the matrix data, but the kernel is sequential");
+	if (stats.mean_row_nnz > 0.0 && stats.stddev_row_nnz > 0.5 * stats.mean_row_nnz)
+		hints.push_back("irregular row lengths: distribute the rows by number of non-zeros");
+	if (stats.bandwidth > 0.1 * mat.n && stats.mean_distance > 0.01 * mat.n)
+		hints.push_back("large bandwidth: a bandwidth or nested dissection reordering improves the reuse of x");
+	const double best_flop_rate(flops / results[best].time);
+	const double attainable(std::min(flop_rate, flops / bytes_crs * bandwidth));
+	if (best_flop_rate > attainable)
+		hints.push_back("the fastest kernel exceeds the memory roof: the matrix fits into the caches");
+	else if (best_flop_rate < 0.5 * attainable)
+		hints.push_back("the fastest kernel reaches less than half of the roofline: the access to x is not cached well");
+
+	std::ofstream out_file;
+	if (!json_arg.getValue().empty())
+		out_file.open(json_arg.getValue().c_str());
+	std::ostream &os(json_arg.getValue().empty() ? std::cout : out_file);
+	os << "{\n";
+	os << "\t\"matrix\": ";
+	writeJSONString(os, matrix_arg.getValue());
+	os << ",\n";
+	os << "\t\"statistics\": ";
+	MathLib::writeJSON(os, stats, "\t");
+	os << ",\n";
+	os << "\t\"data_volume\": {\"crs_bytes\": " << bytes_crs
+		<< ", \"crs_bytes_without_x_reuse\": " << bytes_crs_no_reuse
+		<< ", \"bcrs_bytes\": " << MathLib::amuxBCRSDataVolume(stats, stats.block_size)
+		<< ", \"flops\": " << flops
+		<< ", \"arithmetic_intensity\": ";
+	writeJSONNumber(os, flops / bytes_crs);
+	os << "},\n";
+	os << "\t\"machine\": {\"threads\": " << max_threads << ", \"stream_triad_GBs\": ";
+	writeJSONNumber(os, bandwidth * 1e-9);
+	os << ", \"dense_gemm_GFLOPs\": ";
+	writeJSONNumber(os, flop_rate * 1e-9);
+	os << ", \"attainable_spmv_GFLOPs\": ";
+	writeJSONNumber(os, attainable * 1e-9);
+	os << "},\n";
+	os << "\t\"kernels\": [\n";
+	for (std::size_t k(0); k < results.size(); k++) {
+		KernelResult const& r(results[k]);
+		os << "\t\t{\"name\": ";
+		writeJSONString(os, r.name);
+		os << ", \"threads\": " << r.n_threads << ", \"time\": " << r.time << ", \"bytes\": " << r.bytes
+			<< ", \"GBs\": ";
+		writeJSONNumber(os, r.bytes / r.time * 1e-9);
+		os << ", \"GFLOPs\": ";
+		writeJSONNumber(os, flops / r.time * 1e-9);
+		os << ", \"roofline_fraction\": ";
+		writeJSONNumber(os, (flops / r.time) / std::min(flop_rate, flops / r.bytes * bandwidth));
+		os << "}" << (k + 1 < results.size() ? "," : "") << "\n";
+	}
+	os << "\t],\n";
+	os << "\t\"fastest_kernel\": {\"name\": ";
+	writeJSONString(os, results[best].name);
+	os << ", \"threads\": " << results[best].n_threads << "},\n";
+	os << "\t\"hints\": [";
+	for (std::size_t k(0); k < hints.size(); k++) {
+		os << (k > 0 ? ", " : "");
+		writeJSONString(os, hints[k]);
+	}
+	os << "]\n";
+	os << "}" << std::endl;
+
+	delete custom_format;
+	delete logogCout;
+	LOGOG_SHUTDOWN();
+
+	return 0;
+}
@@ -0,0 +1,222 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ * \file ReproducibleReductions.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "LinAlg/reproducibleReduction.h"
+#include "LinAlg/Solvers/vectorKernels.h"
+#include "LinAlg/Solvers/CG.h"
+#include "LinAlg/Sparse/CRSMatrixDiagPrecond.h"
+
+// BaseLib
+#include "RunTime.h"
+// BaseLib/logog
+#include "logog.hpp"
+#include "formatter.hpp"
+// BaseLib/tclap
+#include "tclap/CmdLine.h"
+
+/**
+ * new formatter for logog
+ */
+class FormatterCustom : public logog::FormatterGCC
+{
+    virtual TOPIC_FLAGS GetTopicFlags( const logog::Topic &topic )
+    {
+        return ( Formatter::GetTopicFlags( topic ) &
+                 ~( TOPIC_FILE_NAME_FLAG | TOPIC_LINE_NUMBER_FLAG ));
+    }
+};
+
+/** results of one run that have to be bitwise identical for all thread numbers */
+struct Results {
+	double dot;
+	double nrm2;
+	double axpy_dot;
+	double xy;
+	double xz;
+	unsigned cg_steps;
+	double cg_eps;
+	double* cg_x;
+};
+
+/** 5-point stencil of the Laplacian on an m x m grid */
+MathLib::CRSMatrixDiagPrecond* createLaplacian(unsigned m)
+{
+	const unsigned n(m * m);
+	unsigned* iA(new unsigned[n + 1]);
+	unsigned* jA(new unsigned[5 * n]);
+	double* A(new double[5 * n]);
+	unsigned pos(0);
+	iA[0] = 0;
+	for (unsigned i(0); i < m; i++) {
+		for (unsigned j(0); j < m; j++) {
+			const unsigned row(i * m + j);
+			if (i > 0) { jA[pos] = row - m; A[pos++] = -1.0; }
+			if (j > 0) { jA[pos] = row - 1; A[pos++] = -1.0; }
+			jA[pos] = row; A[pos++] = 4.0;
+			if (j + 1 < m) { jA[pos] = row + 1; A[pos++] = -1.0; }
+			if (i + 1 < m) { jA[pos] = row + m; A[pos++] = -1.0; }
+			iA[row + 1] = pos;
+		}
+	}
+	MathLib::CRSMatrixDiagPrecond* mat(new MathLib::CRSMatrixDiagPrecond(n, iA, jA, A));
+	mat->calcPrecond();
+	return mat;
+}
+
+void compute(unsigned n, double const*const x, double const*const y, double const*const z,
+		MathLib::CRSMatrixDiagPrecond const& mat, double const*const b, Results &res)
+{
+	res.dot = MathLib::reproducibleDot(n, x, y);
+	res.nrm2 = MathLib::VectorKernels::nrm2(n, x);
+	double* w(new double[n]);
+	MathLib::VectorKernels::copy(n, y, w);
+	res.axpy_dot = MathLib::VectorKernels::axpyDot(n, 0.5, x, w, z);
+	delete [] w;
+	MathLib::VectorKernels::dot2(n, x, y, z, res.xy, res.xz);
+
+	const unsigned n_rows(mat.getNRows());
+	res.cg_x = new double[n_rows];
+	MathLib::VectorKernels::setZero(n_rows, res.cg_x);
+	res.cg_eps = 1e-10;
+	res.cg_steps = 10000;
+#ifdef _OPENMP
+	MathLib::CGParallel(&mat, b, res.cg_x, res.cg_eps, res.cg_steps);
+#else
+	MathLib::CG(&mat, b, res.cg_x, res.cg_eps, res.cg_steps);
+#endif
+}
+
+bool identical(double a, double b)
+{
+	return std::memcmp(&a, &b, sizeof(double)) == 0;
+}
+
+int main(int argc, char *argv[])
+{
+	LOGOG_INITIALIZE();
+
+	TCLAP::CmdLine cmd("Checks that parallel reductions and the CG solver give bitwise identical results for every number of threads", ' ', "0.1");
+
+	TCLAP::ValueArg<unsigned> n_arg("n", "length", "length of the vectors", false, 1000003, "number");
+	cmd.add( n_arg );
+
+	TCLAP::ValueArg<unsigned> m_arg("m", "grid", "number of grid points per direction of the Laplacian for the CG test", false, 150, "number");
+	cmd.add( m_arg );
+
+	TCLAP::ValueArg<unsigned> n_threads_arg("p", "max-threads", "the results are compared for 1, ..., p threads", false, 8, "number");
+	cmd.add( n_threads_arg );
+
+	cmd.parse( argc, argv );
+
+	FormatterCustom *custom_format (new FormatterCustom);
+	logog::Cout *logogCout(new logog::Cout);
+	logogCout->SetFormatter(*custom_format);
+
+	const unsigned n(n_arg.getValue());
+	double* x(new double[n]);
+	double* y(new double[n]);
+	double* z(new double[n]);
+	// entries of different magnitude and sign make the sums sensitive to the order
+	srand(42);
+	for (unsigned k(0); k < n; k++) {
+		const double scale(k % 3 == 0 ? 1e6 : (k % 3 == 1 ? 1.0 : 1e-6));
+		x[k] = scale * (rand() / static_cast<double>(RAND_MAX) - 0.5);
+		y[k] = rand() / static_cast<double>(RAND_MAX) - 0.3;
+		z[k] = rand() / static_cast<double>(RAND_MAX);
+	}
+
+	MathLib::CRSMatrixDiagPrecond* mat(createLaplacian(m_arg.getValue()));
+	const unsigned n_rows(mat->getNRows());
+	double* b(new double[n_rows]);
+	for (unsigned k(0); k < n_rows; k++)
+		b[k] = 1.0 + (k % 7);
+
+#ifdef _OPENMP
+	const unsigned max_threads(n_threads_arg.getValue());
+#else
+	const unsigned max_threads(1);
+#endif
+
+	Results ref = Results();
+	bool ok(true);
+	for (unsigned t(1); t <= max_threads; t++) {
+#ifdef _OPENMP
+		omp_set_num_threads(t);
+#endif
+		Results res;
+		compute(n, x, y, z, *mat, b, res);
+		INFO("%d threads: dot %.17e, nrm2 %.17e, CG %d steps, residuum %e",
+				t, res.dot, res.nrm2, res.cg_steps, res.cg_eps);
+		if (t == 1) {
+			ref = res;
+			continue;
+		}
+
+		bool same(identical(res.dot, ref.dot) && identical(res.nrm2, ref.nrm2)
+				&& identical(res.axpy_dot, ref.axpy_dot) && identical(res.xy, ref.xy)
+				&& identical(res.xz, ref.xz) && res.cg_steps == ref.cg_steps
+				&& identical(res.cg_eps, ref.cg_eps)
+				&& std::memcmp(res.cg_x, ref.cg_x, n_rows * sizeof(double)) == 0);
+		if (!same) {
+			ERR("results with %d threads differ from the results with one thread", t);
+			ok = false;
+		}
+		delete [] res.cg_x;
+	}
+	delete [] ref.cg_x;
+
+	// overhead of the reproducible scalar product compared to an OpenMP reduction
+	const unsigned n_runs(20);
+	BaseLib::RunTime timer;
+	double s(0.0);
+	timer.start();
+	for (unsigned r(0); r < n_runs; r++)
+		s += MathLib::reproducibleDot(n, x, y);
+	timer.stop();
+	const double t_reproducible(timer.elapsed());
+
+	timer.start();
+	for (unsigned r(0); r < n_runs; r++) {
+		double res(0.0);
+		const OPENMP_LOOP_TYPE m(n);
+		OPENMP_LOOP_TYPE k;
+		#pragma omp parallel for reduction(+:res)
+		for (k = 0; k < m; k++)
+			res += x[k] * y[k];
+		s -= res;
+	}
+	timer.stop();
+	INFO("%d scalar products: reproducible %e s, OpenMP reduction %e s (difference of the sums %e)",
+			n_runs, t_reproducible, timer.elapsed(), s);
+
+	if (ok)
+		INFO("all results are bitwise identical");
+
+	delete mat;
+	delete [] b;
+	delete [] x;
+	delete [] y;
+	delete [] z;
+
+	delete custom_format;
+	delete logogCout;
+	LOGOG_SHUTDOWN();
+
+	return ok ? 0 : 1;
+}
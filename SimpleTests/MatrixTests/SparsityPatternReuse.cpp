@@ -0,0 +1,193 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ * @file SparsityPatternReuse.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <cstdlib>
+#include <cmath>
+
+// BaseLib
+#include "RunTime.h"
+// BaseLib/tclap
+#include "tclap/CmdLine.h"
+// BaseLib/logog
+#include "logog.hpp"
+#include "formatter.hpp"
+
+// MathLib
+#include "sparse.h"
+#include "LinAlg/Preconditioner/generateDiagPrecond.h"
+#include "LinAlg/Sparse/SparsityPattern.h"
+#include "LinAlg/Sparse/NestedDissectionPermutation/CRSMatrixReordered.h"
+#include "LinAlg/Sparse/NestedDissectionPermutation/Cluster.h"
+
+/**
+ * new formatter for logog
+ */
+class FormatterCustom : public logog::FormatterGCC
+{
+    virtual TOPIC_FLAGS GetTopicFlags( const logog::Topic &topic )
+    {
+        return ( Formatter::GetTopicFlags( topic ) &
+                 ~( TOPIC_FILE_NAME_FLAG | TOPIC_LINE_NUMBER_FLAG ));
+    }
+};
+
+/**
+ * the entries of the system matrix in time step k (only the values change)
+ */
+double* createEntries(unsigned nnz, double const*const A, unsigned k)
+{
+	double* data(new double[nnz]);
+	for (unsigned j(0); j < nnz; j++)
+		data[j] = A[j] * (1.0 + 0.01 * k);
+	return data;
+}
+
+/**
+ * checks whether two matrices have the same pattern and the same entries
+ */
+bool isEqual(MathLib::CRSMatrix<double, unsigned> const& a, MathLib::CRSMatrix<double, unsigned> const& b)
+{
+	const unsigned n(a.getNRows());
+	if (n != b.getNRows() || a.getNNZ() != b.getNNZ())
+		return false;
+	const unsigned nnz(a.getNNZ());
+	unsigned const*const iA(a.getRowPtrArray());
+	unsigned const*const iB(b.getRowPtrArray());
+	for (unsigned k(0); k <= n; k++)
+		if (iA[k] != iB[k])
+			return false;
+	unsigned const*const jA(a.getColIdxArray());
+	unsigned const*const jB(b.getColIdxArray());
+	double const*const A(a.getEntryArray());
+	double const*const B(b.getEntryArray());
+	for (unsigned k(0); k < nnz; k++)
+		if (jA[k] != jB[k] || A[k] != B[k])
+			return false;
+	return true;
+}
+
+int main(int argc, char *argv[])
+{
+	LOGOG_INITIALIZE();
+
+	TCLAP::CmdLine cmd("The purpose of this program is to measure the savings of sharing the sparsity pattern between the system matrices of successive time steps: the nested dissection permutation, the reordering, the diagonal preconditioner and the transpose are computed for every time step and compared with the computation using a shared SparsityPattern, where only the entries are refreshed.", ' ', "0.1");
+
+	TCLAP::ValueArg<std::string> matrix_arg("m","matrix","input matrix file in CRS format",true,"","file name of the matrix in CRS format");
+	cmd.add( matrix_arg );
+
+	TCLAP::ValueArg<unsigned> n_steps_arg("n", "number-of-time-steps", "number of time steps to simulate", false, 10, "number of time steps");
+	cmd.add( n_steps_arg );
+
+	TCLAP::ValueArg<unsigned> bmin_arg("b", "bmin", "threshold for the refinement of the cluster tree", false, 1000, "number");
+	cmd.add( bmin_arg );
+
+	cmd.parse( argc, argv );
+
+	const unsigned n_steps(n_steps_arg.getValue());
+	const unsigned bmin(bmin_arg.getValue());
+	std::string fname_mat (matrix_arg.getValue());
+
+	FormatterCustom *custom_format (new FormatterCustom);
+	logog::Cout *logogCout(new logog::Cout);
+	logogCout->SetFormatter(*custom_format);
+
+	// *** reading matrix in crs format from file
+	std::ifstream in(fname_mat.c_str(), std::ios::in | std::ios::binary);
+	double *A(NULL);
+	unsigned *iA(NULL), *jA(NULL), n;
+	if (in) {
+		CS_read(in, n, iA, jA, A);
+		in.close();
+	} else {
+		ERR("error reading matrix from %s", fname_mat.c_str());
+		return -1;
+	}
+	const unsigned nnz(iA[n]);
+	INFO("Parameters read: n=%d, nnz=%d, %d time steps", n, nnz, n_steps);
+
+	unsigned *op_perm(new unsigned[n]);
+	unsigned *po_perm(new unsigned[n]);
+	double *inv_diag(new double[n]);
+	double *inv_diag_shared(new double[n]);
+
+	// the pattern is shared between all matrices of the second run
+	MathLib::SparsityPattern const*const pattern(new MathLib::SparsityPattern(n, iA, jA));
+
+	BaseLib::RunTime timer;
+	double t_recompute(0.0), t_shared(0.0);
+	bool ok(true);
+	for (unsigned step(0); step < n_steps; step++) {
+		// *** recompute all pattern dependent data
+		timer.start();
+		unsigned *iA_step(new unsigned[n + 1]);
+		std::copy(iA, iA + n + 1, iA_step);
+		unsigned *jA_step(new unsigned[nnz]);
+		std::copy(jA, jA + nnz, jA_step);
+		MathLib::CRSMatrixReordered mat(n, iA_step, jA_step, createEntries(nnz, A, step));
+		for (unsigned k(0); k < n; k++)
+			op_perm[k] = po_perm[k] = k;
+		MathLib::Cluster cluster_tree(n, iA_step, jA_step);
+		cluster_tree.createClusterTree(op_perm, po_perm, bmin);
+		mat.reorderMatrix(op_perm, po_perm);
+		MathLib::generateDiagPrecond(n, mat.getRowPtrArray(), mat.getColIdxArray(),
+				mat.getEntryArray(), inv_diag);
+		MathLib::CRSMatrix<double, unsigned>* trans(mat.getTranspose());
+		timer.stop();
+		t_recompute += timer.elapsed();
+
+		// *** shared pattern, only the entries are refreshed
+		timer.start();
+		MathLib::CRSMatrixReordered mat_shared(pattern, createEntries(nnz, A, step));
+		mat_shared.calcNestedDissection(bmin, op_perm, po_perm);
+		mat_shared.reorderMatrix(op_perm, po_perm);
+		MathLib::SparsityPattern const*const reordered(mat_shared.getSparsityPattern());
+		MathLib::generateDiagPrecondFromPositions(n, nnz, reordered->getDiagonalPositions(),
+				mat_shared.getEntryArray(), inv_diag_shared);
+		MathLib::CRSMatrix<double, unsigned>* trans_shared(mat_shared.getTranspose());
+		timer.stop();
+		t_shared += timer.elapsed();
+		if (step == 0)
+			INFO("shared sparsity pattern, first time step (computes the pattern data):\t%e s", timer.elapsed());
+
+		if (!isEqual(mat, mat_shared) || !isEqual(*trans, *trans_shared)) {
+			ERR("time step %d: reordered matrices differ", step);
+			ok = false;
+		}
+		for (unsigned k(0); k < n; k++) {
+			if (inv_diag[k] != inv_diag_shared[k]) {
+				ERR("time step %d: diagonal preconditioners differ", step);
+				ok = false;
+				break;
+			}
+		}
+		delete trans;
+		delete trans_shared;
+	}
+
+	INFO("recompute pattern data:\t%e s per time step", t_recompute / n_steps);
+	INFO("shared sparsity pattern:\t%e s per time step", t_shared / n_steps);
+	INFO("references to the pattern after the time steps: %d", pattern->getNReferences());
+	if (pattern->getNReferences() != 1)
+		ok = false;
+
+	pattern->release();
+	delete [] A;
+	delete [] op_perm;
+	delete [] po_perm;
+	delete [] inv_diag;
+	delete [] inv_diag_shared;
+
+	delete custom_format;
+	delete logogCout;
+	LOGOG_SHUTDOWN();
+
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,266 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ * \file ElementByElementSolver.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// BaseLib
+#include "RunTime.h"
+#include "tclap/CmdLine.h"
+
+// BaseLib/logog
+#include "logog.hpp"
+#include "formatter.hpp"
+
+// MathLib
+#include "LinAlg/Solvers/CG.h"
+#include "LinAlg/Solvers/BiCGStab.h"
+#include "LinAlg/Solvers/GMRes.h"
+#include "LinAlg/Solvers/vectorKernels.h"
+
+// MeshLib
+#include "Node.h"
+#include "Elements/Tet.h"
+#include "Elements/Tet10.h"
+#include "Mesh.h"
+#include "ElementByElementLaplacian.h"
+
+/**
+ * new formatter for logog
+ */
+class FormatterCustom : public logog::FormatterGCC
+{
+    virtual TOPIC_FLAGS GetTopicFlags( const logog::Topic &topic )
+    {
+        return ( Formatter::GetTopicFlags( topic ) &
+                 ~( TOPIC_FILE_NAME_FLAG | TOPIC_LINE_NUMBER_FLAG ));
+    }
+};
+
+/**
+ * Creates a mesh of the unit cube with m^3 cubes, every cube is divided into
+ * six tetrahedra sharing the diagonal from (0,0,0) to (1,1,1). For quadratic
+ * elements the nodes are placed on a grid with 2m+1 points per direction,
+ * then the edge midpoints of the tetrahedra are grid points, too.
+ */
+MeshLib::Mesh* createCubeMesh(unsigned m, bool quadratic)
+{
+	const unsigned s(quadratic ? 2 : 1);
+	const unsigned n_pnts(s * m + 1);
+	std::vector<MeshLib::Node*> nodes;
+	for (unsigned k(0); k < n_pnts; k++)
+		for (unsigned j(0); j < n_pnts; j++)
+			for (unsigned i(0); i < n_pnts; i++)
+				nodes.push_back(new MeshLib::Node(i / static_cast<double>(n_pnts - 1),
+						j / static_cast<double>(n_pnts - 1), k / static_cast<double>(n_pnts - 1)));
+
+	static const unsigned perms[6][3] = {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}};
+	static const unsigned edge_nodes[6][2] = {{0, 1}, {1, 2}, {0, 2}, {0, 3}, {1, 3}, {2, 3}};
+	std::vector<MeshLib::Element*> elements;
+	for (unsigned k(0); k < m; k++) {
+		for (unsigned j(0); j < m; j++) {
+			for (unsigned i(0); i < m; i++) {
+				for (unsigned t(0); t < 6; t++) {
+					// grid coordinates of the vertices of the tetrahedron
+					unsigned v[4][3] = {{s * i, s * j, s * k}};
+					for (unsigned l(1); l < 4; l++) {
+						for (unsigned d(0); d < 3; d++)
+							v[l][d] = v[l - 1][d];
+						v[l][perms[t][l - 1]] += s;
+					}
+					MeshLib::Node** elem_nodes(new MeshLib::Node*[quadratic ? 10 : 4]);
+					for (unsigned l(0); l < 4; l++)
+						elem_nodes[l] = nodes[(v[l][2] * n_pnts + v[l][1]) * n_pnts + v[l][0]];
+					if (quadratic) {
+						for (unsigned e(0); e < 6; e++) {
+							unsigned const*const v0(v[edge_nodes[e][0]]);
+							unsigned const*const v1(v[edge_nodes[e][1]]);
+							elem_nodes[4 + e] = nodes[(((v0[2] + v1[2]) / 2) * n_pnts
+									+ (v0[1] + v1[1]) / 2) * n_pnts + (v0[0] + v1[0]) / 2];
+						}
+						elements.push_back(new MeshLib::Tet10(elem_nodes));
+					} else
+						elements.push_back(new MeshLib::Tet(elem_nodes));
+				}
+			}
+		}
+	}
+	return new MeshLib::Mesh("cube", nodes, elements);
+}
+
+bool isBoundaryNode(MeshLib::Node const& node)
+{
+	for (unsigned d(0); d < 3; d++)
+		if (node[d] == 0.0 || node[d] == 1.0)
+			return true;
+	return false;
+}
+
+/** number of non-zero entries the assembled matrix would have */
+std::size_t getNNZOfAssembledMatrix(MeshLib::Mesh const& mesh)
+{
+	std::size_t nnz(0);
+	std::vector<unsigned> adj_nodes;
+	for (std::size_t i(0); i < mesh.getNNodes(); i++) {
+		adj_nodes.clear();
+		// valid as long as the mesh is not changed
+		MeshLib::NodeElements const& elements(mesh.getNode(i)->getElements());
+		for (std::size_t e(0); e < elements.size(); e++)
+			for (unsigned k(0); k < elements[e]->getNNodes(); k++)
+				adj_nodes.push_back(elements[e]->getNodeIndex(k));
+		std::sort(adj_nodes.begin(), adj_nodes.end());
+		nnz += std::unique(adj_nodes.begin(), adj_nodes.end()) - adj_nodes.begin();
+	}
+	return nnz;
+}
+
+/** @return the maximal absolute value of the entries of y that are not masked */
+double maxNorm(std::size_t n, double const*const y, std::vector<bool> const& mask)
+{
+	double res(0.0);
+	for (std::size_t i(0); i < n; i++)
+		if (!mask[i])
+			res = std::max(res, fabs(y[i]));
+	return res;
+}
+
+int main(int argc, char *argv[])
+{
+	LOGOG_INITIALIZE();
+	FormatterCustom *custom_format (new FormatterCustom);
+	logog::Cout *logogCout(new logog::Cout);
+	logogCout->SetFormatter(*custom_format);
+
+	TCLAP::CmdLine cmd("Solves the Poisson equation on the unit cube with a matrix free element by element operator", ' ', "0.1");
+
+	TCLAP::ValueArg<unsigned> m_arg("m", "cubes", "number of cubes per direction", false, 16, "number");
+	cmd.add( m_arg );
+
+	TCLAP::SwitchArg quadratic_arg("q", "quadratic", "use quadratic tetrahedra (Tet10)");
+	cmd.add( quadratic_arg );
+
+	cmd.parse( argc, argv );
+
+	MeshLib::Mesh* mesh(createCubeMesh(m_arg.getValue(), quadratic_arg.getValue()));
+	const std::size_t n(mesh->getNNodes());
+	INFO("mesh with %d nodes and %d elements", n, mesh->getNElements());
+
+	MeshLib::ElementByElementLaplacian op(*mesh);
+	const std::size_t nnz(getNNZOfAssembledMatrix(*mesh));
+	INFO("element by element operator: %d colors, %d KB, assembled CRS matrix: %d KB",
+			op.getNColors(), op.getMemoryUsage() / 1024,
+			(nnz * (sizeof(double) + sizeof(unsigned)) + (n + 1) * sizeof(unsigned)) / 1024);
+
+	std::vector<bool> no_mask(n, false), boundary(n, false);
+	std::vector<std::size_t> dirichlet_nodes;
+	for (std::size_t i(0); i < n; i++) {
+		if (isBoundaryNode(*mesh->getNode(i))) {
+			boundary[i] = true;
+			dirichlet_nodes.push_back(i);
+		}
+	}
+
+	double* x(new double[n]);
+	double* y(new double[n]);
+	bool ok(true);
+
+	// the constant functions are in the kernel of the Laplacian
+	for (std::size_t i(0); i < n; i++)
+		x[i] = 1.0;
+	op.amux(1.0, x, y);
+	const double err_const(maxNorm(n, y, no_mask));
+	// linear functions are harmonic, the interior rows vanish
+	for (std::size_t i(0); i < n; i++) {
+		double const*const c(mesh->getNode(i)->getCoords());
+		x[i] = c[0] + 2.0 * c[1] + 3.0 * c[2];
+	}
+	BaseLib::RunTime timer;
+	const unsigned n_runs(10);
+	timer.start();
+	for (unsigned r(0); r < n_runs; r++)
+		op.amux(1.0, x, y);
+	timer.stop();
+	const double err_linear(maxNorm(n, y, boundary));
+	INFO("|K 1| = %e, |K x| = %e (interior nodes), time for one amux: %e s",
+			err_const, err_linear, timer.elapsed() / n_runs);
+	if (err_const > 1e-10 || err_linear > 1e-10) {
+		ERR("the operator does not reproduce constant or linear functions");
+		ok = false;
+	}
+
+	// Poisson equation with homogeneous Dirichlet boundary conditions
+	op.setDirichletNodes(dirichlet_nodes);
+	double* b(new double[n]);
+	for (std::size_t i(0); i < n; i++)
+		b[i] = boundary[i] ? 0.0 : 1.0;
+	const double nrm_b(MathLib::VectorKernels::nrm2(n, b));
+
+	double* x_cg(new double[n]);
+	MathLib::VectorKernels::setZero(n, x_cg);
+	double eps(1e-10);
+	unsigned steps(1000);
+	timer.start();
+#ifdef _OPENMP
+	MathLib::CGParallel(&op, b, x_cg, eps, steps);
+#else
+	MathLib::CG(&op, b, x_cg, eps, steps);
+#endif
+	timer.stop();
+	op.amux(1.0, x_cg, y);
+	MathLib::VectorKernels::axpy(n, -1.0, b, y);
+	const double res_cg(MathLib::VectorKernels::nrm2(n, y) / nrm_b);
+	INFO("CG: %d steps, relative residual %e, %e s", steps, res_cg, timer.elapsed());
+	if (res_cg > 1e-8) {
+		ERR("CG did not converge");
+		ok = false;
+	}
+
+	// the other solvers work with the same operator
+	MathLib::VectorKernels::setZero(n, x);
+	eps = 1e-10;
+	steps = 1000;
+	timer.start();
+	MathLib::BiCGStab(op, b, x, eps, steps);
+	timer.stop();
+	MathLib::VectorKernels::axpy(n, -1.0, x_cg, x);
+	const double diff_bicgstab(maxNorm(n, x, no_mask));
+	INFO("BiCGStab: %d steps, %e s, max difference to the CG solution %e", steps,
+			timer.elapsed(), diff_bicgstab);
+
+	MathLib::VectorKernels::setZero(n, x);
+	eps = 1e-10;
+	steps = 1000;
+	timer.start();
+	MathLib::GMRes(op, b, x, eps, 30, steps);
+	timer.stop();
+	MathLib::VectorKernels::axpy(n, -1.0, x_cg, x);
+	const double diff_gmres(maxNorm(n, x, no_mask));
+	INFO("GMRes(30): %d steps, %e s, max difference to the CG solution %e", steps,
+			timer.elapsed(), diff_gmres);
+
+	if (diff_bicgstab > 1e-6 || diff_gmres > 1e-6) {
+		ERR("the solutions of the solvers differ");
+		ok = false;
+	}
+
+	delete [] x;
+	delete [] y;
+	delete [] b;
+	delete [] x_cg;
+	delete mesh;
+
+	delete custom_format;
+	delete logogCout;
+	LOGOG_SHUTDOWN();
+
+	return ok ? 0 : 1;
+}
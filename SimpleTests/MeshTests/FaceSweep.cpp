@@ -0,0 +1,220 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ * \file FaceSweep.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <string>
+
+// BaseLib
+#include "RunTime.h"
+#include "tclap/CmdLine.h"
+
+// BaseLib/logog
+#include "logog.hpp"
+#include "formatter.hpp"
+
+// MeshLib
+#include "Mesh.h"
+#include "Node.h"
+#include "Elements/Element.h"
+#include "MeshTopology.h"
+#include "FaceView.h"
+#include "EdgeView.h"
+#include "Legacy/MeshIO.h"
+
+/**
+ * new formatter for logog
+ */
+class FormatterCustom : public logog::FormatterGCC
+{
+    virtual TOPIC_FLAGS GetTopicFlags( const logog::Topic &topic )
+    {
+        return ( Formatter::GetTopicFlags( topic ) &
+                 ~( TOPIC_FILE_NAME_FLAG | TOPIC_LINE_NUMBER_FLAG ));
+    }
+};
+
+/**
+ * counts the visited faces and sums up their node indices
+ */
+struct FaceCounter
+{
+	FaceCounter() : n_faces(0), n_boundary_faces(0), checksum(0) {}
+
+	void operator() (MeshLib::FaceView const& face)
+	{
+		n_faces++;
+		if (face.isBoundary())
+			n_boundary_faces++;
+		const unsigned n_face_nodes(face.getNNodes());
+		for (unsigned j(0); j < n_face_nodes; j++)
+			checksum += face.getNodeIndex(j);
+	}
+
+	std::size_t n_faces;
+	std::size_t n_boundary_faces;
+	unsigned long checksum;
+};
+
+/**
+ * counts the visited edges and sums up their node indices
+ */
+struct EdgeCounter
+{
+	EdgeCounter() : n_edges(0), checksum(0) {}
+
+	void operator() (MeshLib::EdgeView const& edge)
+	{
+		n_edges++;
+		checksum += edge.getNodeIndex(0) + edge.getNodeIndex(1);
+	}
+
+	std::size_t n_edges;
+	unsigned long checksum;
+};
+
+int main(int argc, char *argv[])
+{
+	LOGOG_INITIALIZE();
+	FormatterCustom *custom_format (new FormatterCustom);
+	logog::Cout *logogCout(new logog::Cout);
+	logogCout->SetFormatter(*custom_format);
+
+	TCLAP::CmdLine cmd("Visits all faces and edges of a mesh with the different face and edge interfaces", ' ', "0.1");
+
+	TCLAP::ValueArg<std::string> mesh_arg("m", "mesh", "input mesh file", true, "", "string");
+	cmd.add( mesh_arg );
+
+	cmd.parse( argc, argv );
+
+	FileIO::MeshIO mesh_io;
+	MeshLib::Mesh* mesh(mesh_io.loadMeshFromFile(mesh_arg.getValue()));
+	if (mesh == NULL) {
+		ERR("could not read mesh from %s", mesh_arg.getValue().c_str());
+		delete custom_format;
+		delete logogCout;
+		LOGOG_SHUTDOWN();
+		return 1;
+	}
+	INFO("mesh with %d nodes and %d elements", mesh->getNNodes(), mesh->getNElements());
+
+	std::vector<MeshLib::Element*> const& elements(mesh->getElements());
+	const std::size_t n_elements(elements.size());
+	MeshLib::MeshTopology const& topology(mesh->getTopology());
+	BaseLib::RunTime run_time;
+
+	// all faces of all elements, the faces are created by the elements
+	run_time.start();
+	unsigned long checksum_get_face(0);
+	for (std::size_t k(0); k < n_elements; k++) {
+		const unsigned n_faces(elements[k]->getNNeighbors());
+		for (unsigned i(0); i < n_faces; i++) {
+			MeshLib::Element const*const face(elements[k]->getFace(i));
+			const unsigned n_face_nodes(face->getNNodes());
+			for (unsigned j(0); j < n_face_nodes; j++)
+				checksum_get_face += face->getNodeIndex(j);
+			delete face;
+		}
+	}
+	run_time.stop();
+	INFO("Element::getFace():     %f s", run_time.elapsed());
+
+	// all faces of all elements, node access without creating the faces
+	run_time.start();
+	unsigned long checksum_face_node(0);
+	for (std::size_t k(0); k < n_elements; k++) {
+		MeshLib::Element const*const elem(elements[k]);
+		const unsigned n_faces(elem->getNNeighbors());
+		for (unsigned i(0); i < n_faces; i++) {
+			const unsigned n_face_nodes(MeshLib::MeshTopology::getNFaceNodes(elem->getType(), i));
+			for (unsigned j(0); j < n_face_nodes; j++)
+				checksum_face_node += elem->getFaceNode(i, j)->getID();
+		}
+	}
+	run_time.stop();
+	INFO("Element::getFaceNode(): %f s", run_time.elapsed());
+
+	// all faces of all elements of the topology
+	run_time.start();
+	FaceCounter all_faces;
+	for (std::size_t k(0); k < n_elements; k++) {
+		const unsigned n_faces(topology.getNNeighbors(k));
+		for (unsigned i(0); i < n_faces; i++)
+			all_faces(MeshLib::FaceView(topology, k, i));
+	}
+	run_time.stop();
+	INFO("FaceView:               %f s", run_time.elapsed());
+
+	// every face once
+	run_time.start();
+	FaceCounter unique_faces;
+	MeshLib::forEachUniqueFace(topology, unique_faces);
+	run_time.stop();
+	INFO("forEachUniqueFace():    %f s, %d faces, %d boundary faces", run_time.elapsed(),
+		unique_faces.n_faces, unique_faces.n_boundary_faces);
+
+	// all edges of all elements, the edges are created by the elements
+	run_time.start();
+	unsigned long checksum_get_edge(0);
+	for (std::size_t k(0); k < n_elements; k++) {
+		const unsigned n_edges(elements[k]->getNEdges());
+		for (unsigned i(0); i < n_edges; i++) {
+			MeshLib::Element const*const edge(elements[k]->getEdge(i));
+			checksum_get_edge += edge->getNodeIndex(0) + edge->getNodeIndex(1);
+			delete edge;
+		}
+	}
+	run_time.stop();
+	INFO("Element::getEdge():     %f s", run_time.elapsed());
+
+	// all edges of all elements of the topology
+	run_time.start();
+	EdgeCounter all_edges;
+	for (std::size_t k(0); k < n_elements; k++) {
+		const unsigned n_edges(MeshLib::MeshTopology::getNEdges(topology.getType(k)));
+		for (unsigned i(0); i < n_edges; i++)
+			all_edges(MeshLib::EdgeView(topology, k, i));
+	}
+	run_time.stop();
+	INFO("EdgeView:               %f s", run_time.elapsed());
+
+	// every edge once
+	run_time.start();
+	EdgeCounter unique_edges;
+	MeshLib::forEachUniqueEdge(topology, unique_edges);
+	run_time.stop();
+	INFO("forEachUniqueEdge():    %f s, %d edges", run_time.elapsed(), unique_edges.n_edges);
+
+	bool ok(true);
+	if (checksum_get_face != checksum_face_node || checksum_get_face != all_faces.checksum) {
+		ERR("the face interfaces yield different face nodes");
+		ok = false;
+	}
+	if (checksum_get_edge != all_edges.checksum) {
+		ERR("the edge interfaces yield different edge nodes");
+		ok = false;
+	}
+	// every interior face is visited twice in the sweep over all faces
+	if (2 * unique_faces.n_faces - unique_faces.n_boundary_faces != all_faces.n_faces) {
+		ERR("the number of unique faces does not match the number of faces");
+		ok = false;
+	}
+	if (mesh->getDimension() == 3) {
+		INFO("Euler characteristic (nodes - edges + faces - cells): %ld",
+			static_cast<long>(mesh->getNNodes()) - static_cast<long>(unique_edges.n_edges)
+			+ static_cast<long>(unique_faces.n_faces) - static_cast<long>(n_elements));
+	}
+
+	delete mesh;
+	delete custom_format;
+	delete logogCout;
+	LOGOG_SHUTDOWN();
+
+	return ok ? 0 : 1;
+}
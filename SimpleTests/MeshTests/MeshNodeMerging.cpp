@@ -0,0 +1,124 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ * \file MeshNodeMerging.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <string>
+#include <vector>
+
+// BaseLib
+#include "RunTime.h"
+#include "tclap/CmdLine.h"
+
+// BaseLib/logog
+#include "logog.hpp"
+#include "formatter.hpp"
+
+// MeshLib
+#include "Mesh.h"
+#include "Node.h"
+#include "Elements/Element.h"
+#include "Elements/Quad.h"
+
+/**
+ * new formatter for logog
+ */
+class FormatterCustom : public logog::FormatterGCC
+{
+    virtual TOPIC_FLAGS GetTopicFlags( const logog::Topic &topic )
+    {
+        return ( Formatter::GetTopicFlags( topic ) &
+                 ~( TOPIC_FILE_NAME_FLAG | TOPIC_LINE_NUMBER_FLAG ));
+    }
+};
+
+/**
+ * Creates a quad mesh of [0,n1] x [0,n2] in the coordinate plane orthogonal to
+ * the given axis at the coordinate x0. Every quad has its own four nodes, i.e.
+ * all interior nodes are duplicated. An additional quad with two identical
+ * corners degenerates when the nodes are merged.
+ */
+MeshLib::Mesh* createPlaneMesh(unsigned n1, unsigned n2, unsigned axis, double x0)
+{
+	std::vector<MeshLib::Node*> nodes;
+	std::vector<MeshLib::Element*> elements;
+	for (unsigned j(0); j < n2; j++) {
+		for (unsigned i(0); i < n1; i++) {
+			MeshLib::Node* n[4];
+			for (unsigned l(0); l < 4; l++) {
+				double c[3];
+				c[axis] = x0;
+				c[(axis + 1) % 3] = i + ((l == 1 || l == 2) ? 1 : 0);
+				c[(axis + 2) % 3] = j + ((l >= 2) ? 1 : 0);
+				n[l] = new MeshLib::Node(c[0], c[1], c[2], nodes.size());
+				nodes.push_back(n[l]);
+			}
+			elements.push_back(new MeshLib::Quad(n[0], n[1], n[2], n[3]));
+		}
+	}
+
+	MeshLib::Node* n[4];
+	for (unsigned l(0); l < 4; l++) {
+		double c[3];
+		c[axis] = x0;
+		c[(axis + 1) % 3] = (l == 2) ? 1 : 0;
+		c[(axis + 2) % 3] = (l >= 2) ? 1 : 0;
+		n[l] = new MeshLib::Node(c[0], c[1], c[2], nodes.size());
+		nodes.push_back(n[l]);
+	}
+	elements.push_back(new MeshLib::Quad(n[0], n[1], n[2], n[3]));
+
+	return new MeshLib::Mesh("plane", nodes, elements);
+}
+
+int main(int argc, char *argv[])
+{
+	LOGOG_INITIALIZE();
+	FormatterCustom *custom_format (new FormatterCustom);
+	logog::Cout *logogCout(new logog::Cout);
+	logogCout->SetFormatter(*custom_format);
+
+	TCLAP::CmdLine cmd("Checks the merging of duplicate nodes on quad meshes in the coordinate planes", ' ', "0.1");
+
+	TCLAP::ValueArg<unsigned> n_arg("n", "n", "number of cells in each direction of the plane", false, 100, "number");
+	cmd.add( n_arg );
+
+	cmd.parse( argc, argv );
+
+	const unsigned n(n_arg.getValue());
+	const double x0s[2] = {0.0, 5.0};
+	BaseLib::RunTime run_time;
+
+	bool ok(true);
+	for (unsigned axis(0); axis < 3; axis++) {
+		for (unsigned k(0); k < 2; k++) {
+			run_time.start();
+			MeshLib::Mesh* mesh(createPlaneMesh(n, n, axis, x0s[k]));
+			run_time.stop();
+			INFO("plane orthogonal to axis %d at %f: %d nodes, %d elements, %f s", axis, x0s[k],
+				static_cast<int>(mesh->getNNodes()), static_cast<int>(mesh->getNElements()), run_time.elapsed());
+
+			if (mesh->getNNodes() != (n + 1) * (n + 1) || mesh->getNElements() != n * n) {
+				ERR("expected %d nodes and %d elements", static_cast<int>((n + 1) * (n + 1)),
+					static_cast<int>(n * n));
+				ok = false;
+			}
+			delete mesh;
+		}
+	}
+
+	if (ok)
+		INFO("all checks passed");
+
+	delete custom_format;
+	delete logogCout;
+	LOGOG_SHUTDOWN();
+
+	return ok ? 0 : 1;
+}
@@ -4,6 +4,8 @@
  * Created on 2012/05/09 by Karsten Rink
  */
 
+#include <algorithm>
+
 // BaseLib
 #include "MemWatch.h"
 #include "RunTime.h"
@@ -16,9 +18,176 @@
 // MeshLib
 #include "Node.h"
 #include "Elements/Element.h"
+#include "ElementView.h"
 #include "Mesh.h"
+#include "MeshArena.h"
 #include "Legacy/MeshIO.h"
 
+/**
+ * Compares the memory and the throughput of the element connectivity stored
+ * in Element objects (node and neighbour pointer arrays per element) and in
+ * the compact MeshTopology of the mesh. The throughput is measured by
+ * counting the faces without neighbour and summing up the node indices.
+ */
+void compareElementStorage(MeshLib::Mesh const& mesh)
+{
+	std::vector<MeshLib::Element*> const& elements(mesh.getElements());
+	MeshLib::MeshTopology const& topology(mesh.getTopology());
+	const size_t n_elements(elements.size());
+
+	// Element object (at least the base class), node and neighbour arrays and the heap block headers
+	size_t mem_elements(elements.capacity() * sizeof(MeshLib::Element*));
+	for (size_t k(0); k < n_elements; k++)
+		mem_elements += sizeof(MeshLib::Element) + 6 * sizeof(void*)
+			+ elements[k]->getNNodes() * sizeof(MeshLib::Node*)
+			+ elements[k]->getNNeighbors() * sizeof(MeshLib::Element*);
+	INFO("memory for elements: objects %d KB (%d B per element), topology %d KB",
+		mem_elements / 1024, mem_elements / n_elements, topology.getMemoryUsage() / 1024);
+
+	const unsigned n_runs(20);
+	size_t n_boundary_faces(0), node_sum(0);
+	BaseLib::RunTime run_time;
+	run_time.start();
+	for (unsigned r(0); r < n_runs; r++) {
+		n_boundary_faces = 0;
+		node_sum = 0;
+		for (size_t k(0); k < n_elements; k++) {
+			MeshLib::Element const*const elem(elements[k]);
+			const unsigned n_nodes(elem->getNNodes());
+			for (unsigned i(0); i < n_nodes; i++)
+				node_sum += elem->getNode(i)->getID();
+			const unsigned n_neighbors(elem->getNNeighbors());
+			for (unsigned i(0); i < n_neighbors; i++)
+				if (elem->getNeighbor(i) == NULL)
+					n_boundary_faces++;
+		}
+	}
+	run_time.stop();
+	const double t_objects(run_time.elapsed() / n_runs);
+	INFO("element objects: %d faces without neighbour, sum of node indices %d", n_boundary_faces, node_sum);
+
+	run_time.start();
+	for (unsigned r(0); r < n_runs; r++) {
+		n_boundary_faces = 0;
+		node_sum = 0;
+		for (size_t k(0); k < n_elements; k++) {
+			const MeshLib::ElementView elem(topology.getElement(k));
+			const unsigned n_nodes(elem.getNNodes());
+			unsigned const*const nodes(elem.getNodeIndices());
+			for (unsigned i(0); i < n_nodes; i++)
+				node_sum += nodes[i];
+			const unsigned n_neighbors(elem.getNNeighbors());
+			for (unsigned i(0); i < n_neighbors; i++)
+				if (elem.getNeighborIndex(i) == MeshLib::MeshTopology::NO_NEIGHBOR)
+					n_boundary_faces++;
+		}
+	}
+	run_time.stop();
+	const double t_topology(run_time.elapsed() / n_runs);
+	INFO("topology: %d faces without neighbour, sum of node indices %d", n_boundary_faces, node_sum);
+	INFO("time for the connectivity sweep: objects %e s, topology %e s", t_objects, t_topology);
+}
+
+/**
+ * Compares the construction time and the memory of the node-element
+ * adjacency stored in one std::vector<Element*> per node (filled element by
+ * element) and in the compressed row storage of the mesh topology.
+ */
+void compareNodeElementStorage(MeshLib::Mesh const& mesh)
+{
+	std::vector<MeshLib::Element*> const& elements(mesh.getElements());
+	const size_t n_nodes(mesh.getNNodes());
+	const size_t n_elements(elements.size());
+
+	BaseLib::RunTime run_time;
+	run_time.start();
+	std::vector<std::vector<MeshLib::Element*> > node_elements(n_nodes);
+	for (size_t k(0); k < n_elements; k++) {
+		const unsigned n_elem_nodes(elements[k]->getNNodes());
+		for (unsigned i(0); i < n_elem_nodes; i++)
+			node_elements[elements[k]->getNodeIndex(i)].push_back(elements[k]);
+	}
+	run_time.stop();
+	const double t_vectors(run_time.elapsed());
+	// the vector objects, the arrays and the heap block headers
+	size_t mem_vectors(n_nodes * sizeof(std::vector<MeshLib::Element*>));
+	for (size_t k(0); k < n_nodes; k++)
+		if (node_elements[k].capacity() > 0)
+			mem_vectors += node_elements[k].capacity() * sizeof(MeshLib::Element*) + 2 * sizeof(void*);
+
+	MeshLib::MeshTopology topology(elements);
+	const size_t mem_without(topology.getMemoryUsage());
+	run_time.start();
+	topology.computeNodeElements(n_nodes);
+	run_time.stop();
+	const size_t mem_csr(topology.getMemoryUsage() - mem_without);
+
+	size_t n_differences(0);
+	for (size_t k(0); k < n_nodes; k++) {
+		// valid as long as the mesh is not changed
+		MeshLib::NodeElements const& node_elems(mesh.getNode(k)->getElements());
+		if (node_elems.size() != node_elements[k].size() || node_elems.size() != topology.getNNodeElements(k)) {
+			n_differences++;
+			continue;
+		}
+		for (size_t i(0); i < node_elems.size(); i++)
+			if (node_elems[i] != node_elements[k][i] || topology.getNodeElementIndices(k)[i] != node_elems.getIndex(i))
+				n_differences++;
+	}
+	INFO("node-element adjacency: per node vectors %e s, %d KB, compressed row storage %e s, %d KB, %d differences",
+		t_vectors, mem_vectors / 1024, run_time.elapsed(), mem_csr / 1024, n_differences);
+}
+
+/**
+ * Reports the allocations of the nodes and elements of the mesh (created in
+ * the arena by the reader) and compares the destruction of the mesh with
+ * the destruction of a copy whose nodes and elements are allocated one by one.
+ */
+void compareAllocation(MeshLib::Mesh const& mesh)
+{
+	std::vector<MeshLib::Element*> const& elements(mesh.getElements());
+	const size_t n_elements(elements.size());
+	// the object, the node array and the neighbour array of every element
+	size_t n_heap_allocations(mesh.getNNodes() + 2 * n_elements);
+	for (size_t k(0); k < n_elements; k++)
+		if (elements[k]->getNNeighbors() > 0)
+			n_heap_allocations++;
+
+	MeshLib::MeshArena const*const arena(mesh.getArena());
+	if (arena) {
+		INFO("allocations for nodes and elements: one by one %d, arena %d in %d blocks (%d KB)",
+			n_heap_allocations, arena->getNAllocations(), arena->getNBlocks(), arena->getMemoryUsage() / 1024);
+	} else {
+		INFO("allocations for nodes and elements: one by one %d, the mesh has no arena", n_heap_allocations);
+	}
+
+	MeshLib::Mesh* copy(new MeshLib::Mesh(mesh));
+	BaseLib::RunTime run_time;
+	run_time.start();
+	delete copy;
+	run_time.stop();
+	INFO("time for deleting a copy of the mesh with objects allocated one by one: %f s", run_time.elapsed());
+}
+
+/**
+ * Measures the export of the element connectivity and the face hash based
+ * neighbour computation that are part of the mesh construction.
+ */
+void timeNeighborComputation(MeshLib::Mesh const& mesh)
+{
+	BaseLib::RunTime run_time;
+	run_time.start();
+	MeshLib::MeshTopology topology(mesh.getElements());
+	run_time.stop();
+	const double t_export(run_time.elapsed());
+
+	run_time.start();
+	topology.computeNeighbors();
+	run_time.stop();
+	INFO("time for the topology export %e s, for the neighbour computation %e s, %d boundary faces",
+		t_export, run_time.elapsed(), topology.getBoundaryFaces().size());
+}
+
 int main(int argc, char *argv[])
 {
 	LOGOG_INITIALIZE();
@@ -55,19 +224,30 @@ int main(int argc, char *argv[])
 	run_time.stop();
 //	std::cout << "time for reading: " << run_time.elapsed() << " s" << std::endl;
 	INFO ("time for reading: %f s", run_time.elapsed());
+	if (mesh == NULL) {
+		ERR ("could not read mesh from %s", fname.c_str());
+		delete logogCout;
+		LOGOG_SHUTDOWN();
+		return -1;
+	}
 
+	compareElementStorage(*mesh);
+	compareNodeElementStorage(*mesh);
+	compareAllocation(*mesh);
+	timeNeighborComputation(*mesh);
 
-	unsigned elem_id = 25000;
-	const MeshLib::Element* e = mesh->getElement(elem_id);
-	const size_t nElems = mesh->getNElements();
-	for (unsigned i=0; i< e->getNNeighbors(); i++)
+	unsigned elem_id = std::min(static_cast<size_t>(25000), mesh->getNElements() - 1);
+	const MeshLib::ElementView e (mesh->getTopology().getElement(elem_id));
+	for (unsigned i=0; i< e.getNNeighbors(); i++)
 	{
-		for (unsigned j=0; j< nElems; j++)
-			if (mesh->getElement(j) == e->getNeighbor(i))
-				std::cout << "neighbour of element " << elem_id << elem_id << " : " << j << std::endl;
+		if (e.getNeighborIndex(i) != MeshLib::MeshTopology::NO_NEIGHBOR)
+			std::cout << "neighbour of element " << elem_id << " : " << e.getNeighborIndex(i) << std::endl;
 	}
 
+	run_time.start();
 	delete mesh;
+	run_time.stop();
+	INFO("time for deleting the mesh: %f s", run_time.elapsed());
 	delete logogCout;
 	LOGOG_SHUTDOWN();
 }
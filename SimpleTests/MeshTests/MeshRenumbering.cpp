@@ -0,0 +1,176 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ * \file MeshRenumbering.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// BaseLib
+#include "RunTime.h"
+#include "tclap/CmdLine.h"
+
+// BaseLib/logog
+#include "logog.hpp"
+#include "formatter.hpp"
+
+// MathLib
+#include "LinAlg/Sparse/amuxCRS.h"
+#include "LinAlg/Sparse/CRSMatrixStatistics.h"
+
+// MeshLib
+#include "Mesh.h"
+#include "MeshTopology.h"
+#include "MeshRenumbering.h"
+#include "Node.h"
+#include "Legacy/MeshIO.h"
+
+/**
+ * new formatter for logog
+ */
+class FormatterCustom : public logog::FormatterGCC
+{
+    virtual TOPIC_FLAGS GetTopicFlags( const logog::Topic &topic )
+    {
+        return ( Formatter::GetTopicFlags( topic ) &
+                 ~( TOPIC_FILE_NAME_FLAG | TOPIC_LINE_NUMBER_FLAG ));
+    }
+};
+
+/**
+ * Assembles the graph Laplacian of the node graph (the pattern of the
+ * matrices assembled on the mesh) and reports its bandwidth, profile and
+ * the time of a matrix vector multiplication. The mean index distance of
+ * neighbouring elements measures the locality of the element numbering.
+ * @return the euclidean norm of A x for x = the x coordinates of the nodes,
+ * which does not depend on the numbering
+ */
+double reportLocality(MeshLib::Mesh const& mesh, std::string const& name, unsigned n_runs)
+{
+	MeshLib::MeshTopology const& topology(mesh.getTopology());
+	std::vector<unsigned> ptr, adj;
+	topology.getNodeGraph(ptr, adj);
+
+	// the diagonal entry is inserted at its place in the sorted row
+	const unsigned n(static_cast<unsigned>(ptr.size() - 1));
+	std::vector<unsigned> iA(n + 1), jA;
+	std::vector<double> A;
+	jA.reserve(adj.size() + n);
+	A.reserve(adj.size() + n);
+	iA[0] = 0;
+	for (unsigned i(0); i < n; i++) {
+		bool diagonal(false);
+		for (unsigned j(ptr[i]); j < ptr[i + 1]; j++) {
+			if (!diagonal && adj[j] > i) {
+				jA.push_back(i);
+				A.push_back(ptr[i + 1] - ptr[i]);
+				diagonal = true;
+			}
+			jA.push_back(adj[j]);
+			A.push_back(-1.0);
+		}
+		if (!diagonal) {
+			jA.push_back(i);
+			A.push_back(ptr[i + 1] - ptr[i]);
+		}
+		iA[i + 1] = static_cast<unsigned>(jA.size());
+	}
+
+	MathLib::CRSMatrixStatistics stats;
+	MathLib::computeCRSMatrixStatistics(n, &iA[0], &jA[0], &A[0], stats, 1);
+
+	std::vector<double> x(n);
+	for (unsigned i(0); i < n; i++)
+		x[i] = (*mesh.getNode(i))[0];
+	std::vector<double> y(n);
+	BaseLib::RunTime run_time;
+	run_time.start();
+	for (unsigned r(0); r < n_runs; r++)
+		MathLib::amuxCRS<double, unsigned>(1.0, n, &iA[0], &jA[0], &A[0], &x[0], &y[0]);
+	run_time.stop();
+	double norm(0.0);
+	for (unsigned i(0); i < n; i++)
+		norm += y[i] * y[i];
+
+	double elem_distance(0.0);
+	std::size_t n_neighbors(0);
+	for (std::size_t e(0); e < topology.getNElements(); e++) {
+		unsigned const*const neighbors(topology.getNeighborIndices(e));
+		for (unsigned i(0); i < topology.getNNeighbors(e); i++) {
+			if (neighbors[i] != MeshLib::MeshTopology::NO_NEIGHBOR) {
+				elem_distance += std::abs(static_cast<double>(neighbors[i]) - static_cast<double>(e));
+				n_neighbors++;
+			}
+		}
+	}
+
+	INFO("%s: bandwidth %d, profile %e, mean distance %f, mean element neighbour distance %f",
+		name.c_str(), stats.bandwidth, stats.profile, stats.mean_distance,
+		n_neighbors > 0 ? elem_distance / n_neighbors : 0.0);
+	INFO("%s: time for one amux %e s, |A x| = %.12e", name.c_str(), run_time.elapsed() / n_runs, std::sqrt(norm));
+	return std::sqrt(norm);
+}
+
+int main(int argc, char *argv[])
+{
+	LOGOG_INITIALIZE();
+	FormatterCustom *custom_format (new FormatterCustom);
+	logog::Cout *logogCout(new logog::Cout);
+	logogCout->SetFormatter(*custom_format);
+
+	TCLAP::CmdLine cmd("Renumbers the nodes and elements of a mesh and compares the locality", ' ', "0.1");
+
+	TCLAP::ValueArg<std::string> mesh_arg("m", "mesh", "input mesh file", true, "", "string");
+	cmd.add( mesh_arg );
+
+	TCLAP::ValueArg<std::string> method_arg("r", "renumbering", "hilbert, morton or rcm", false, "hilbert", "string");
+	cmd.add( method_arg );
+
+	TCLAP::ValueArg<unsigned> runs_arg("n", "runs", "number of matrix vector multiplications", false, 20, "number");
+	cmd.add( runs_arg );
+
+	cmd.parse( argc, argv );
+
+	FileIO::MeshIO mesh_io;
+	MeshLib::Mesh* mesh(mesh_io.loadMeshFromFile(mesh_arg.getValue()));
+	if (mesh == NULL) {
+		ERR("could not read mesh from %s", mesh_arg.getValue().c_str());
+		delete custom_format;
+		delete logogCout;
+		LOGOG_SHUTDOWN();
+		return 1;
+	}
+	INFO("mesh with %d nodes and %d elements", mesh->getNNodes(), mesh->getNElements());
+
+	const double norm_before(reportLocality(*mesh, "original numbering", runs_arg.getValue()));
+
+	BaseLib::RunTime run_time;
+	run_time.start();
+	MeshLib::MeshRenumbering renumbering(*mesh);
+	renumbering(MeshLib::convertStringToMeshRenumberingMethod(method_arg.getValue()));
+	run_time.stop();
+	INFO("time for the renumbering (%s): %f s", method_arg.getValue().c_str(), run_time.elapsed());
+
+	const double norm_after(reportLocality(*mesh, "renumbered", runs_arg.getValue()));
+
+	bool ok(true);
+	if (std::abs(norm_before - norm_after) > 1e-10 * norm_before) {
+		ERR("the renumbered matrix is not a permutation of the original matrix");
+		ok = false;
+	}
+
+	delete mesh;
+	delete custom_format;
+	delete logogCout;
+	LOGOG_SHUTDOWN();
+
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,229 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ * \file MeshSurfaceExtraction.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+// BaseLib
+#include "RunTime.h"
+#include "tclap/CmdLine.h"
+
+// BaseLib/logog
+#include "logog.hpp"
+#include "formatter.hpp"
+
+// GeoLib
+#include "PointWithID.h"
+
+// MathLib
+#include "MathTools.h"
+
+// MeshLib
+#include "Mesh.h"
+#include "MshEditor.h"
+#include "Node.h"
+#include "Elements/Element.h"
+#include "Elements/Face.h"
+#include "Elements/Hex.h"
+#include "Elements/Prism.h"
+
+/**
+ * new formatter for logog
+ */
+class FormatterCustom : public logog::FormatterGCC
+{
+    virtual TOPIC_FLAGS GetTopicFlags( const logog::Topic &topic )
+    {
+        return ( Formatter::GetTopicFlags( topic ) &
+                 ~( TOPIC_FILE_NAME_FLAG | TOPIC_LINE_NUMBER_FLAG ));
+    }
+};
+
+/**
+ * Creates a layered mesh of the box [0,nx] x [0,ny] x [0,nz] rotated by the
+ * given angle around the z axis. Every cell is a hexahedron or is split into
+ * two prisms.
+ */
+MeshLib::Mesh* createLayeredMesh(unsigned nx, unsigned ny, unsigned nz, double angle, bool prisms)
+{
+	const double c(cos(angle)), s(sin(angle));
+	std::vector<MeshLib::Node*> nodes;
+	for (unsigned k(0); k <= nz; k++)
+		for (unsigned j(0); j <= ny; j++)
+			for (unsigned i(0); i <= nx; i++)
+				nodes.push_back(new MeshLib::Node(c * i - s * j, s * i + c * j, k, nodes.size()));
+
+	std::vector<MeshLib::Element*> elements;
+	for (unsigned k(0); k < nz; k++) {
+		for (unsigned j(0); j < ny; j++) {
+			for (unsigned i(0); i < nx; i++) {
+				MeshLib::Node* n[8];
+				for (unsigned l(0); l < 2; l++) {
+					const unsigned base((k + l) * (ny + 1) * (nx + 1) + j * (nx + 1) + i);
+					n[4 * l] = nodes[base];
+					n[4 * l + 1] = nodes[base + 1];
+					n[4 * l + 2] = nodes[base + nx + 2];
+					n[4 * l + 3] = nodes[base + nx + 1];
+				}
+				if (prisms) {
+					elements.push_back(new MeshLib::Prism(n[0], n[1], n[2], n[4], n[5], n[6], k));
+					elements.push_back(new MeshLib::Prism(n[0], n[2], n[3], n[4], n[6], n[7], k));
+				} else {
+					elements.push_back(new MeshLib::Hex(n[0], n[1], n[2], n[3], n[4], n[5], n[6], n[7], k));
+				}
+			}
+		}
+	}
+	return new MeshLib::Mesh(prisms ? "prisms" : "hexahedra", nodes, elements);
+}
+
+/**
+ * checks the number of nodes and elements of the surface, the orientation
+ * of the surface elements: their normals have to point away from the centre
+ * of the (convex) mesh and they have to have a positive scalar product with
+ * dir (if given)
+ */
+bool checkSurface(MeshLib::Mesh const* sfc, std::size_t n_nodes, std::size_t n_elements,
+	double const* centre, double const* dir)
+{
+	if (sfc == NULL) {
+		ERR("no surface mesh");
+		return false;
+	}
+	bool ok(true);
+	if (sfc->getNNodes() != n_nodes || sfc->getNElements() != n_elements) {
+		ERR("surface %s: %d nodes and %d elements, expected %d nodes and %d elements", sfc->getName().c_str(),
+			static_cast<int>(sfc->getNNodes()), static_cast<int>(sfc->getNElements()),
+			static_cast<int>(n_nodes), static_cast<int>(n_elements));
+		ok = false;
+	}
+	if (sfc->getDimension() != 2) {
+		ERR("surface %s has dimension %d", sfc->getName().c_str(), sfc->getDimension());
+		ok = false;
+	}
+
+	std::size_t n_inward(0);
+	double normal_sum[3] = {0, 0, 0};
+	for (std::size_t k(0); k < sfc->getNElements(); k++) {
+		MeshLib::Face const*const face(dynamic_cast<MeshLib::Face const*>(sfc->getElement(k)));
+		if (face == NULL) {
+			n_inward++;
+			continue;
+		}
+		double normal[3], outward[3] = {0, 0, 0};
+		face->getSurfaceNormal(normal);
+		const unsigned n_face_nodes(face->getNNodes());
+		for (unsigned j(0); j < n_face_nodes; j++)
+			for (unsigned i(0); i < 3; i++)
+				outward[i] += ((*face->getNode(j))[i] - centre[i]) / n_face_nodes;
+		if (MathLib::scpr<double,3>(normal, outward) <= 0
+			|| (dir != NULL && MathLib::scpr<double,3>(normal, dir) <= 0))
+			n_inward++;
+		for (unsigned i(0); i < 3; i++)
+			normal_sum[i] += normal[i];
+	}
+	if (n_inward > 0) {
+		ERR("surface %s: %d elements are not oriented outward", sfc->getName().c_str(),
+			static_cast<int>(n_inward));
+		ok = false;
+	}
+	INFO("surface %s: %d nodes, %d elements, sum of the normals (%e, %e, %e)", sfc->getName().c_str(),
+		static_cast<int>(sfc->getNNodes()), static_cast<int>(sfc->getNElements()), normal_sum[0], normal_sum[1], normal_sum[2]);
+	return ok;
+}
+
+int main(int argc, char *argv[])
+{
+	LOGOG_INITIALIZE();
+	FormatterCustom *custom_format (new FormatterCustom);
+	logog::Cout *logogCout(new logog::Cout);
+	logogCout->SetFormatter(*custom_format);
+
+	TCLAP::CmdLine cmd("Checks the surface extraction of MshEditor on rotated layered hexahedral and prism meshes", ' ', "0.1");
+
+	TCLAP::ValueArg<unsigned> nx_arg("x", "nx", "number of cells in x direction", false, 10, "number");
+	cmd.add( nx_arg );
+	TCLAP::ValueArg<unsigned> ny_arg("y", "ny", "number of cells in y direction", false, 10, "number");
+	cmd.add( ny_arg );
+	TCLAP::ValueArg<unsigned> nz_arg("z", "nz", "number of layers", false, 4, "number");
+	cmd.add( nz_arg );
+	TCLAP::ValueArg<double> angle_arg("a", "angle", "rotation angle around the z axis in degrees", false, 30.0, "number");
+	cmd.add( angle_arg );
+
+	cmd.parse( argc, argv );
+
+	const std::size_t nx(nx_arg.getValue()), ny(ny_arg.getValue()), nz(nz_arg.getValue());
+	const double angle(angle_arg.getValue() * M_PI / 180.0);
+	const std::size_t n_top_nodes((nx + 1) * (ny + 1));
+	const std::size_t n_surface_nodes(2 * n_top_nodes + (nz - 1) * 2 * (nx + ny));
+	const std::size_t n_side_faces(2 * nz * (nx + ny));
+	// the rotated box has the centre of the unrotated box on the rotated x and y axes
+	const double centre[3] = {
+		0.5 * (cos(angle) * nx - sin(angle) * ny), 0.5 * (sin(angle) * nx + cos(angle) * ny), 0.5 * nz };
+	const double up[3] = {0, 0, 1};
+	BaseLib::RunTime run_time;
+
+	bool ok(true);
+	for (unsigned prisms(0); prisms < 2; prisms++) {
+		MeshLib::Mesh* mesh(createLayeredMesh(nx, ny, nz, angle, prisms == 1));
+		const std::size_t n_top_faces((prisms == 1 ? 2 : 1) * nx * ny);
+		INFO("mesh %s: %d nodes, %d elements", mesh->getName().c_str(),
+			static_cast<int>(mesh->getNNodes()), static_cast<int>(mesh->getNElements()));
+
+		// complete surface
+		run_time.start();
+		MeshLib::Mesh* sfc(MeshLib::MshEditor::getMeshSurface(*mesh));
+		run_time.stop();
+		INFO("complete surface: %f s", run_time.elapsed());
+		ok = checkSurface(sfc, n_surface_nodes, 2 * n_top_faces + n_side_faces, centre, NULL) && ok;
+
+		// top surface
+		MeshLib::Mesh* top(MeshLib::MshEditor::getMeshSurface(*mesh, up));
+		ok = checkSurface(top, n_top_nodes, n_top_faces, centre, up) && ok;
+
+		// the surface of a 2d mesh consists of copies of the elements with matching normal
+		if (top != NULL) {
+			MeshLib::Mesh* top_copy(MeshLib::MshEditor::getMeshSurface(*top, up));
+			ok = checkSurface(top_copy, n_top_nodes, n_top_faces, centre, up) && ok;
+			delete top_copy;
+		}
+
+		// surface nodes: the top nodes with their mesh indices
+		std::vector<GeoLib::PointWithID*> sfc_nodes(MeshLib::MshEditor::getSurfaceNodes(*mesh));
+		std::size_t n_wrong(0);
+		for (std::size_t k(0); k < sfc_nodes.size(); k++) {
+			MeshLib::Node const& node(*mesh->getNode(sfc_nodes[k]->getID()));
+			if ((*sfc_nodes[k])[2] != static_cast<double>(nz) || node[0] != (*sfc_nodes[k])[0]
+				|| node[1] != (*sfc_nodes[k])[1] || node[2] != (*sfc_nodes[k])[2])
+				n_wrong++;
+			delete sfc_nodes[k];
+		}
+		if (sfc_nodes.size() != n_top_nodes || n_wrong > 0) {
+			ERR("getSurfaceNodes(): %d nodes (expected %d), %d nodes with wrong id or not on top",
+				static_cast<int>(sfc_nodes.size()), static_cast<int>(n_top_nodes), static_cast<int>(n_wrong));
+			ok = false;
+		}
+
+		delete top;
+		delete sfc;
+		delete mesh;
+	}
+
+	if (ok)
+		INFO("all checks passed");
+
+	delete custom_format;
+	delete logogCout;
+	LOGOG_SHUTDOWN();
+
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,133 @@
+#include <fstream>
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include "LinAlg/Solvers/BiCGStab.h"
+#include "LinAlg/Solvers/GMRes.h"
+#include "LinAlg/Sparse/CRSMatrixAdditiveSchwarzPrecond.h"
+#ifdef USE_ND_PERMUTATION
+#include "LinAlg/Sparse/NestedDissectionPermutation/Cluster.h"
+#endif
+#include "sparse.h"
+#include "vector_io.h"
+#include "RunTime.h"
+#include "CPUTime.h"
+
+int main(int argc, char *argv[])
+{
+	if (argc < 5 || argc > 6) {
+		std::cout << "Usage: " << argv[0] << " matrix rhs max-block-size overlap [sparse]" << std::endl;
+		return -1;
+	}
+
+	const unsigned max_block_size(atoi(argv[3]));
+	const unsigned overlap(atoi(argv[4]));
+	const bool sparse_local_solver(argc == 6 && std::string(argv[5]).compare("sparse") == 0);
+
+	// *** reading matrix in crs format from file
+	std::string fname(argv[1]);
+	MathLib::CRSMatrixAdditiveSchwarzPrecond *mat (new MathLib::CRSMatrixAdditiveSchwarzPrecond(fname));
+
+	unsigned n (mat->getNRows());
+	std::cout << "Parameters read: n=" << n << ", nnz=" << mat->getNNZ() << std::endl;
+
+	double *x(new double[n]);
+	double *b(new double[n]);
+
+	// *** read rhs
+	fname = argv[2];
+	std::ifstream in(fname.c_str());
+	if (in) {
+		read (in, n, b);
+		in.close();
+	} else {
+		std::cout << "problem reading rhs - initializing b with 1.0" << std::endl;
+		for (size_t k(0); k<n; k++) {
+			b[k] = 1.0;
+		}
+	}
+
+	BaseLib::RunTime run_timer;
+	BaseLib::CPUTime cpu_timer;
+
+	// *** subdomains: leaves of the nested dissection cluster tree
+	unsigned *op_perm(NULL);
+	std::vector<unsigned> leaf_ptr;
+#ifdef USE_ND_PERMUTATION
+	std::cout << "calculating nested dissection permutation ... " << std::flush;
+	run_timer.start();
+	MathLib::Cluster cluster_tree(n, const_cast<unsigned*>(mat->getRowPtrArray()),
+			const_cast<unsigned*>(mat->getColIdxArray()));
+	op_perm = new unsigned[n];
+	unsigned *po_perm(new unsigned[n]);
+	for (unsigned k(0); k<n; k++)
+		op_perm[k] = po_perm[k] = k;
+	cluster_tree.createClusterTree(op_perm, po_perm, max_block_size);
+	cluster_tree.getLeafIntervals(leaf_ptr);
+	delete [] po_perm;
+	run_timer.stop();
+	std::cout << "took " << run_timer.elapsed() << " sec" << std::endl;
+#else
+	leaf_ptr.push_back(0);
+	leaf_ptr.push_back(n);
+#endif
+
+	std::cout << "setting up the additive Schwarz preconditioner ... " << std::flush;
+	run_timer.start();
+	cpu_timer.start();
+	mat->calcPrecond(leaf_ptr.size() - 1, &leaf_ptr[0], op_perm, max_block_size, overlap,
+			sparse_local_solver ? MathLib::CRSMatrixAdditiveSchwarzPrecond::SPARSE_LDLT
+				: MathLib::CRSMatrixAdditiveSchwarzPrecond::DENSE_LU);
+	cpu_timer.stop();
+	run_timer.stop();
+	std::cout << "took " << cpu_timer.elapsed() << " sec time and " << run_timer.elapsed() << " sec" << std::endl;
+	std::cout << "\t" << mat->getNSubdomains() << " subdomains, largest subdomain has "
+		<< mat->getMaxSubdomainSize() << " indices" << std::endl;
+
+	// *** BiCGStab
+	for (size_t k(0); k<n; k++)
+		x[k] = 0.0;
+	double eps (1.0e-6);
+	unsigned steps (4000);
+	std::cout << "solving system with BiCGStab method (additive Schwarz preconditioner) ... " << std::flush;
+	run_timer.start();
+	cpu_timer.start();
+	MathLib::BiCGStab ((*mat), b, x, eps, steps);
+	cpu_timer.stop();
+	run_timer.stop();
+	std::cout << " in " << steps << " iterations" << std::endl;
+	std::cout << "\t(residuum is " << eps << ") took " << cpu_timer.elapsed() << " sec time and " << run_timer.elapsed() << " sec" << std::endl;
+
+	// *** GMRes
+	for (size_t k(0); k<n; k++)
+		x[k] = 0.0;
+	eps = 1.0e-6;
+	steps = 4000;
+	std::cout << "solving system with GMRes(30) method (additive Schwarz preconditioner) ... " << std::flush;
+	run_timer.start();
+	cpu_timer.start();
+	MathLib::GMRes ((*mat), b, x, eps, 30, steps);
+	cpu_timer.stop();
+	run_timer.stop();
+	std::cout << " in " << steps << " iterations" << std::endl;
+	std::cout << "\t(residuum is " << eps << ") took " << cpu_timer.elapsed() << " sec time and " << run_timer.elapsed() << " sec" << std::endl;
+
+	// *** check the residual
+	double *r(new double[n]);
+	mat->amux(1.0, x, r);
+	double nrm_r(0.0), nrm_b(0.0);
+	for (size_t k(0); k<n; k++) {
+		nrm_r += (b[k]-r[k]) * (b[k]-r[k]);
+		nrm_b += b[k] * b[k];
+	}
+	std::cout << "relative residual of the GMRes solution: " << sqrt(nrm_r/nrm_b) << std::endl;
+
+	delete mat;
+	delete [] op_perm;
+	delete [] r;
+	delete [] x;
+	delete [] b;
+
+	return 0;
+}
@@ -0,0 +1,104 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file ConjugateGradientChebyshevPrecond.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <fstream>
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+#include "LinAlg/Solvers/CG.h"
+#include "LinAlg/Sparse/CRSMatrixChebyshevPrecond.h"
+#include "sparse.h"
+#include "vector_io.h"
+#include "RunTime.h"
+#include "CPUTime.h"
+
+int main(int argc, char *argv[])
+{
+	if (argc != 4) {
+		std::cout << "Usage: " << argv[0] << " matrix rhs polynomial-degree" << std::endl;
+		return -1;
+	}
+
+	const unsigned degree(atoi(argv[3]));
+
+	// *** reading matrix in crs format from file
+	std::string fname(argv[1]);
+	MathLib::CRSMatrixChebyshevPrecond *mat (new MathLib::CRSMatrixChebyshevPrecond(fname));
+
+	unsigned n (mat->getNRows());
+	std::cout << "Parameters read: n=" << n << std::endl;
+
+	double *x(new double[n]);
+	double *b(new double[n]);
+
+	// *** init start vector x
+	for (size_t k(0); k<n; k++) {
+		x[k] = 0.0;
+	}
+	// *** read rhs
+	fname = argv[2];
+	std::ifstream in(fname.c_str());
+	if (in) {
+		read (in, n, b);
+		in.close();
+	} else {
+		std::cout << "problem reading rhs - initializing b with 1.0" << std::endl;
+		for (size_t k(0); k<n; k++) {
+			b[k] = 1.0;
+		}
+	}
+
+	BaseLib::RunTime run_timer;
+	run_timer.start();
+	mat->calcPrecond(degree);
+	run_timer.stop();
+	std::cout << "estimated spectrum of D^{-1} A: [" << mat->getLambdaMin() << ", "
+		<< mat->getLambdaMax() << "] (" << run_timer.elapsed() << " s)" << std::endl;
+
+	std::cout << "solving system with PCG method (Chebyshev preconditioner of degree "
+		<< degree << ") ... " << std::flush;
+
+	double eps (1.0e-6);
+	unsigned steps (4000);
+	BaseLib::CPUTime cpu_timer;
+	run_timer.start();
+	cpu_timer.start();
+
+	MathLib::CG(mat, b, x, eps, steps);
+
+	cpu_timer.stop();
+	run_timer.stop();
+
+	std::cout << " in " << steps << " iterations" << std::endl;
+	std::cout << "\t(residuum is " << eps << ") took " << cpu_timer.elapsed() << " sec time and " << run_timer.elapsed() << " sec" << std::endl;
+
+	// a few smoothing steps starting from zero
+	double *r(new double[n]);
+	for (size_t k(0); k<n; k++) {
+		x[k] = 0.0;
+	}
+	for (unsigned s(0); s < 5; s++) {
+		mat->smooth(b, x);
+		mat->amux(1.0, x, r);
+		double nrm(0.0);
+		for (size_t k(0); k<n; k++)
+			nrm += (b[k]-r[k]) * (b[k]-r[k]);
+		std::cout << "smoothing step " << s+1 << ": residual norm " << sqrt(nrm) << std::endl;
+	}
+
+	delete mat;
+	delete [] r;
+	delete [] x;
+	delete [] b;
+
+	return 0;
+}
@@ -23,6 +23,7 @@ int main(int argc, char *argv[])
 	// *** reading matrix in crs format from file
 	std::string fname(argv[1]);
 	MathLib::CRSMatrixDiagPrecond *mat(new MathLib::CRSMatrixDiagPrecond(fname));
+	mat->calcPrecond();
 
 	unsigned n(mat->getNRows());
 	bool verbose(true);
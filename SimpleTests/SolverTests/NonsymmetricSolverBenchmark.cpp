@@ -0,0 +1,152 @@
+/**
+ * Copyright (c) 2012, OpenGeoSys Community (http://www.opengeosys.com)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.com/LICENSE.txt
+ *
+ *
+ * \file NonsymmetricSolverBenchmark.cpp
+ *
+ * Created on 2026-10-18 by agent
+ */
+
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "LinAlg/Solvers/BiCGStab.h"
+#include "LinAlg/Solvers/BiCGStabL.h"
+#include "LinAlg/Solvers/GMRes.h"
+#include "LinAlg/Solvers/IDRs.h"
+#include "LinAlg/Solvers/vectorKernels.h"
+#include "LinAlg/Sparse/CRSMatrixDiagPrecond.h"
+#include "sparse.h"
+#include "vector_io.h"
+#include "RunTime.h"
+
+enum SolverType {
+	BICGSTAB,
+	BICGSTAB_L,
+	IDR_S,
+	GMRES
+};
+
+/**
+ * Solves the system with the given method starting from x = 0 and prints
+ * the number of matrix vector multiplications, the time and the true
+ * residual.
+ * @return false if the method reports convergence but the true residual does
+ * not match the tolerance, true otherwise (stagnation and breakdown for hard
+ * problems are reported only)
+ */
+bool run(MathLib::CRSMatrixDiagPrecond const& mat, double* b, SolverType type,
+		unsigned param, double tol, unsigned max_mults)
+{
+	const unsigned n(mat.getNRows());
+	double* x(new double[n]);
+	double* r(new double[n]);
+	MathLib::VectorKernels::setZero(n, x);
+
+	double eps(tol);
+	unsigned steps(max_mults);
+	unsigned ret(0);
+	std::string name;
+	BaseLib::RunTime timer;
+	timer.start();
+	switch (type) {
+	case BICGSTAB:
+		name = "BiCGStab";
+		// BiCGStab counts iterations with two multiplications each
+		steps = max_mults / 2;
+		ret = MathLib::BiCGStab(mat, b, x, eps, steps);
+		steps *= 2;
+		break;
+	case BICGSTAB_L:
+		name = "BiCGStab(" + std::string(1, '0' + param) + ")";
+		ret = MathLib::BiCGStabL(mat, b, x, param, eps, steps);
+		break;
+	case IDR_S:
+		name = "IDR(" + std::string(1, '0' + param) + ")";
+		ret = MathLib::IDRs(mat, b, x, param, eps, steps);
+		break;
+	case GMRES:
+		name = "GMRes(30)";
+		ret = MathLib::GMRes(mat, b, x, eps, 30, steps);
+		break;
+	}
+	timer.stop();
+
+	// true residual
+	mat.amux(1.0, x, r);
+	for (unsigned k(0); k < n; k++)
+		r[k] = b[k] - r[k];
+	const double true_resid(MathLib::VectorKernels::nrm2(n, r) / MathLib::VectorKernels::nrm2(n, b));
+
+	std::cout << std::setw(12) << name << ": " << std::setw(5) << steps << " mat-vec, "
+		<< std::scientific << std::setprecision(3) << timer.elapsed() << " s, residuum "
+		<< eps << ", true residuum " << true_resid
+		<< (ret == 0 ? "" : (ret == 1 ? " (not converged)" : " (breakdown)")) << std::endl;
+
+	delete [] x;
+	delete [] r;
+	return ret != 0 || true_resid < 10 * tol;
+}
+
+int main(int argc, char *argv[])
+{
+	if (argc != 4) {
+		std::cout << "Usage: " << argv[0] << " matrix rhs number-of-threads" << std::endl;
+		return -1;
+	}
+
+#ifdef _OPENMP
+	omp_set_num_threads(atoi(argv[3]));
+#endif
+
+	// *** reading matrix in crs format from file
+	std::string fname(argv[1]);
+	MathLib::CRSMatrixDiagPrecond *mat (new MathLib::CRSMatrixDiagPrecond(fname));
+	mat->calcPrecond();
+
+	unsigned n (mat->getNRows());
+	std::cout << "Parameters read: n=" << n << std::endl;
+
+	double *b(new double[n]);
+	// *** read rhs
+	fname = argv[2];
+	std::ifstream in(fname.c_str());
+	if (in) {
+		read (in, n, b);
+		in.close();
+	} else {
+		std::cout << "problem reading rhs - initializing b with 1.0" << std::endl;
+		for (size_t k(0); k<n; k++) {
+			b[k] = 1.0;
+		}
+	}
+
+	const double tol(1e-8);
+	const unsigned max_mults(20000);
+	std::cout << "time to solution (diagonal preconditioner, relative tolerance " << tol << ")" << std::endl;
+	bool ok(true);
+	ok &= run(*mat, b, BICGSTAB, 0, tol, max_mults);
+	ok &= run(*mat, b, BICGSTAB_L, 1, tol, max_mults);
+	ok &= run(*mat, b, BICGSTAB_L, 2, tol, max_mults);
+	ok &= run(*mat, b, BICGSTAB_L, 4, tol, max_mults);
+	ok &= run(*mat, b, IDR_S, 1, tol, max_mults);
+	ok &= run(*mat, b, IDR_S, 4, tol, max_mults);
+	ok &= run(*mat, b, IDR_S, 8, tol, max_mults);
+	ok &= run(*mat, b, GMRES, 0, tol, max_mults);
+
+	delete mat;
+	delete [] b;
+
+	return ok ? 0 : 1;
+}
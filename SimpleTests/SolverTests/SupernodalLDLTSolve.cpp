@@ -0,0 +1,116 @@
+#include <fstream>
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+#include "LinAlg/Solvers/SupernodalLDLT.h"
+#include "LinAlg/Sparse/CRSMatrix.h"
+#ifdef USE_ND_PERMUTATION
+#include "LinAlg/Sparse/NestedDissectionPermutation/Cluster.h"
+#endif
+#include "sparse.h"
+#include "vector_io.h"
+#include "RunTime.h"
+#include "CPUTime.h"
+
+int main(int argc, char *argv[])
+{
+	if (argc != 3) {
+		std::cout << "Usage: " << argv[0] << " matrix rhs" << std::endl;
+		return -1;
+	}
+
+	// *** reading matrix in crs format from file
+	std::string fname(argv[1]);
+	MathLib::CRSMatrix<double, unsigned> *mat (new MathLib::CRSMatrix<double, unsigned>(fname));
+
+	unsigned n (mat->getNRows());
+	std::cout << "Parameters read: n=" << n << ", nnz=" << mat->getNNZ() << std::endl;
+
+	double *x(new double[n]);
+	double *b(new double[n]);
+
+	// *** read rhs
+	fname = argv[2];
+	std::ifstream in(fname.c_str());
+	if (in) {
+		read (in, n, b);
+		in.close();
+	} else {
+		std::cout << "problem reading rhs - initializing b with 1.0" << std::endl;
+		for (size_t k(0); k<n; k++) {
+			b[k] = 1.0;
+		}
+	}
+
+	BaseLib::RunTime run_timer;
+	BaseLib::CPUTime cpu_timer;
+
+	unsigned *op_perm(NULL), *po_perm(NULL);
+#ifdef USE_ND_PERMUTATION
+	std::cout << "calculating nested dissection permutation ... " << std::flush;
+	run_timer.start();
+	cpu_timer.start();
+	MathLib::Cluster cluster_tree(n, const_cast<unsigned*>(mat->getRowPtrArray()),
+			const_cast<unsigned*>(mat->getColIdxArray()));
+	op_perm = new unsigned[n];
+	po_perm = new unsigned[n];
+	for (unsigned k(0); k<n; k++)
+		op_perm[k] = po_perm[k] = k;
+	cluster_tree.createClusterTree(op_perm, po_perm, 1000);
+	cpu_timer.stop();
+	run_timer.stop();
+	std::cout << "took " << cpu_timer.elapsed() << " sec time and " << run_timer.elapsed() << " sec" << std::endl;
+#endif
+
+	std::cout << "symbolic and numeric factorization ... " << std::flush;
+	run_timer.start();
+	cpu_timer.start();
+	MathLib::SupernodalLDLT ldlt(*mat, op_perm, po_perm);
+	cpu_timer.stop();
+	run_timer.stop();
+	std::cout << "took " << cpu_timer.elapsed() << " sec time and " << run_timer.elapsed() << " sec" << std::endl;
+	if (!ldlt.isFactorized()) {
+		std::cout << "factorization failed" << std::endl;
+		return -1;
+	}
+	std::cout << "\t" << ldlt.getNSupernodes() << " supernodes, height of supernodal tree "
+		<< ldlt.getTreeHeight() << ", " << ldlt.getNNZFactor() << " entries in the factor" << std::endl;
+
+	std::cout << "numeric refactorization ... " << std::flush;
+	run_timer.start();
+	cpu_timer.start();
+	ldlt.refactorize(*mat);
+	cpu_timer.stop();
+	run_timer.stop();
+	std::cout << "took " << cpu_timer.elapsed() << " sec time and " << run_timer.elapsed() << " sec" << std::endl;
+
+	for (unsigned k(0); k<n; k++)
+		x[k] = b[k];
+
+	std::cout << "forward and backward substitution ... " << std::flush;
+	run_timer.start();
+	cpu_timer.start();
+	ldlt.execute(x);
+	cpu_timer.stop();
+	run_timer.stop();
+	std::cout << "took " << cpu_timer.elapsed() << " sec time and " << run_timer.elapsed() << " sec" << std::endl;
+
+	// *** residual r = b - A x
+	double *r(new double[n]);
+	mat->amux(1.0, x, r);
+	double nrm_r(0.0), nrm_b(0.0);
+	for (unsigned k(0); k<n; k++) {
+		nrm_r += (b[k]-r[k]) * (b[k]-r[k]);
+		nrm_b += b[k] * b[k];
+	}
+	std::cout << "relative residual: " << sqrt(nrm_r/nrm_b) << std::endl;
+
+	delete [] r;
+	delete [] op_perm;
+	delete [] po_perm;
+	delete mat;
+	delete [] x;
+	delete [] b;
+
+	return 0;
+}